@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -27,14 +26,20 @@ namespace {
 
 }
 
-void aoc::y2015::day_01(const std::string& title) {
-
-    auto [part_1, part_2] = process_parens(
-        aoc::file_to_string(aoc::input_path(2015, 1))
+aoc::solver_ptr aoc::y2015::day_01() {
+    return aoc::make_solver(
+        []() {
+            return process_parens(
+                aoc::file_to_string(aoc::input_path(2015, 1))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [part_1, part_2] = inp;
+            return part_1;
+        },
+        [](const auto& inp) {
+            const auto& [part_1, part_2] = inp;
+            return part_2;
+        }
     );
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}", part_1);
-    std::println("  part 2: {}", part_2);
-    
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -44,19 +43,20 @@ namespace {
     }
 }
 
-void aoc::y2015::day_02(const std::string& title) {
-
-    auto boxes = aoc::file_to_string_vector(
-            aoc::input_path(2015, 2)
-        ) | rv::transform(
-            string_to_dimenions
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 2: {} ---", title);
-    std::println("  part 1: {}",
-        r::fold_left( boxes | rv::transform(area_of_paper_needed), 0, std::plus<>() )
-    );
-    std::println("  part 2: {}",
-        r::fold_left( boxes | rv::transform(length_of_ribbon), 0, std::plus<>() )
+aoc::solver_ptr aoc::y2015::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2015, 2)
+                ) | rv::transform(
+                    string_to_dimenions
+                ) | r::to<std::vector>();
+        },
+        [](const auto& boxes) {
+            return r::fold_left( boxes | rv::transform(area_of_paper_needed), 0, std::plus<>() );
+        },
+        [](const auto& boxes) {
+            return r::fold_left( boxes | rv::transform(length_of_ribbon), 0, std::plus<>() );
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -65,15 +64,16 @@ namespace {
     }
 }
 
-void aoc::y2015::day_03(const std::string& title) {
-
-    auto directions = aoc::file_to_string(aoc::input_path(2015, 3));
-
-    std::println("--- Day 3: {} ---", title);
-    std::println("  part 1: {}",
-        visited_locations( rv::all(directions) ).size()
-    );
-    std::println("  part 2: {}",
-        visited_by_two_santas( directions )
+aoc::solver_ptr aoc::y2015::day_03() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(aoc::input_path(2015, 3));
+        },
+        [](const auto& directions) {
+            return visited_locations( rv::all(directions) ).size();
+        },
+        [](const auto& directions) {
+            return visited_by_two_santas( directions );
+        }
     );
 }
\ No newline at end of file
@@ -2,10 +2,9 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
-#include "md5.h"
+#include "md5_multi.h"
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -14,27 +13,24 @@ namespace rv = std::ranges::views;
 
 namespace {
     uint64_t find_hash(const std::string& key, int n) {
-        auto target = std::string(n, '0');
-        for (uint64_t i = 1; i < std::numeric_limits<uint64_t>::max(); ++i) {
-            auto test = std::format("{}{}", key, std::to_string(i));
-            auto hash = md5(test);
-            if (hash.substr(0, n) == target) {
-                return i;
+        return aoc::md5_find_zero_prefixes(key, n, 1,
+            [](uint64_t, const aoc::md5_digest&) {
+                return false;
             }
-        }
-        throw std::runtime_error("???");
+        );
     }
 }
 
-void aoc::y2015::day_04(const std::string& title) {
-
-    auto key = aoc::file_to_string(aoc::input_path(2015, 4));
-
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}",
-        find_hash(key, 5)
-    );
-    std::println("  part 2: {}",
-        find_hash(key, 6)
+aoc::solver_ptr aoc::y2015::day_04() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(aoc::input_path(2015, 4));
+        },
+        [](const auto& key) {
+            return find_hash(key, 5);
+        },
+        [](const auto& key) {
+            return find_hash(key, 6);
+        }
     );
 }
\ No newline at end of file
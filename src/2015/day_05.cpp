@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -77,15 +76,16 @@ namespace {
 
 }
 
-void aoc::y2015::day_05(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(aoc::input_path(2015, 5));
-
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}",
-        r::count_if(inp, is_nice_part1)
-    );
-    std::println("  part 2: {}",
-        r::count_if(inp, is_nice_part2)
+aoc::solver_ptr aoc::y2015::day_05() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2015, 5));
+        },
+        [](const auto& inp) {
+            return r::count_if(inp, is_nice_part1);
+        },
+        [](const auto& inp) {
+            return r::count_if(inp, is_nice_part2);
+        }
     );
 }
\ No newline at end of file
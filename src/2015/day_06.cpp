@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -118,19 +117,20 @@ namespace {
     }
 }
 
-void aoc::y2015::day_06(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2015, 6)
-        ) | rv::transform(
-            str_to_instr
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}",
-        do_instructions(inp, true)
-    );
-    std::println("  part 2: {}",
-        do_instructions(inp, false)
+aoc::solver_ptr aoc::y2015::day_06() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2015, 6)
+                ) | rv::transform(
+                    str_to_instr
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return do_instructions(inp, true);
+        },
+        [](const auto& inp) {
+            return do_instructions(inp, false);
+        }
     );
 }
\ No newline at end of file
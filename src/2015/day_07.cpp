@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <memory>
@@ -231,23 +230,25 @@ namespace {
     }
 }
 
-void aoc::y2015::day_07(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(aoc::input_path(2015, 7));
-
-    auto nodes = parse_input(inp);
-    signal a_val = nodes["a"]->evaluate();
-
-    std::println("--- Day 7: {} ---", title);
-    
-    std::println("  part 1: {}", a_val );
-
-    for (auto node : nodes | rv::values) {
-        node->reset();
-    }
-    nodes["b"]->set_signal(a_val);
+aoc::solver_ptr aoc::y2015::day_07() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2015, 7));
+        },
+        [](const auto& inp) {
+            auto nodes = parse_input(inp);
+            return nodes["a"]->evaluate();
+        },
+        [](const auto& inp) {
+            auto nodes = parse_input(inp);
+            signal a_val = nodes["a"]->evaluate();
+
+            for (auto node : nodes | rv::values) {
+                node->reset();
+            }
+            nodes["b"]->set_signal(a_val);
 
-    std::println("  part 2: {}",
-        nodes["a"]->evaluate()
+            return nodes["a"]->evaluate();
+        }
     );
 }
\ No newline at end of file
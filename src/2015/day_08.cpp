@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -64,31 +63,32 @@ namespace {
     }
 }
 
-void aoc::y2015::day_08(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(aoc::input_path(2015, 8));
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}",
-        r::fold_left(
-            inp | rv::transform(
-                [](const std::string& str)->int{
-                    return str.size() - unescape(str).size();
-                }
-            ),
-            0,
-            std::plus<>()
-        )
-    );
-    std::println("  part 2: {}",
-        r::fold_left(
-            inp | rv::transform(
-                [](const std::string& str)->int {
-                    return escape(str).size() - str.size();
-                }
-            ),
-            0,
-            std::plus<>()
-        )
+aoc::solver_ptr aoc::y2015::day_08() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2015, 8));
+        },
+        [](const auto& inp) {
+            return r::fold_left(
+                inp | rv::transform(
+                    [](const std::string& str)->int{
+                        return str.size() - unescape(str).size();
+                    }
+                ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& inp) {
+            return r::fold_left(
+                inp | rv::transform(
+                    [](const std::string& str)->int {
+                        return escape(str).size() - str.size();
+                    }
+                ),
+                0,
+                std::plus<>()
+            );
+        }
     );
 }
\ No newline at end of file
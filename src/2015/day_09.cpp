@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <set>
@@ -115,16 +114,17 @@ namespace {
     }
 }
 
-void aoc::y2015::day_09(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(aoc::input_path(2015, 9));
-    auto graph = input_to_graph(inp);
-
-    std::println("--- Day 9: {} ---", title);
-    std::println("  part 1: {}",
-        shortest_hamiltonian_path(graph)
-    );
-    std::println("  part 2: {}",
-        longest_hamiltonian_path(graph)
+aoc::solver_ptr aoc::y2015::day_09() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(aoc::input_path(2015, 9));
+            return input_to_graph(inp);
+        },
+        [](const auto& graph) {
+            return shortest_hamiltonian_path(graph);
+        },
+        [](const auto& graph) {
+            return longest_hamiltonian_path(graph);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -37,21 +36,22 @@ namespace {
     }
 }
 
-void aoc::y2015::day_10(const std::string& title) {
-
-    auto series = aoc::file_to_string(
-            aoc::input_path(2015, 10)
-        ) | rv::transform(
-            [](char ch)->int {
-                return ch - '0';
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1: {}",
-        look_and_say_n_times(series,40).size()
-    );
-    std::println("  part 2: {}",
-        look_and_say_n_times(series, 50).size()
+aoc::solver_ptr aoc::y2015::day_10() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(
+                    aoc::input_path(2015, 10)
+                ) | rv::transform(
+                    [](char ch)->int {
+                        return ch - '0';
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& series) {
+            return look_and_say_n_times(series,40).size();
+        },
+        [](const auto& series) {
+            return look_and_say_n_times(series, 50).size();
+        }
     );
 }
\ No newline at end of file
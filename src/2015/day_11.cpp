@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <stack>
@@ -86,15 +85,16 @@ namespace {
     }
 }
 
-void aoc::y2015::day_11(const std::string& title) {
-
-    auto password = aoc::file_to_string(aoc::input_path(2015, 11));
-
-    std::println("--- Day 11: {} ---", title);
-    std::println("  part 1: {}",
-        next_valid_password(password)
-    );
-    std::println("  part 2: {}",
-        next_valid_password(next_valid_password(password))
+aoc::solver_ptr aoc::y2015::day_11() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(aoc::input_path(2015, 11));
+        },
+        [](const auto& password) {
+            return next_valid_password(password);
+        },
+        [](const auto& password) {
+            return next_valid_password(next_valid_password(password));
+        }
     );
 }
\ No newline at end of file
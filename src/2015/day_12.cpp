@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #define BOOST_JSON_NO_LIB 
@@ -66,23 +65,28 @@ namespace {
 
 */
 
-void aoc::y2015::day_12(const std::string& title) {
-
-    auto inp = aoc::file_to_string(aoc::input_path(2015, 12));
-    /*
-    std::println("--- Day 12: {} ---", title);
-    std::println("  part 1: {}",
-        r::fold_left(
-            aoc::extract_numbers(inp, true),
-            0,
-            std::plus<>()
-        )
-    );
-    
-    std::println("  part 2: {}",
-        recursive_sum_of_numbers_in_non_red_objects(
-            boost::json::parse(inp)
-        )
+aoc::solver_ptr aoc::y2015::day_12() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(aoc::input_path(2015, 12));
+        },
+        [](const auto& inp) {
+            /*
+            return r::fold_left(
+                aoc::extract_numbers(inp, true),
+                0,
+                std::plus<>()
+            );
+            */
+            return "<disabled>";
+        },
+        [](const auto& inp) {
+            /*
+            return recursive_sum_of_numbers_in_non_red_objects(
+                boost::json::parse(inp)
+            );
+            */
+            return "<disabled>";
+        }
     );
-    */
 }
\ No newline at end of file
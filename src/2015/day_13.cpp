@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <set>
 #include <unordered_map>
@@ -97,21 +96,21 @@ namespace {
     }
 }
 
-void aoc::y2015::day_13(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2015, 13)
-        ) | rv::transform(
-            str_to_potential_happiness_statement
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 13: {} ---", title);
-    std::println("  part 1: {}",
-        maxmize_happiness(inp)
-    );
-
-    inp.emplace_back( "me", 0, inp.front().who );
-    std::println("  part 2: {}",
-        maxmize_happiness(inp)
+aoc::solver_ptr aoc::y2015::day_13() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2015, 13)
+                ) | rv::transform(
+                    str_to_potential_happiness_statement
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return maxmize_happiness(inp);
+        },
+        [](auto inp) {
+            inp.emplace_back( "me", 0, inp.front().who );
+            return maxmize_happiness(inp);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -64,19 +63,20 @@ namespace {
     }
 }
 
-void aoc::y2015::day_14(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2015, 14)
-        ) | rv::transform(
-            str_to_reindeer_stats
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}",
-        winning_reindeer_distance(inp, 2503)
-    );
-    std::println("  part 2: {}",
-        winning_reindeer_points(inp, 2503)
+aoc::solver_ptr aoc::y2015::day_14() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2015, 14)
+                ) | rv::transform(
+                    str_to_reindeer_stats
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return winning_reindeer_distance(inp, 2503);
+        },
+        [](const auto& inp) {
+            return winning_reindeer_points(inp, 2503);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -112,19 +111,20 @@ namespace {
     }
 }
 
-void aoc::y2015::day_15(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2015, 15)
-        ) | rv::transform(
-            str_to_ingredient
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 15: {} ---", title);
-    std::println("  part 1: {}",
-        highest_scoring_cookie(inp)
-    );
-    std::println("  part 2: {}",
-        highest_scoring_500_calory_cookie(inp)
+aoc::solver_ptr aoc::y2015::day_15() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2015, 15)
+                ) | rv::transform(
+                    str_to_ingredient
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return highest_scoring_cookie(inp);
+        },
+        [](const auto& inp) {
+            return highest_scoring_500_calory_cookie(inp);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <map>
@@ -77,24 +76,27 @@ namespace {
 
 }
 
-void aoc::y2015::day_16(const std::string& title) {
-
-    auto sues = aoc::file_to_string_vector(
-            aoc::input_path(2015, 16)
-        ) | rv::transform(
-            str_to_sue_spec
-        ) | r::to<sue_list>();
-
-    auto unknown_sue = str_to_sue_spec(
-            "Sue 0: children: 3, cats : 7, samoyeds : 2, pomeranians : 3, "
-            "akitas : 0, vizslas : 0, goldfish : 5, trees : 3, cars : 2, perfumes : 1"
-        ).props;
-
-    std::println("--- Day 16: {} ---", title);
-    std::println("  part 1: {}",
-        matching_sue(sues, unknown_sue, true)
-    );
-    std::println("  part 2: {}",
-        matching_sue(sues, unknown_sue, false)
+aoc::solver_ptr aoc::y2015::day_16() {
+    return aoc::make_solver(
+        []() {
+            auto sues = aoc::file_to_string_vector(
+                    aoc::input_path(2015, 16)
+                ) | rv::transform(
+                    str_to_sue_spec
+                ) | r::to<sue_list>();
+            auto unknown_sue = str_to_sue_spec(
+                    "Sue 0: children: 3, cats : 7, samoyeds : 2, pomeranians : 3, "
+                    "akitas : 0, vizslas : 0, goldfish : 5, trees : 3, cars : 2, perfumes : 1"
+                ).props;
+            return std::tuple{ std::move(sues), std::move(unknown_sue) };
+        },
+        [](const auto& inp) {
+            const auto& [sues, unknown_sue] = inp;
+            return matching_sue(sues, unknown_sue, true);
+        },
+        [](const auto& inp) {
+            const auto& [sues, unknown_sue] = inp;
+            return matching_sue(sues, unknown_sue, false);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -75,19 +74,20 @@ namespace {
     }
 }
 
-void aoc::y2015::day_17(const std::string& title) {
-
-    auto nums = aoc::extract_numbers(
-            aoc::file_to_string(
-                aoc::input_path(2015, 17)
-            )
-        );
-
-    std::println("--- Day 17: {} ---", title);
-    std::println("  part 1: {}",
-        do_part_1(nums)
-    );
-    std::println("  part 2: {}",
-        do_part_2(nums)
+aoc::solver_ptr aoc::y2015::day_17() {
+    return aoc::make_solver(
+        []() {
+            return aoc::extract_numbers(
+                    aoc::file_to_string(
+                        aoc::input_path(2015, 17)
+                    )
+                );
+        },
+        [](const auto& nums) {
+            return do_part_1(nums);
+        },
+        [](const auto& nums) {
+            return do_part_2(nums);
+        }
     );
 }
\ No newline at end of file
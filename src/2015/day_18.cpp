@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -105,15 +104,16 @@ namespace {
     }
 }
 
-void aoc::y2015::day_18(const std::string& title) {
-
-    auto grid = aoc::file_to_string_vector(aoc::input_path(2015, 18));
-
-    std::println("--- Day 18: {} ---", title);
-    std::println("  part 1: {}",
-        alive_after_n_generations(grid, 100, false)
-    );
-    std::println("  part 2: {}",
-        alive_after_n_generations(grid, 100, true)
+aoc::solver_ptr aoc::y2015::day_18() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2015, 18));
+        },
+        [](const auto& grid) {
+            return alive_after_n_generations(grid, 100, false);
+        },
+        [](const auto& grid) {
+            return alive_after_n_generations(grid, 100, true);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <queue>
@@ -154,18 +153,20 @@ namespace {
     }
 }
 
-void aoc::y2015::day_19(const std::string& title) {
-
-    auto [rules, molecule] = parse_input(
-        aoc::file_to_string_vector(aoc::input_path(2015, 19))
-    );
-
-    std::println("--- Day 19: {} ---", title);
-    std::println("  part 1: {}",
-        number_of_unique_rule_applications(rules, molecule)
-    );
-
-    std::println("  part 2: {}", 
-        reduce_molecule_steps(rules, molecule)
+aoc::solver_ptr aoc::y2015::day_19() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(aoc::input_path(2015, 19))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [rules, molecule] = inp;
+            return number_of_unique_rule_applications(rules, molecule);
+        },
+        [](const auto& inp) {
+            const auto& [rules, molecule] = inp;
+            return reduce_molecule_steps(rules, molecule);
+        }
     );
 }
\ No newline at end of file
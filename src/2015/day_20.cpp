@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -64,15 +63,16 @@ namespace {
     }
 }
 
-void aoc::y2015::day_20(const std::string& title) {
-
-    auto num = aoc::string_to_int64(aoc::file_to_string(aoc::input_path(2015, 20)));
-
-    std::println("--- Day 20: {} ---", title);
-    std::println("  part 1: {}",
-        do_part_1(num)
-    );
-    std::println("  part 2: {}",
-        do_part_2(num)
+aoc::solver_ptr aoc::y2015::day_20() {
+    return aoc::make_solver(
+        []() {
+            return aoc::string_to_int64(aoc::file_to_string(aoc::input_path(2015, 20)));
+        },
+        [](const auto& num) {
+            return do_part_1(num);
+        },
+        [](const auto& num) {
+            return do_part_2(num);
+        }
     );
 }
\ No newline at end of file
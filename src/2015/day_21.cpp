@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -129,19 +128,20 @@ namespace {
     }
 }
 
-void aoc::y2015::day_21(const std::string& title) {
-
-    auto boss = parse_boss_stats(
-        aoc::file_to_string(aoc::input_path(2015, 21))
-    );
-
-    auto items = all_player_options() | r::to<std::vector>();
-
-    std::println("--- Day 21: {} ---", title);
-    std::println("  part 1: {}",
-        find_cheapest_winning_player_stats( boss )
-    );
-    std::println("  part 2: {}",
-        find_priciest_losing_player_stats( boss )
+aoc::solver_ptr aoc::y2015::day_21() {
+    return aoc::make_solver(
+        []() {
+            auto boss = parse_boss_stats(
+                aoc::file_to_string(aoc::input_path(2015, 21))
+            );
+            auto items = all_player_options() | r::to<std::vector>();
+            return boss;
+        },
+        [](const auto& boss) {
+            return find_cheapest_winning_player_stats( boss );
+        },
+        [](const auto& boss) {
+            return find_priciest_losing_player_stats( boss );
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/functional/hash.hpp>
@@ -210,10 +209,11 @@ namespace {
         return min_mana_win;
     }
 
+    template<template<typename, typename> typename Queue>
     int lowest_mana_win(const character_stats& player, const character_stats& boss, bool hard_mode) {
 
         state_to_mana_map mana_consumed;
-        aoc::priority_queue<game_state, game_state_hash> queue;
+        aoc::priority_queue<game_state, game_state_hash, Queue> queue;
         game_state start_state = { player, boss, 0, 0, 0 };
         queue.insert(start_state, 0);
         mana_consumed[start_state] = 0;
@@ -253,19 +253,31 @@ namespace {
     }
 }
 
-void aoc::y2015::day_22(const std::string& title) {
-
-    auto boss = parse_boss_stats(
-        aoc::file_to_string(aoc::input_path(2015, 22))
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2015::day_22_with_queue() {
+    return aoc::make_solver(
+        []() {
+            auto boss = parse_boss_stats(
+                aoc::file_to_string(aoc::input_path(2015, 22))
+            );
+            auto player = player_stats();
+            return std::tuple{ std::move(boss), std::move(player) };
+        },
+        [](const auto& inp) {
+            const auto& [boss, player] = inp;
+            return lowest_mana_win<Queue>(player, boss, false);
+        },
+        [](const auto& inp) {
+            const auto& [boss, player] = inp;
+            return lowest_mana_win<Queue>(player, boss, true);
+        }
     );
+}
 
-    auto player = player_stats();
+template aoc::solver_ptr aoc::y2015::day_22_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2015::day_22_with_queue<aoc::indexed_4ary_heap>();
+template aoc::solver_ptr aoc::y2015::day_22_with_queue<aoc::radix_heap>();
 
-    std::println("--- Day 22: {} ---", title);
-    std::println("  part 1: {}",
-        lowest_mana_win(player, boss, false)
-    );
-    std::println("  part 2: {}",
-        lowest_mana_win(player, boss, true)
-    );
+aoc::solver_ptr aoc::y2015::day_22() {
+    return day_22_with_queue<aoc::radix_heap>();
 }
\ No newline at end of file
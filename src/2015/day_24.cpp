@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <set>
@@ -171,33 +170,32 @@ namespace {
     }
 }
 
-void aoc::y2015::day_24(const std::string& title) {
-
-    auto nums = aoc::file_to_string_vector(
-            aoc::input_path(2015, 24)
-        ) | rv::transform(
-            [](auto&& str) {
-                return std::stoi(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 24: {} ---", title);
-
-    // Do part 1 for real ... that is, by finding all
-    // divisions into three subsets with the same
-    // weight and then finding all the smallest ones
-    // and returning the smallest product.
-
-    std::println("  part 1: {}",
-        do_part_1(nums)
-    );
-
-    // Do part 2 by assuming that the smallest product
-    // of all the lowest cardinality subsets that sum
-    // to the total/4 is the answer. THis works for
-    // part 1 too but I don't know that it has to be true.
-
-    std::println("  part 2: {}",
-        do_part_2(nums)
+aoc::solver_ptr aoc::y2015::day_24() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2015, 24)
+                ) | rv::transform(
+                    [](auto&& str) {
+                        return std::stoi(str);
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& nums) {
+            // Do part 1 for real ... that is, by finding all
+            // divisions into three subsets with the same
+            // weight and then finding all the smallest ones
+            // and returning the smallest product.
+
+            return do_part_1(nums);
+        },
+        [](const auto& nums) {
+            // Do part 2 by assuming that the smallest product
+            // of all the lowest cardinality subsets that sum
+            // to the total/4 is the answer. THis works for
+            // part 1 too but I don't know that it has to be true.
+
+            return do_part_2(nums);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2015.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -29,17 +28,18 @@ namespace {
     }
 }
 
-void aoc::y2015::day_25(const std::string& title) {
-
-    auto nums = aoc::extract_numbers(
-        aoc::file_to_string(aoc::input_path(2015, 25))
-    );
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}",
-        nth_code(row_and_col_to_index(nums[0], nums[1]))
-    );
-    std::println("  part 2: {}",
-        "<xmas freebie>"
+aoc::solver_ptr aoc::y2015::day_25() {
+    return aoc::make_solver(
+        []() {
+            return aoc::extract_numbers(
+                aoc::file_to_string(aoc::input_path(2015, 25))
+            );
+        },
+        [](const auto& nums) {
+            return nth_code(row_and_col_to_index(nums[0], nums[1]));
+        },
+        [](const auto&) {
+            return "<xmas freebie>";
+        }
     );
 }
\ No newline at end of file
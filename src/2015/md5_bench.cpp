@@ -0,0 +1,69 @@
+#include "md5.h"
+#include "md5_multi.h"
+#include "../util/bench.h"
+#include <algorithm>
+#include <format>
+#include <print>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace r = std::ranges;
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // the number of messages whose hash starts with "000", as a check that every
+    // engine computes the same hashes.
+    constexpr int k_md5_zeros = 3;
+
+    int count_zero_prefixed_reference(const std::vector<std::string>& messages) {
+        int count = 0;
+        for (const auto& msg : messages) {
+            count += md5(msg).starts_with(std::string(k_md5_zeros, '0')) ? 1 : 0;
+        }
+        return count;
+    }
+
+    int count_zero_prefixed(const std::vector<std::string_view>& messages, int lanes) {
+        std::vector<aoc::md5_digest> digests(messages.size());
+        aoc::md5_many(messages, digests, lanes);
+        return static_cast<int>(r::count_if(digests,
+            [](const auto& digest) {
+                return aoc::md5_has_zero_prefix(digest, k_md5_zeros);
+            }
+        ));
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void aoc::benchmark_md5(int reps) {
+    std::vector<std::string> messages;
+    for (int i = 0; i < 1000000; ++i) {
+        messages.push_back(std::format("abcdef{}", i));
+    }
+    std::vector<std::string_view> views(messages.begin(), messages.end());
+
+    std::println("{:>10} {:>6} {:>12} {:>8} {:>8}", "engine", "lanes", "median ms", "speedup", "result");
+    auto [baseline_ms, expected] = time_median(reps,
+        [&]() {
+            return count_zero_prefixed_reference(messages);
+        }
+    );
+    std::println("{:>10} {:>6} {:>12.3f} {:>7.2f}x {:>8}", "reference", 1, baseline_ms, 1.0, expected);
+    for (int lanes : { 1, 4, 8, 16 }) {
+        if (lanes > md5_lanes()) {
+            break;
+        }
+        auto [ms, result] = time_median(reps,
+            [&]() {
+                return count_zero_prefixed(views, lanes);
+            }
+        );
+        std::println("{:>10} {:>6} {:>12.3f} {:>7.2f}x {:>8}{}", "lanes", lanes, ms, baseline_ms / ms, result,
+            (result == expected) ? "" : " mismatch");
+    }
+}
@@ -0,0 +1,711 @@
+#include "md5_multi.h"
+#include "../util/thread_pool.h"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define AOC_MD5_X64
+#define AOC_MD5_TARGET(isa) __attribute__((target(isa)))
+#elif defined(_M_X64) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#define AOC_MD5_X64
+#define AOC_MD5_TARGET(isa)
+#endif
+
+// the kernels are always inlined into a function compiled for their instruction
+// set, so vectors are never actually passed through a call whose ABI could differ.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AOC_MD5_INLINE __forceinline
+#else
+#define AOC_MD5_INLINE [[gnu::always_inline]] inline
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    constexpr std::array<uint32_t, 64> k_sines = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+    };
+
+    constexpr std::array<int, 16> k_shifts = {
+        7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21
+    };
+
+    constexpr aoc::md5_digest k_initial_state = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+
+    constexpr int k_max_lanes = 16;
+
+    // the nonces each thread hashes per round of a search.
+    constexpr uint64_t k_nonce_block_size = 1 << 17;
+
+    constexpr int k_max_nonce_digits = 20;
+
+    constexpr int message_word(int step) {
+        switch (step / 16) {
+            case 0: return step;
+            case 1: return (5 * step + 1) % 16;
+            case 2: return (3 * step + 5) % 16;
+            default: return (7 * step) % 16;
+        }
+    }
+
+    // The lane types give the MD5 rounds the same operations on one 32-bit word
+    // or on a vector of them, so md5_rounds is written once for every width. The
+    // functions of the wider types are compiled for their instruction set whatever
+    // the compiler flags, and are only called after checking the CPU supports it.
+
+    struct scalar_lanes {
+        using type = uint32_t;
+        static constexpr int width = 1;
+
+        static type load(const uint32_t* p) { return *p; }
+        static void store(uint32_t* p, type v) { *p = v; }
+        static type set1(uint32_t v) { return v; }
+        static type add(type a, type b) { return a + b; }
+        static type bit_and(type a, type b) { return a & b; }
+        static type bit_or(type a, type b) { return a | b; }
+        static type f(type x, type y, type z) { return z ^ (x & (y ^ z)); }
+        static type g(type x, type y, type z) { return y ^ (z & (x ^ y)); }
+        static type h(type x, type y, type z) { return x ^ y ^ z; }
+        static type i(type x, type y, type z) { return y ^ (x | ~z); }
+
+        template<int n>
+        static type rotl(type x) { return std::rotl(x, n); }
+
+        template<int n>
+        static type shl(type x) { return x << n; }
+
+        template<int n>
+        static type shr(type x) { return x >> n; }
+    };
+
+#ifdef AOC_MD5_X64
+
+    struct sse2_lanes {
+        using type = __m128i;
+        static constexpr int width = 4;
+
+        static type load(const uint32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        static void store(uint32_t* p, type v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+        static type set1(uint32_t v) { return _mm_set1_epi32(static_cast<int>(v)); }
+        static type add(type a, type b) { return _mm_add_epi32(a, b); }
+        static type bit_and(type a, type b) { return _mm_and_si128(a, b); }
+        static type bit_or(type a, type b) { return _mm_or_si128(a, b); }
+        static type f(type x, type y, type z) { return _mm_xor_si128(z, _mm_and_si128(x, _mm_xor_si128(y, z))); }
+        static type g(type x, type y, type z) { return _mm_xor_si128(y, _mm_and_si128(z, _mm_xor_si128(x, y))); }
+        static type h(type x, type y, type z) { return _mm_xor_si128(_mm_xor_si128(x, y), z); }
+
+        static type i(type x, type y, type z) {
+            return _mm_xor_si128(y, _mm_or_si128(x, _mm_xor_si128(z, _mm_set1_epi32(-1))));
+        }
+
+        template<int n>
+        static type rotl(type x) { return _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n)); }
+
+        template<int n>
+        static type shl(type x) { return _mm_slli_epi32(x, n); }
+
+        template<int n>
+        static type shr(type x) { return _mm_srli_epi32(x, n); }
+    };
+
+    struct avx2_lanes {
+        using type = __m256i;
+        static constexpr int width = 8;
+
+        AOC_MD5_TARGET("avx2") static type load(const uint32_t* p) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        }
+
+        AOC_MD5_TARGET("avx2") static void store(uint32_t* p, type v) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+        }
+
+        AOC_MD5_TARGET("avx2") static type set1(uint32_t v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+        AOC_MD5_TARGET("avx2") static type add(type a, type b) { return _mm256_add_epi32(a, b); }
+        AOC_MD5_TARGET("avx2") static type bit_and(type a, type b) { return _mm256_and_si256(a, b); }
+        AOC_MD5_TARGET("avx2") static type bit_or(type a, type b) { return _mm256_or_si256(a, b); }
+
+        AOC_MD5_TARGET("avx2") static type f(type x, type y, type z) {
+            return _mm256_xor_si256(z, _mm256_and_si256(x, _mm256_xor_si256(y, z)));
+        }
+
+        AOC_MD5_TARGET("avx2") static type g(type x, type y, type z) {
+            return _mm256_xor_si256(y, _mm256_and_si256(z, _mm256_xor_si256(x, y)));
+        }
+
+        AOC_MD5_TARGET("avx2") static type h(type x, type y, type z) {
+            return _mm256_xor_si256(_mm256_xor_si256(x, y), z);
+        }
+
+        AOC_MD5_TARGET("avx2") static type i(type x, type y, type z) {
+            return _mm256_xor_si256(y, _mm256_or_si256(x, _mm256_xor_si256(z, _mm256_set1_epi32(-1))));
+        }
+
+        template<int n>
+        AOC_MD5_TARGET("avx2") static type rotl(type x) {
+            return _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - n));
+        }
+
+        template<int n>
+        AOC_MD5_TARGET("avx2") static type shl(type x) { return _mm256_slli_epi32(x, n); }
+
+        template<int n>
+        AOC_MD5_TARGET("avx2") static type shr(type x) { return _mm256_srli_epi32(x, n); }
+    };
+
+    // AVX-512 has rotates, and each round function is a single ternary logic
+    // instruction whose immediate is its truth table.
+
+    struct avx512_lanes {
+        using type = __m512i;
+        static constexpr int width = 16;
+
+        AOC_MD5_TARGET("avx512f") static type load(const uint32_t* p) { return _mm512_loadu_si512(p); }
+        AOC_MD5_TARGET("avx512f") static void store(uint32_t* p, type v) { _mm512_storeu_si512(p, v); }
+        AOC_MD5_TARGET("avx512f") static type set1(uint32_t v) { return _mm512_set1_epi32(static_cast<int>(v)); }
+        AOC_MD5_TARGET("avx512f") static type add(type a, type b) { return _mm512_add_epi32(a, b); }
+        AOC_MD5_TARGET("avx512f") static type bit_and(type a, type b) { return _mm512_and_si512(a, b); }
+        AOC_MD5_TARGET("avx512f") static type bit_or(type a, type b) { return _mm512_or_si512(a, b); }
+        AOC_MD5_TARGET("avx512f") static type f(type x, type y, type z) { return _mm512_ternarylogic_epi32(x, y, z, 0xca); }
+        AOC_MD5_TARGET("avx512f") static type g(type x, type y, type z) { return _mm512_ternarylogic_epi32(x, y, z, 0xe4); }
+        AOC_MD5_TARGET("avx512f") static type h(type x, type y, type z) { return _mm512_ternarylogic_epi32(x, y, z, 0x96); }
+        AOC_MD5_TARGET("avx512f") static type i(type x, type y, type z) { return _mm512_ternarylogic_epi32(x, y, z, 0x39); }
+
+        template<int n>
+        AOC_MD5_TARGET("avx512f") static type rotl(type x) { return _mm512_rol_epi32(x, n); }
+
+        template<int n>
+        AOC_MD5_TARGET("avx512f") static type shl(type x) { return _mm512_slli_epi32(x, n); }
+
+        template<int n>
+        AOC_MD5_TARGET("avx512f") static type shr(type x) { return _mm512_srli_epi32(x, n); }
+    };
+
+#endif
+
+    // x holds a, b, c and d. Each step updates one of them, moving back through
+    // them, so step s writes x[-s mod 4] from the three that follow it.
+
+    template<typename V, int S>
+    AOC_MD5_INLINE void md5_step(typename V::type* x, const uint32_t* block) {
+        constexpr int a = (4 - S % 4) % 4;
+        constexpr int b = (a + 1) % 4;
+        constexpr int c = (a + 2) % 4;
+        constexpr int d = (a + 3) % 4;
+        typename V::type mix;
+        if constexpr (S < 16) {
+            mix = V::f(x[b], x[c], x[d]);
+        } else if constexpr (S < 32) {
+            mix = V::g(x[b], x[c], x[d]);
+        } else if constexpr (S < 48) {
+            mix = V::h(x[b], x[c], x[d]);
+        } else {
+            mix = V::i(x[b], x[c], x[d]);
+        }
+        auto sum = V::add(V::add(x[a], mix), V::add(V::load(block + message_word(S) * V::width), V::set1(k_sines[S])));
+        x[a] = V::add(x[b], V::template rotl<k_shifts[(S / 16) * 4 + S % 4]>(sum));
+    }
+
+    template<typename V, int... S>
+    AOC_MD5_INLINE void md5_steps(typename V::type* x, const uint32_t* block, std::integer_sequence<int, S...>) {
+        (md5_step<V, S>(x, block), ...);
+    }
+
+    // applies one block to each lane's state. Both are stored word by word, lanes
+    // side by side: word w of lane l is at [w * V::width + l].
+
+    template<typename V>
+    AOC_MD5_INLINE void md5_rounds(const uint32_t* block, uint32_t* state) {
+        constexpr int w = V::width;
+        typename V::type x[4] = {
+            V::load(state), V::load(state + w), V::load(state + 2 * w), V::load(state + 3 * w)
+        };
+        md5_steps<V>(x, block, std::make_integer_sequence<int, 64>{});
+        for (int i = 0; i < 4; ++i) {
+            V::store(state + i * w, V::add(V::load(state + i * w), x[i]));
+        }
+    }
+
+    template<typename V>
+    AOC_MD5_INLINE void hash_lanes(const uint32_t* blocks, uint32_t* states, const uint32_t* initial) {
+        for (int i = 0; i < 4; ++i) {
+            V::store(states + i * V::width, V::set1(initial[i]));
+        }
+        md5_rounds<V>(blocks, states);
+    }
+
+    // the four hex digits of the low 16 bits of each lane, in the order they
+    // appear in the hex form of a digest, as a little-endian word of ASCII. The
+    // nibbles are spread one to a byte, and a byte becomes a letter rather than
+    // a digit when adding 6 to it carries into its fifth bit.
+    template<typename V>
+    AOC_MD5_INLINE typename V::type hex_word(typename V::type x) {
+        auto nibbles = V::bit_or(
+            V::bit_or(
+                V::bit_and(V::template shr<4>(x), V::set1(0x0000000f)),
+                V::bit_and(V::template shl<8>(x), V::set1(0x00000f00))
+            ),
+            V::bit_or(
+                V::bit_and(V::template shl<4>(x), V::set1(0x000f0000)),
+                V::bit_and(V::template shl<16>(x), V::set1(0x0f000000))
+            )
+        );
+        auto letters = V::bit_and(V::template shr<4>(V::add(nibbles, V::set1(0x06060606))), V::set1(0x01010101));
+        auto letter_offsets = V::bit_or(
+            V::bit_or(letters, V::template shl<1>(letters)),
+            V::bit_or(V::template shl<2>(letters), V::template shl<5>(letters))
+        );
+        return V::add(V::add(nibbles, V::set1(0x30303030)), letter_offsets);
+    }
+
+    // replaces each lane's state, rounds times, with the digest of its 32 hex
+    // digits. The hex is built in the vector registers, and the rest of the
+    // block, the padding of a 32-byte message, is written once.
+    template<typename V>
+    AOC_MD5_INLINE void stretch_lanes(uint32_t* states, int rounds) {
+        constexpr int w = V::width;
+        alignas(64) std::array<uint32_t, 16 * w> block;
+        for (int word = 8; word < 16; ++word) {
+            V::store(block.data() + word * w, V::set1((word == 8) ? 0x80 : (word == 14) ? 32 * 8 : 0));
+        }
+        for (int round = 0; round < rounds; ++round) {
+            for (int i = 0; i < 4; ++i) {
+                auto x = V::load(states + i * w);
+                V::store(block.data() + 2 * i * w, hex_word<V>(x));
+                V::store(block.data() + (2 * i + 1) * w, hex_word<V>(V::template shr<16>(x)));
+            }
+            hash_lanes<V>(block.data(), states, k_initial_state.data());
+        }
+    }
+
+    // each applies the final block of V::width messages to the same initial
+    // state, which is the state after any earlier blocks the messages share.
+
+    using hash_lanes_fn = void (*)(const uint32_t* blocks, uint32_t* states, const uint32_t* initial);
+    using stretch_lanes_fn = void (*)(uint32_t* states, int rounds);
+
+    void hash_lanes_scalar(const uint32_t* blocks, uint32_t* states, const uint32_t* initial) {
+        hash_lanes<scalar_lanes>(blocks, states, initial);
+    }
+
+    void stretch_lanes_scalar(uint32_t* states, int rounds) {
+        stretch_lanes<scalar_lanes>(states, rounds);
+    }
+
+#ifdef AOC_MD5_X64
+
+    void hash_lanes_sse2(const uint32_t* blocks, uint32_t* states, const uint32_t* initial) {
+        hash_lanes<sse2_lanes>(blocks, states, initial);
+    }
+
+    void stretch_lanes_sse2(uint32_t* states, int rounds) {
+        stretch_lanes<sse2_lanes>(states, rounds);
+    }
+
+    AOC_MD5_TARGET("avx2") void hash_lanes_avx2(const uint32_t* blocks, uint32_t* states, const uint32_t* initial) {
+        hash_lanes<avx2_lanes>(blocks, states, initial);
+    }
+
+    AOC_MD5_TARGET("avx2") void stretch_lanes_avx2(uint32_t* states, int rounds) {
+        stretch_lanes<avx2_lanes>(states, rounds);
+    }
+
+    AOC_MD5_TARGET("avx512f") void hash_lanes_avx512(const uint32_t* blocks, uint32_t* states, const uint32_t* initial) {
+        hash_lanes<avx512_lanes>(blocks, states, initial);
+    }
+
+    AOC_MD5_TARGET("avx512f") void stretch_lanes_avx512(uint32_t* states, int rounds) {
+        stretch_lanes<avx512_lanes>(states, rounds);
+    }
+
+#if defined(_MSC_VER) && !defined(__clang__)
+
+    // the OS must also save the vector registers on a context switch.
+    bool os_saves_state(uint64_t mask) {
+        int regs[4];
+        __cpuid(regs, 1);
+        return (regs[2] & (1 << 27)) && (_xgetbv(0) & mask) == mask;
+    }
+
+    bool cpu_has_leaf_7_feature(int bit) {
+        int regs[4];
+        __cpuid(regs, 0);
+        if (regs[0] < 7) {
+            return false;
+        }
+        __cpuidex(regs, 7, 0);
+        return (regs[1] & (1 << bit)) != 0;
+    }
+
+    bool cpu_has_avx2() {
+        return cpu_has_leaf_7_feature(5) && os_saves_state(0x6);
+    }
+
+    bool cpu_has_avx512f() {
+        return cpu_has_leaf_7_feature(16) && os_saves_state(0xe6);
+    }
+
+#else
+
+    bool cpu_has_avx2() {
+        return __builtin_cpu_supports("avx2");
+    }
+
+    bool cpu_has_avx512f() {
+        return __builtin_cpu_supports("avx512f");
+    }
+
+#endif
+#endif
+
+    struct lane_engine {
+        std::string name;
+        int lanes;
+        hash_lanes_fn hash;
+        stretch_lanes_fn stretch;
+    };
+
+    // the engines this CPU supports, widest first.
+    const std::vector<lane_engine>& engines() {
+        static const std::vector<lane_engine> engines = []() {
+            std::vector<lane_engine> supported;
+#ifdef AOC_MD5_X64
+            if (cpu_has_avx512f()) {
+                supported.emplace_back("avx-512", 16, hash_lanes_avx512, stretch_lanes_avx512);
+            }
+            if (cpu_has_avx2()) {
+                supported.emplace_back("avx2", 8, hash_lanes_avx2, stretch_lanes_avx2);
+            }
+            supported.emplace_back("sse2", 4, hash_lanes_sse2, stretch_lanes_sse2);
+#endif
+            supported.emplace_back("scalar", 1, hash_lanes_scalar, stretch_lanes_scalar);
+            return supported;
+        }();
+        return engines;
+    }
+
+    const lane_engine& engine(int max_lanes) {
+        for (const auto& eng : engines()) {
+            if (max_lanes <= 0 || eng.lanes <= max_lanes) {
+                return eng;
+            }
+        }
+        return engines().back();
+    }
+
+    // the words of a 64-byte block, which MD5 reads as little-endian.
+    void block_to_words(const unsigned char* bytes, uint32_t* words, int stride) {
+        for (int i = 0; i < 16; ++i) {
+            uint32_t word;
+            std::memcpy(&word, bytes + 4 * i, 4);
+            if constexpr (std::endian::native == std::endian::big) {
+                word = std::byteswap(word);
+            }
+            words[i * stride] = word;
+        }
+    }
+
+    // writes the padded single block of a short message into one lane.
+    void pack_short_message(std::string_view msg, uint32_t* blocks, int lane, int lanes) {
+        std::array<unsigned char, 64> bytes = {};
+        std::memcpy(bytes.data(), msg.data(), msg.size());
+        bytes[msg.size()] = 0x80;
+        auto bits = static_cast<uint64_t>(msg.size()) * 8;
+        for (int i = 0; i < 8; ++i) {
+            bytes[56 + i] = static_cast<unsigned char>(bits >> (8 * i));
+        }
+        block_to_words(bytes.data(), blocks + lane, lanes);
+    }
+
+    struct nonce_hit {
+        uint64_t nonce;
+        aoc::md5_digest digest;
+    };
+
+    // the final block of the messages of a search: the part of the key after its
+    // whole blocks, then a nonce in decimal and the padding. The nonce is counted
+    // up in place, so only the digits that change are rewritten.
+
+    class nonce_block {
+    public:
+        nonce_block(std::string_view tail, uint64_t key_size, uint64_t nonce) :
+                tail_(tail),
+                key_size_(key_size) {
+            auto [end, ec] = std::to_chars(digits_.data(), digits_.data() + digits_.size(), nonce);
+            num_digits_ = static_cast<int>(end - digits_.data());
+            lay_out();
+        }
+
+        void increment() {
+            int i = num_digits_ - 1;
+            for (; i >= 0 && digits_[i] == '9'; --i) {
+                digits_[i] = '0';
+                bytes_[tail_.size() + i] = '0';
+            }
+            if (i >= 0) {
+                bytes_[tail_.size() + i] = ++digits_[i];
+                return;
+            }
+            digits_[0] = '1';
+            digits_[num_digits_++] = '0';
+            lay_out();
+        }
+
+        // writes the block into a lane whose previous block had lane_digits
+        // digits. Only the words holding digits are written if that is the same
+        // length as this one, as the rest of the block is then unchanged.
+        void write(uint32_t* blocks, int lane, int lanes, int& lane_digits) const {
+            if (lane_digits != num_digits_) {
+                block_to_words(bytes_.data(), blocks + lane, lanes);
+                lane_digits = num_digits_;
+                return;
+            }
+            auto first = tail_.size() / 4;
+            auto last = (tail_.size() + num_digits_) / 4;
+            for (auto i = first; i <= last; ++i) {
+                uint32_t word;
+                std::memcpy(&word, bytes_.data() + 4 * i, 4);
+                if constexpr (std::endian::native == std::endian::big) {
+                    word = std::byteswap(word);
+                }
+                blocks[i * lanes + lane] = word;
+            }
+        }
+
+    private:
+        std::string_view tail_;
+        uint64_t key_size_;
+        std::array<char, k_max_nonce_digits> digits_;
+        int num_digits_;
+        std::array<unsigned char, 64> bytes_;
+
+        void lay_out() {
+            bytes_.fill(0);
+            std::memcpy(bytes_.data(), tail_.data(), tail_.size());
+            std::memcpy(bytes_.data() + tail_.size(), digits_.data(), num_digits_);
+            bytes_[tail_.size() + num_digits_] = 0x80;
+            auto bits = (key_size_ + num_digits_) * 8;
+            for (int i = 0; i < 8; ++i) {
+                bytes_[56 + i] = static_cast<unsigned char>(bits >> (8 * i));
+            }
+        }
+    };
+
+    class nonce_search {
+    public:
+        nonce_search(std::string_view key, const aoc::md5_digest& mask) :
+                key_(key),
+                mask_(mask),
+                state_(k_initial_state) {
+            auto whole_blocks = key.size() / 64;
+            std::array<uint32_t, 16> block;
+            for (size_t i = 0; i < whole_blocks; ++i) {
+                block_to_words(reinterpret_cast<const unsigned char*>(key.data()) + 64 * i, block.data(), 1);
+                md5_rounds<scalar_lanes>(block.data(), state_.data());
+            }
+            tail_ = key.substr(64 * whole_blocks);
+        }
+
+        // appends the hits among the nonces in [first, last) in order.
+        void scan(uint64_t first, uint64_t last, std::vector<nonce_hit>& hits) const {
+            if (tail_.size() + k_max_nonce_digits > aoc::k_md5_max_short_message) {
+                scan_long(first, last, hits);
+                return;
+            }
+            const auto& eng = engine(0);
+            auto lanes = eng.lanes;
+            alignas(64) std::array<uint32_t, 16 * k_max_lanes> blocks;
+            alignas(64) std::array<uint32_t, 4 * k_max_lanes> states;
+            std::array<int, k_max_lanes> lane_digits;
+            lane_digits.fill(0);
+
+            nonce_block block(tail_, key_.size(), first);
+            for (auto nonce = first; nonce < last; nonce += lanes) {
+                auto count = static_cast<int>(std::min<uint64_t>(lanes, last - nonce));
+                for (int lane = 0; lane < count; ++lane) {
+                    block.write(blocks.data(), lane, lanes, lane_digits[lane]);
+                    block.increment();
+                }
+                eng.hash(blocks.data(), states.data(), state_.data());
+                for (int lane = 0; lane < count; ++lane) {
+                    aoc::md5_digest digest = {
+                        states[lane], states[lanes + lane], states[2 * lanes + lane], states[3 * lanes + lane]
+                    };
+                    if (aoc::md5_matches(digest, mask_)) {
+                        hits.emplace_back(nonce + lane, digest);
+                    }
+                }
+            }
+        }
+
+    private:
+        std::string_view key_;
+        aoc::md5_digest mask_;
+        aoc::md5_digest state_;
+        std::string_view tail_;
+
+        // keys whose tail leaves no room for the nonce in the final block.
+        void scan_long(uint64_t first, uint64_t last, std::vector<nonce_hit>& hits) const {
+            std::string msg(key_);
+            for (auto nonce = first; nonce < last; ++nonce) {
+                msg.resize(key_.size());
+                msg += std::to_string(nonce);
+                auto digest = aoc::md5_digest_of(msg);
+                if (aoc::md5_matches(digest, mask_)) {
+                    hits.emplace_back(nonce, digest);
+                }
+            }
+        }
+    };
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::md5_digest aoc::md5_digest_of(std::string_view msg) {
+    std::vector<unsigned char> padded(msg.begin(), msg.end());
+    padded.push_back(0x80);
+    while (padded.size() % 64 != 56) {
+        padded.push_back(0);
+    }
+    auto bits = static_cast<uint64_t>(msg.size()) * 8;
+    for (int i = 0; i < 8; ++i) {
+        padded.push_back(static_cast<unsigned char>(bits >> (8 * i)));
+    }
+
+    md5_digest state = k_initial_state;
+    std::array<uint32_t, 16> block;
+    for (size_t offset = 0; offset < padded.size(); offset += 64) {
+        block_to_words(padded.data() + offset, block.data(), 1);
+        md5_rounds<scalar_lanes>(block.data(), state.data());
+    }
+    return state;
+}
+
+std::string aoc::md5_hex(const md5_digest& digest) {
+    std::string hex;
+    hex.reserve(32);
+    for (int i = 0; i < 32; ++i) {
+        hex.push_back("0123456789abcdef"[md5_hex_digit(digest, i)]);
+    }
+    return hex;
+}
+
+int aoc::md5_lanes() {
+    return engine(0).lanes;
+}
+
+std::string aoc::md5_engine() {
+    return engine(0).name;
+}
+
+void aoc::md5_many(std::span<const std::string_view> messages, std::span<md5_digest> digests,
+        int max_lanes) {
+    const auto& eng = engine(max_lanes);
+    auto lanes = eng.lanes;
+    alignas(64) std::array<uint32_t, 16 * k_max_lanes> blocks;
+    alignas(64) std::array<uint32_t, 4 * k_max_lanes> states;
+    std::array<size_t, k_max_lanes> indices;
+
+    auto flush = [&](int count) {
+        eng.hash(blocks.data(), states.data(), k_initial_state.data());
+        for (int lane = 0; lane < count; ++lane) {
+            for (int word = 0; word < 4; ++word) {
+                digests[indices[lane]][word] = states[word * lanes + lane];
+            }
+        }
+    };
+
+    int count = 0;
+    for (size_t i = 0; i < messages.size(); ++i) {
+        if (messages[i].size() > k_md5_max_short_message) {
+            digests[i] = md5_digest_of(messages[i]);
+            continue;
+        }
+        pack_short_message(messages[i], blocks.data(), count, lanes);
+        indices[count++] = i;
+        if (count == lanes) {
+            flush(count);
+            count = 0;
+        }
+    }
+    if (count > 0) {
+        for (int lane = count; lane < lanes; ++lane) {
+            pack_short_message({}, blocks.data(), lane, lanes);
+        }
+        flush(count);
+    }
+}
+
+void aoc::md5_stretch(std::span<md5_digest> digests, int rounds, int max_lanes) {
+    const auto& eng = engine(max_lanes);
+    auto lanes = eng.lanes;
+    alignas(64) std::array<uint32_t, 4 * k_max_lanes> states;
+
+    for (size_t first = 0; first < digests.size(); first += lanes) {
+        auto count = static_cast<int>(std::min<size_t>(lanes, digests.size() - first));
+        states.fill(0);
+        for (int lane = 0; lane < count; ++lane) {
+            for (int word = 0; word < 4; ++word) {
+                states[word * lanes + lane] = digests[first + lane][word];
+            }
+        }
+        eng.stretch(states.data(), rounds);
+        for (int lane = 0; lane < count; ++lane) {
+            for (int word = 0; word < 4; ++word) {
+                digests[first + lane][word] = states[word * lanes + lane];
+            }
+        }
+    }
+}
+
+uint64_t aoc::md5_find_nonces(std::string_view key, const md5_digest& mask, uint64_t first,
+        const md5_nonce_fn& fn, thread_pool& pool) {
+    nonce_search search(key, mask);
+    std::vector<std::vector<nonce_hit>> hits(pool.size());
+
+    for (auto base = first; ; base += k_nonce_block_size * hits.size()) {
+        thread_pool::task_group round;
+        for (size_t i = 0; i < hits.size(); ++i) {
+            pool.submit(round,
+                [&, i, base]() {
+                    hits[i].clear();
+                    auto block_first = base + i * k_nonce_block_size;
+                    search.scan(block_first, block_first + k_nonce_block_size, hits[i]);
+                }
+            );
+        }
+        pool.wait(round);
+
+        for (const auto& block_hits : hits) {
+            for (const auto& hit : block_hits) {
+                if (!fn(hit.nonce, hit.digest)) {
+                    return hit.nonce;
+                }
+            }
+        }
+    }
+}
+
+uint64_t aoc::md5_find_zero_prefixes(std::string_view key, int num_zeros, uint64_t first,
+        const md5_nonce_fn& fn, thread_pool& pool) {
+    return md5_find_nonces(key, md5_zero_prefix_mask(num_zeros), first, fn, pool);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "../util/self_test.h"
+#include "../util/thread_pool.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace aoc {
+
+    // an MD5 digest as the four words of the final hash state. The digest's bytes
+    // are the bytes of these words, least significant byte first, so its first hex
+    // digit is the high nibble of the low byte of the first word.
+    using md5_digest = std::array<uint32_t, 4>;
+
+    // messages this long or shorter fit, with their padding, in a single block.
+    constexpr size_t k_md5_max_short_message = 55;
+
+    md5_digest md5_digest_of(std::string_view msg);
+    std::string md5_hex(const md5_digest& digest);
+
+    // the i-th hex digit of the digest, from 0 to 31.
+    inline int md5_hex_digit(const md5_digest& digest, int i) {
+        auto byte = (digest[i / 8] >> (8 * ((i % 8) / 2))) & 0xff;
+        return static_cast<int>((i % 2 == 0) ? byte >> 4 : byte & 0xf);
+    }
+
+    // the bits of the first num_zeros hex digits.
+    inline md5_digest md5_zero_prefix_mask(int num_zeros) {
+        md5_digest mask = {};
+        for (int i = 0; i < num_zeros && i < 32; ++i) {
+            mask[i / 8] |= uint32_t{ 0xf } << (8 * ((i % 8) / 2) + ((i % 2 == 0) ? 4 : 0));
+        }
+        return mask;
+    }
+
+    // true if the digest is zero wherever the mask is set.
+    inline bool md5_matches(const md5_digest& digest, const md5_digest& mask) {
+        return ((digest[0] & mask[0]) | (digest[1] & mask[1]) | (digest[2] & mask[2]) | (digest[3] & mask[3])) == 0;
+    }
+
+    // true if the hex form of the digest starts with num_zeros zeros, tested on
+    // the digest words without formatting them.
+    inline bool md5_has_zero_prefix(const md5_digest& digest, int num_zeros) {
+        return md5_matches(digest, md5_zero_prefix_mask(num_zeros));
+    }
+
+    // hashes independent messages side by side in the lanes of the widest vector
+    // unit the CPU supports, chosen at run time: 16 lanes with AVX-512, 8 with
+    // AVX2, 4 with SSE2, or one at a time elsewhere. Messages longer than
+    // k_md5_max_short_message are hashed one at a time. A max_lanes above 0 caps
+    // the width used, to compare the engines.
+    void md5_many(std::span<const std::string_view> messages, std::span<md5_digest> digests,
+        int max_lanes = 0);
+
+    // replaces each digest, rounds times, with the digest of its hex form, as
+    // many at once as md5_many hashes.
+    void md5_stretch(std::span<md5_digest> digests, int rounds, int max_lanes = 0);
+
+    // the number of messages md5_many hashes at once, and the name of its engine.
+    int md5_lanes();
+    std::string md5_engine();
+
+    // calls fn, in order, with each nonce from first upwards for which the hash
+    // of key followed by the nonce in decimal matches mask, until fn returns
+    // false. Returns the nonce at which fn returned false.
+    //
+    // the search runs on a thread pool, the shared one by default, in rounds in
+    // which every thread hashes a contiguous block of nonces. The hits of a round
+    // are passed to fn in order on the calling thread once the whole round is
+    // done, so the result is that of a sequential scan. The key's whole blocks
+    // are hashed once up front, and the nonces are counted up in decimal in place
+    // rather than formatted one by one.
+    using md5_nonce_fn = std::function<bool(uint64_t, const md5_digest&)>;
+    uint64_t md5_find_nonces(std::string_view key, const md5_digest& mask, uint64_t first,
+        const md5_nonce_fn& fn, thread_pool& pool = shared_thread_pool());
+
+    // md5_find_nonces for the hashes that start with num_zeros zeros.
+    uint64_t md5_find_zero_prefixes(std::string_view key, int num_zeros, uint64_t first,
+        const md5_nonce_fn& fn, thread_pool& pool = shared_thread_pool());
+
+    // times hashing short messages with the reference MD5 class and with the
+    // multi-buffer engine at each lane width the CPU supports; 'bench md5'.
+    void benchmark_md5(int reps);
+
+    // checks of md5_many, md5_stretch and the nonce search, at every lane width,
+    // against the reference MD5 class; 'test'.
+    const self_test_table& md5_self_tests();
+
+}
@@ -0,0 +1,137 @@
+#include "md5.h"
+#include "md5_multi.h"
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // the test suite of RFC 1321, which covers messages of one and of two blocks.
+    const std::vector<std::tuple<std::string, std::string>> k_md5_vectors = {
+        { "", "d41d8cd98f00b204e9800998ecf8427e" },
+        { "a", "0cc175b9c0f1b6a831c399e269772661" },
+        { "abc", "900150983cd24fb0d6963f7d28e17f72" },
+        { "message digest", "f96b697d7cb7938d525a2f31aaf161d0" },
+        { "abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b" },
+        { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "d174ab98d277d9f5a5611c2c9f419d9f" },
+        {
+            "12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+            "57edf4a22be3c955ac49da2e2107b67a"
+        }
+    };
+
+    // the lane widths the CPU supports.
+    std::vector<int> md5_lane_widths() {
+        std::vector<int> widths;
+        for (int lanes : { 1, 4, 8, 16 }) {
+            if (lanes <= aoc::md5_lanes()) {
+                widths.push_back(lanes);
+            }
+        }
+        return widths;
+    }
+
+    bool md5_reference_matches_vectors() {
+        for (const auto& [msg, hex] : k_md5_vectors) {
+            if (md5(msg) != hex || aoc::md5_hex(aoc::md5_digest_of(msg)) != hex) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // more messages than the widest engine has lanes, and not a multiple of any
+    // width, so that every engine also hashes a partly filled batch.
+    bool md5_many_matches_reference() {
+        std::vector<std::string> messages;
+        for (const auto& [msg, hex] : k_md5_vectors) {
+            messages.push_back(msg);
+        }
+        for (int i = 0; i < 37; ++i) {
+            messages.push_back("abcdef" + std::to_string(i * 7919));
+        }
+        std::vector<std::string_view> views(messages.begin(), messages.end());
+        for (int lanes : md5_lane_widths()) {
+            std::vector<aoc::md5_digest> digests(messages.size());
+            aoc::md5_many(views, digests, lanes);
+            for (size_t i = 0; i < messages.size(); ++i) {
+                if (digests[i] != aoc::md5_digest_of(messages[i]) || aoc::md5_hex(digests[i]) != md5(messages[i])) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool md5_stretch_matches_reference() {
+        constexpr int k_rounds = 5;
+        std::vector<std::string> expected;
+        std::vector<aoc::md5_digest> seeds;
+        for (int i = 0; i < 21; ++i) {
+            auto msg = "abc" + std::to_string(i);
+            seeds.push_back(aoc::md5_digest_of(msg));
+            auto hex = md5(msg);
+            for (int round = 0; round < k_rounds; ++round) {
+                hex = md5(hex);
+            }
+            expected.push_back(hex);
+        }
+        for (int lanes : md5_lane_widths()) {
+            auto digests = seeds;
+            aoc::md5_stretch(digests, k_rounds, lanes);
+            for (size_t i = 0; i < digests.size(); ++i) {
+                if (aoc::md5_hex(digests[i]) != expected[i]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // the first hits of the parallel nonce search against a scan of the nonces in
+    // order with the reference class, for a key that leaves room for the nonce in
+    // its last block, one whose whole first block is hashed up front, and one too
+    // long for the nonce to fit, which takes the one-at-a-time path.
+    bool md5_nonce_search_matches_scan() {
+        constexpr int k_zeros = 2;
+        constexpr int k_hits = 4;
+        for (std::string key : {
+                std::string("abcdef"),
+                std::string(70, 'k'),
+                std::string("a key that is longer than thirty-five bytes")}) {
+            std::vector<std::tuple<uint64_t, std::string>> expected;
+            for (uint64_t nonce = 0; expected.size() < k_hits; ++nonce) {
+                auto hex = md5(key + std::to_string(nonce));
+                if (hex.starts_with(std::string(k_zeros, '0'))) {
+                    expected.emplace_back(nonce, hex);
+                }
+            }
+            std::vector<std::tuple<uint64_t, std::string>> found;
+            aoc::md5_find_zero_prefixes(key, k_zeros, 0,
+                [&](uint64_t nonce, const aoc::md5_digest& digest) {
+                    found.emplace_back(nonce, aoc::md5_hex(digest));
+                    return found.size() < k_hits;
+                }
+            );
+            if (found != expected) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+const aoc::self_test_table& aoc::md5_self_tests() {
+    static const self_test_table tests = {
+        { "md5 reference matches rfc 1321", md5_reference_matches_vectors },
+        { "md5 many matches reference at every width", md5_many_matches_reference },
+        { "md5 stretch matches reference at every width", md5_stretch_matches_reference },
+        { "md5 nonce search matches sequential scan", md5_nonce_search_matches_scan }
+    };
+    return tests;
+}
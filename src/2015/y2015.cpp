@@ -1,47 +1,32 @@
 #include "y2015.h"
-#include <vector>
-#include <functional>
-#include <print>
 
-void aoc::y2015::do_advent_of_code(int day) {
-    const static auto advent_of_code_2015 = std::vector<std::function<void()>>{
-        []() { day_01( "Not Quite Lisp" ); },
-        []() { day_02( "I Was Told There Would Be No Math" ); },
-        []() { day_03( "Perfectly Spherical Houses in a Vacuum" ); },
-        []() { day_04( "The Ideal Stocking Stuffer" ); },
-        []() { day_05( "Doesn't He Have Intern-Elves For This?" ); },
-        []() { day_06( "Probably a Fire Hazard" ); },
-        []() { day_07( "Some Assembly Required" ); },
-        []() { day_08( "Matchsticks" ); },
-        []() { day_09( "All in a Single Night" ); },
-        []() { day_10( "Elves Look, Elves Say" ); },
-        []() { day_11( "Corporate Policy" ); },
-        []() { day_12( "JSAbacusFramework.io" ); },
-        []() { day_13( "Knights of the Dinner Table" ); },
-        []() { day_14( "Reindeer Olympics" ); },
-        []() { day_15( "Science for Hungry People" ); },
-        []() { day_16( "Aunt Sue" ); },
-        []() { day_17( "No Such Thing as Too Much"); },
-        []() { day_18( "Like a GIF For Your Yard"); },
-        []() { day_19( "Medicine for Rudolph" ); },
-        []() { day_20( "Infinite Elves and Infinite Houses" ); },
-        []() { day_21( "RPG Simulator 20XX" ); },
-        []() { day_22( "Wizard Simulator 20XX"); },
-        []() { day_23( "Opening the Turing Lock"); },
-        []() { day_24( "It Hangs in the Balance"); },
-        []() { day_25( "Let It Snow"); }
+const aoc::day_table& aoc::y2015::days() {
+    const static auto advent_of_code_2015 = aoc::day_table{
+        { "Not Quite Lisp", day_01 },
+        { "I Was Told There Would Be No Math", day_02 },
+        { "Perfectly Spherical Houses in a Vacuum", day_03 },
+        { "The Ideal Stocking Stuffer", day_04 },
+        { "Doesn't He Have Intern-Elves For This?", day_05 },
+        { "Probably a Fire Hazard", day_06 },
+        { "Some Assembly Required", day_07 },
+        { "Matchsticks", day_08 },
+        { "All in a Single Night", day_09 },
+        { "Elves Look, Elves Say", day_10 },
+        { "Corporate Policy", day_11 },
+        { "JSAbacusFramework.io", day_12 },
+        { "Knights of the Dinner Table", day_13 },
+        { "Reindeer Olympics", day_14 },
+        { "Science for Hungry People", day_15 },
+        { "Aunt Sue", day_16 },
+        { "No Such Thing as Too Much", day_17 },
+        { "Like a GIF For Your Yard", day_18 },
+        { "Medicine for Rudolph", day_19 },
+        { "Infinite Elves and Infinite Houses", day_20 },
+        { "RPG Simulator 20XX", day_21 },
+        { "Wizard Simulator 20XX", day_22 },
+        { "Opening the Turing Lock", day_23 },
+        { "It Hangs in the Balance", day_24 },
+        { "Let It Snow", day_25 }
     };
-    
-    auto index = day - 1;
-    if (index < 0) {
-        std::print("invalid day: {0}\n", day);
-        return;
-    }
-
-    if (index < advent_of_code_2015.size()) {
-        advent_of_code_2015[index]();
-    }
-    else {
-        std::print("Day {0} is not complete.\n", day);
-    }
+    return advent_of_code_2015;
 }
\ No newline at end of file
@@ -1,35 +1,40 @@
 #pragma once
 
-#include <string>
+#include "../util/solver.h"
 
 namespace aoc {
     namespace y2015 {
-        void day_01(const std::string& title);
-        void day_02(const std::string& title);
-        void day_03(const std::string& title);
-        void day_04(const std::string& title);
-        void day_05(const std::string& title);
-        void day_06(const std::string& title);
-        void day_07(const std::string& title);
-        void day_08(const std::string& title);
-        void day_09(const std::string& title);
-        void day_10(const std::string& title);
-        void day_11(const std::string& title);
-        void day_12(const std::string& title);
-        void day_13(const std::string& title);
-        void day_14(const std::string& title);
-        void day_15(const std::string& title);
-        void day_16(const std::string& title);
-        void day_17(const std::string& title);
-        void day_18(const std::string& title);
-        void day_19(const std::string& title);
-        void day_20(const std::string& title);
-        void day_21(const std::string& title);
-        void day_22(const std::string& title);
-        void day_23(const std::string& title);
-        void day_24(const std::string& title);
-        void day_25(const std::string& title);
+        solver_ptr day_01();
+        solver_ptr day_02();
+        solver_ptr day_03();
+        solver_ptr day_04();
+        solver_ptr day_05();
+        solver_ptr day_06();
+        solver_ptr day_07();
+        solver_ptr day_08();
+        solver_ptr day_09();
+        solver_ptr day_10();
+        solver_ptr day_11();
+        solver_ptr day_12();
+        solver_ptr day_13();
+        solver_ptr day_14();
+        solver_ptr day_15();
+        solver_ptr day_16();
+        solver_ptr day_17();
+        solver_ptr day_18();
+        solver_ptr day_19();
+        solver_ptr day_20();
+        solver_ptr day_21();
+        solver_ptr day_22();
+        solver_ptr day_23();
+        solver_ptr day_24();
+        solver_ptr day_25();
 
-        void do_advent_of_code(int day);
+        // the days whose searches can run on each aoc::priority_queue
+        // implementation, for the queue benchmark.
+        template<template<typename, typename> typename Queue>
+        solver_ptr day_22_with_queue();
+
+        const day_table& days();
     }
 }
\ No newline at end of file
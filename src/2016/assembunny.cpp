@@ -0,0 +1,137 @@
+#include "assembunny.h"
+#include <optional>
+#include <tuple>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    using instruction = aoc::vm_instruction;
+
+    constexpr int k_add_loop_length = 3;
+    constexpr int k_mul_loop_length = 6;
+
+    // the register an instruction increments or decrements, with the sign of the
+    // step, if it is an inc or a dec.
+    std::optional<std::tuple<int, int64_t>> step_of(const instruction& instr) {
+        if (instr.op != aoc::vm_op::add && instr.op != aoc::vm_op::sub) {
+            return {};
+        }
+        if (instr.reg_flags != instruction::k_a_is_reg || instr.a != instr.dst || instr.b != 1) {
+            return {};
+        }
+        return { { instr.dst, (instr.op == aoc::vm_op::add) ? 1 : -1 } };
+    }
+
+    bool is_dec(const instruction& instr, int reg) {
+        auto step = step_of(instr);
+        return step && *step == std::tuple<int, int64_t>{ reg, -1 };
+    }
+
+    // a jnz on a register back by the given distance.
+    bool is_loop_back(const instruction& instr, int reg, int distance) {
+        return instr.op == aoc::vm_op::jnz && instr.reg_flags == instruction::k_a_is_reg &&
+            instr.a == reg && instr.b == -distance;
+    }
+
+    // one of
+    //
+    //     inc/dec x        dec y
+    //     dec y            inc/dec x
+    //     jnz y -2         jnz y -2
+    //
+    // with x and y different, which adds y to x, or subtracts it, and clears y.
+    std::optional<aoc::vm_macro> recognise_add_loop(std::span<const instruction> code, size_t start) {
+        if (start + k_add_loop_length > code.size()) {
+            return {};
+        }
+        auto first = step_of(code[start]);
+        auto second = step_of(code[start + 1]);
+        const auto& jump = code[start + 2];
+        if (!first || !second || jump.op != aoc::vm_op::jnz) {
+            return {};
+        }
+        auto counter = static_cast<int>(jump.a);
+        if (!is_loop_back(jump, counter, 2)) {
+            return {};
+        }
+        auto counter_is_second = is_dec(code[start + 1], counter);
+        auto [target, sign] = counter_is_second ? *first : *second;
+        if (target == counter || !is_dec(code[counter_is_second ? start + 1 : start], counter)) {
+            return {};
+        }
+        return aoc::vm_macro{
+            aoc::vm_macro_kind::add_loop, k_add_loop_length, target, sign, aoc::vm_imm(0), 0, counter
+        };
+    }
+
+    // an add loop nested in another that counts down a second register:
+    //
+    //     cpy s c
+    //     <add loop adding c to x>
+    //     dec d
+    //     jnz d -5
+    //
+    // with x, c and d different and s none of them, which adds s * d to x, or
+    // subtracts it, and clears c and d.
+    std::optional<aoc::vm_macro> recognise_mul_loop(std::span<const instruction> code, size_t start) {
+        if (start + k_mul_loop_length > code.size() || code[start].op != aoc::vm_op::set) {
+            return {};
+        }
+        auto inner_loop = recognise_add_loop(code, start + 1);
+        if (!inner_loop) {
+            return {};
+        }
+        auto inner = code[start].dst;
+        auto outer_step = step_of(code[start + 4]);
+        if (inner_loop->outer != inner || !outer_step) {
+            return {};
+        }
+        auto outer = std::get<0>(*outer_step);
+        if (!is_dec(code[start + 4], outer) || !is_loop_back(code[start + 5], outer, 5)) {
+            return {};
+        }
+
+        aoc::vm_operand source = {
+            code[start].a, (code[start].reg_flags & instruction::k_a_is_reg) != 0
+        };
+        auto target = inner_loop->target;
+        if (outer == target || outer == inner ||
+                (source.is_register && (source.value == target || source.value == inner || source.value == outer))) {
+            return {};
+        }
+        return aoc::vm_macro{
+            aoc::vm_macro_kind::mul_loop, k_mul_loop_length, target, inner_loop->sign, source, inner, outer
+        };
+    }
+
+    std::optional<aoc::vm_macro> recognise_loop(std::span<const instruction> code, size_t start) {
+        if (auto mul_loop = recognise_mul_loop(code, start); mul_loop) {
+            return mul_loop;
+        }
+        return recognise_add_loop(code, start);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+const aoc::vm_dialect& aoc::assembunny_dialect() {
+    // tgl turns one-operand instructions into inc, or dec if they already are,
+    // and two-operand ones into jnz, or cpy if they already are.
+    static const vm_dialect dialect(
+        {
+            {"cpy", vm_op::set, vm_written(1), vm_written(0), vm_none(), "jnz"},
+            {"inc", vm_op::add, vm_written(0), vm_written(0), vm_const(1), "dec"},
+            {"dec", vm_op::sub, vm_written(0), vm_written(0), vm_const(1), "inc"},
+            {"jnz", vm_op::jnz, vm_none(), vm_written(0), vm_written(1), "cpy"},
+            {"tgl", vm_op::tgl, vm_none(), vm_written(0), vm_none(), "inc"},
+            {"out", vm_op::out, vm_none(), vm_written(0), vm_none(), "inc"}
+        },
+        { recognise_loop, k_mul_loop_length }
+    );
+    return dialect;
+}
+
+aoc::vm_program aoc::assemble_assembunny(const std::vector<std::string>& lines) {
+    return vm_assemble(assembunny_dialect(), lines);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "../util/register_vm.h"
+#include "../util/self_test.h"
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+    // the assembunny of days 12, 23 and 25 as a dialect of the register machine,
+    // with its registers a to d as registers 0 to 3.
+    const vm_dialect& assembunny_dialect();
+
+    vm_program assemble_assembunny(const std::vector<std::string>& lines);
+
+    // checks that the add and mul loop macro-ops leave the registers as running
+    // the plain instructions does, including when a tgl rewrites a pattern.
+    const self_test_table& assembunny_self_tests();
+
+}
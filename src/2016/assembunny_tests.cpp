@@ -0,0 +1,135 @@
+#include "assembunny.h"
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // assembunny with an empty peephole table, so every instruction runs as
+    // written.
+    const aoc::vm_dialect& plain_assembunny_dialect() {
+        static const aoc::vm_dialect dialect = []() {
+            const auto& assembunny = aoc::assembunny_dialect();
+            std::vector<aoc::vm_opcode> opcodes;
+            for (int code = 0; code < assembunny.num_codes(); ++code) {
+                opcodes.push_back(assembunny.opcode(code));
+            }
+            return aoc::vm_dialect(std::move(opcodes), aoc::vm_peephole{ nullptr, 0 });
+        }();
+        return dialect;
+    }
+
+    // runs the program both with the macro-ops and without, from the same value
+    // of a, and checks the registers agree and, if toggles_add_macros, that tgls
+    // rewrote instructions into patterns not there at the start.
+    bool matches_plain_run(const std::vector<std::string>& lines, int64_t a = 0,
+            bool toggles_add_macros = false) {
+        auto fast = aoc::assemble_assembunny(lines);
+        aoc::vm_machine plain(aoc::vm_assemble(plain_assembunny_dialect(), lines));
+        aoc::vm_machine machine(fast);
+        plain.reg('a') = a;
+        machine.reg('a') = a;
+        return !fast.macros.empty() && plain.run() == aoc::vm_status::halted &&
+            machine.run() == aoc::vm_status::halted && machine.registers() == plain.registers() &&
+            (!toggles_add_macros || machine.program().macros.size() > fast.macros.size());
+    }
+
+    bool assembunny_add_loops_match() {
+        return matches_plain_run({
+            "cpy 5 b",
+            "cpy 3 a",
+            "inc a",
+            "dec b",
+            "jnz b -2",
+            "cpy 4 c",
+            "dec c",
+            "dec a",
+            "jnz c -2"
+        });
+    }
+
+    bool assembunny_mul_loop_matches() {
+        return matches_plain_run({
+            "cpy 4 b",
+            "cpy 3 d",
+            "cpy b c",
+            "inc a",
+            "dec c",
+            "jnz c -2",
+            "dec d",
+            "jnz d -5"
+        });
+    }
+
+    // the tgl turns the add loop's dec a into inc a before it runs, flipping
+    // the sign of the macro-op.
+    bool assembunny_toggle_within_pattern_matches() {
+        return matches_plain_run({
+            "cpy 3 a",
+            "cpy 4 b",
+            "tgl 1",
+            "dec a",
+            "dec b",
+            "jnz b -2"
+        });
+    }
+
+    // the tgl turns the add loop's jnz into a cpy to a number, which does
+    // nothing, so the loop body runs once.
+    bool assembunny_toggle_breaking_pattern_matches() {
+        return matches_plain_run({
+            "cpy 3 a",
+            "cpy 4 b",
+            "tgl 3",
+            "inc a",
+            "dec b",
+            "jnz b -2"
+        });
+    }
+
+    // the shape of 2016 day 23: the tgl in the outer loop rewrites every other
+    // instruction of the tail, turning it into a mul loop, and finally ends the
+    // outer loop by turning its jnz into a cpy.
+    bool assembunny_toggles_building_pattern_match() {
+        return matches_plain_run({
+            "cpy a b",
+            "dec b",
+            "cpy a d",
+            "cpy 0 a",
+            "cpy b c",
+            "inc a",
+            "dec c",
+            "jnz c -2",
+            "dec d",
+            "jnz d -5",
+            "dec b",
+            "cpy b c",
+            "cpy c d",
+            "dec d",
+            "inc c",
+            "jnz d -2",
+            "tgl c",
+            "cpy -16 c",
+            "jnz 1 c",
+            "cpy 7 c",
+            "jnz 5 d",
+            "inc a",
+            "inc d",
+            "jnz d -2",
+            "inc c",
+            "jnz c -5"
+        }, 6, true);
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+const aoc::self_test_table& aoc::assembunny_self_tests() {
+    static const self_test_table tests = {
+        { "assembunny add loops match", assembunny_add_loops_match },
+        { "assembunny mul loop matches", assembunny_mul_loop_matches },
+        { "assembunny toggle within pattern matches", assembunny_toggle_within_pattern_matches },
+        { "assembunny toggle breaking pattern matches", assembunny_toggle_breaking_pattern_matches },
+        { "assembunny toggles building pattern match", assembunny_toggles_building_pattern_match }
+    };
+    return tests;
+}
@@ -4,7 +4,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -92,18 +91,22 @@ namespace {
     }
 }
 
-void aoc::y2016::day_01(const std::string& title) {
-
-    auto inp = aoc::extract_alphanumeric(
-            aoc::file_to_string(
-                aoc::input_path(2016, 1)
-            )
-        ) | rv::transform(
-            parse_instruction
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}", follow_instructions(inp) );
-    std::println("  part 2: {}", distance_to_first_crossing(inp) );
-    
+aoc::solver_ptr aoc::y2016::day_01() {
+    return aoc::make_solver(
+        []() {
+            return aoc::extract_alphanumeric(
+                    aoc::file_to_string(
+                        aoc::input_path(2016, 1)
+                    )
+                ) | rv::transform(
+                    parse_instruction
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return follow_instructions(inp);
+        },
+        [](const auto& inp) {
+            return distance_to_first_crossing(inp);
+        }
+    );
 }
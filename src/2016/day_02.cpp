@@ -4,7 +4,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -80,28 +79,33 @@ namespace {
     }
 }
 
-void aoc::y2016::day_02(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 2)
-        ); 
-
-    std::vector<std::string> part1_keypad = {
-        "123",
-        "456",
-        "789"
-    };
-
-    std::vector<std::string> part2_keypad = {
-        "..1..",
-        ".234.",
-        "56789",
-        ".ABC.",
-        "..D.."
-    };
-
-    std::println("--- Day 2: {} ---", title);
-    std::println("  part 1: {}", find_code(part1_keypad, inp) );
-    std::println("  part 2: {}", find_code(part2_keypad, inp) );
-    
+aoc::solver_ptr aoc::y2016::day_02() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(
+                    aoc::input_path(2016, 2)
+                );
+            std::vector<std::string> part1_keypad = {
+                "123",
+                "456",
+                "789"
+            };
+            std::vector<std::string> part2_keypad = {
+                "..1..",
+                ".234.",
+                "56789",
+                ".ABC.",
+                "..D.."
+            };
+            return std::tuple{ std::move(inp), std::move(part1_keypad), std::move(part2_keypad) };
+        },
+        [](const auto& parsed) {
+            const auto& [inp, part1_keypad, part2_keypad] = parsed;
+            return find_code(part1_keypad, inp);
+        },
+        [](const auto& parsed) {
+            const auto& [inp, part1_keypad, part2_keypad] = parsed;
+            return find_code(part2_keypad, inp);
+        }
+    );
 }
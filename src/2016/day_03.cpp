@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -42,20 +41,26 @@ namespace {
     }
 }
 
-void aoc::y2016::day_03(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-        aoc::input_path(2016, 3)
-    ) | rv::transform(
-        [](auto&& str) {
-            return aoc::extract_numbers(str);
+aoc::solver_ptr aoc::y2016::day_03() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(
+                aoc::input_path(2016, 3)
+            ) | rv::transform(
+                [](auto&& str) {
+                    return aoc::extract_numbers(str);
+                }
+            ) | r::to<std::vector>();
+            auto part2_inp = vertical_groups_of_3(inp);
+            return std::tuple{ std::move(inp), std::move(part2_inp) };
+        },
+        [](const auto& parsed) {
+            const auto& [inp, part2_inp] = parsed;
+            return r::count_if(inp, is_triangle);
+        },
+        [](const auto& parsed) {
+            const auto& [inp, part2_inp] = parsed;
+            return r::count_if(part2_inp, is_triangle);
         }
-    ) | r::to<std::vector>();
-
-    auto part2_inp = vertical_groups_of_3(inp);
-
-    std::println("--- Day 3: {} ---", title);
-    std::println("  part 1: {}", r::count_if(inp, is_triangle) );
-    std::println("  part 2: {}", r::count_if(part2_inp, is_triangle));
-    
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -83,28 +82,31 @@ namespace {
     }
 }
 
-void aoc::y2016::day_04(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 4)
-        ) | rv::transform(
-            parse_room
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}",
-        r::fold_left(
-            inp | rv::transform(
-                [](auto&& room) {
-                    if (is_real_room(room)) {
-                        return room.sector_id;
+aoc::solver_ptr aoc::y2016::day_04() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2016, 4)
+                ) | rv::transform(
+                    parse_room
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return r::fold_left(
+                inp | rv::transform(
+                    [](auto&& room) {
+                        if (is_real_room(room)) {
+                            return room.sector_id;
+                        }
+                        return 0;
                     }
-                    return 0;
-                }
-            ),
-            0,
-            std::plus<>()
-        )
+                ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& inp) {
+            return find_northpole_storage_room(inp);
+        }
     );
-    std::println("  part 2: {}", find_northpole_storage_room(inp));
 }
@@ -1,9 +1,8 @@
 #include "../util/util.h"
-#include "../2015/md5.h"
+#include "../2015/md5_multi.h"
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -13,59 +12,53 @@ namespace rv = std::ranges::views;
 /*------------------------------------------------------------------------------------------------*/
 
 namespace {
-    std::string find_password(const std::string& door_id) {
-
-        std::stringstream output;
-        uint64_t key_num = 0;
-        int pwd_char_count = 0;
+    char hex_char(int digit) {
+        return "0123456789abcdef"[digit];
+    }
 
-        while (pwd_char_count < 8) {
-            std::string key = door_id + std::to_string(key_num++);
-            auto hash = md5(key);
-            if (hash.substr(0, 5) == "00000") {
-                output << hash[5];
-                ++pwd_char_count;
+    std::string find_password(const std::string& door_id) {
+        std::string pwd;
+        aoc::md5_find_zero_prefixes(door_id, 5, 0,
+            [&](uint64_t, const aoc::md5_digest& hash) {
+                pwd.push_back(hex_char(aoc::md5_hex_digit(hash, 5)));
+                return pwd.size() < 8;
             }
-        }
-
-        return output.str();
+        );
+        return pwd;
     }
 
     std::string find_password_with_positions(const std::string& door_id) {
 
-        uint64_t key_num = 0;
         int pwd_char_count = 0;
         std::array<char, 8> pwd = { {0,0,0,0,0,0,0,0} };
 
-        while (pwd_char_count < 8) {
-            std::string key = door_id + std::to_string(key_num++);
-            auto hash = md5(key);
-            if (hash.substr(0, 5) == "00000") {
-                auto pos_char = hash[5];
-                if (pos_char < '0' || pos_char > '7') {
-                    continue;
+        aoc::md5_find_zero_prefixes(door_id, 5, 0,
+            [&](uint64_t, const aoc::md5_digest& hash) {
+                auto pos = aoc::md5_hex_digit(hash, 5);
+                if (pos < 8 && pwd[pos] == 0) {
+                    pwd[pos] = hex_char(aoc::md5_hex_digit(hash, 6));
+                    ++pwd_char_count;
                 }
-                int pos = pos_char - '0';
-                if (pwd[pos] != 0) {
-                    continue;
-                }
-                pwd[pos] = hash[6];
-                pwd_char_count++;
+                return pwd_char_count < 8;
             }
-        }
+        );
 
         return pwd | r::to<std::string>();
     }
 }
 
-void aoc::y2016::day_05(const std::string& title) {
-
-    auto door_id = aoc::file_to_string(
-        aoc::input_path(2016, 5)
+aoc::solver_ptr aoc::y2016::day_05() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(
+                aoc::input_path(2016, 5)
+            );
+        },
+        [](const auto& door_id) {
+            return find_password(door_id);
+        },
+        [](const auto& door_id) {
+            return find_password_with_positions(door_id);
+        }
     );
-
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}", find_password(door_id));
-    std::println("  part 2: {}", find_password_with_positions(door_id));
-
 }
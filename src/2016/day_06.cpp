@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -47,14 +46,18 @@ namespace {
     }
 }
 
-void aoc::y2016::day_06(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 6)
-        ); 
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}", decode(inp, true) );
-    std::println("  part 2: {}", decode(inp, false) );
-    
+aoc::solver_ptr aoc::y2016::day_06() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2016, 6)
+                );
+        },
+        [](const auto& inp) {
+            return decode(inp, true);
+        },
+        [](const auto& inp) {
+            return decode(inp, false);
+        }
+    );
 }
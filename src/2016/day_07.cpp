@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -72,16 +71,20 @@ namespace {
     }
 }
 
-void aoc::y2016::day_07(const std::string& title) {
-
-        auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 7)
-        ) | rv::transform(
-            aoc::extract_alphabetic
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 7: {} ---", title);
-    std::println( "  part 1: {}", r::count_if(inp, supports_tls) );
-    std::println( "  part 2: {}", r::count_if(inp, supports_ssl) );
-    
+aoc::solver_ptr aoc::y2016::day_07() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                aoc::input_path(2016, 7)
+            ) | rv::transform(
+                aoc::extract_alphabetic
+            ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return r::count_if(inp, supports_tls);
+        },
+        [](const auto& inp) {
+            return r::count_if(inp, supports_ssl);
+        }
+    );
 }
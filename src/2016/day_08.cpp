@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -126,28 +125,29 @@ namespace {
         );
     }
 
-    void do_part_2(const std::vector<command>& cmds, int wd, int hgt) {
+    std::string do_part_2(const std::vector<command>& cmds, int wd, int hgt) {
         auto screen = make_screen(wd, hgt);
         for (const auto& cmd : cmds) {
             do_command(screen, cmd);
         }
-        for (const auto& row : screen) {
-            std::println("{}", row);
-        }
+        return screen | rv::join_with('\n') | r::to<std::string>();
     }
 }
 
-void aoc::y2016::day_08(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 8)
-        ) | rv::transform(
-            parse_command
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp, 50, 6));
-    std::println("  part 2:");
-    do_part_2(inp, 50, 6);
-    
+aoc::solver_ptr aoc::y2016::day_08() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2016, 8)
+                ) | rv::transform(
+                    parse_command
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return do_part_1(inp, 50, 6);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp, 50, 6);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -107,16 +106,20 @@ namespace {
     }
 }
 
-void aoc::y2016::day_09(const std::string& title) {
-
-    auto inp = aoc::trim(
-        aoc::file_to_string(
-            aoc::input_path(2016, 9)
-        )
+aoc::solver_ptr aoc::y2016::day_09() {
+    return aoc::make_solver(
+        []() {
+            return aoc::trim(
+                aoc::file_to_string(
+                    aoc::input_path(2016, 9)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return size_expanded(inp, false);
+        },
+        [](const auto& inp) {
+            return size_expanded(inp, true);
+        }
     );
-
-    std::println("--- Day 9: {} ---", title);
-    std::println("  part 1: {}", size_expanded(inp, false) );
-    std::println("  part 2: {}", size_expanded(inp, true));
-    
 }
@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -143,16 +142,22 @@ namespace {
     }
 }
 
-void aoc::y2016::day_10(const std::string& title) {
-
-    auto [init, instrs] = parse(
-        aoc::file_to_string_vector(
-            aoc::input_path(2016, 10)
-        )
+aoc::solver_ptr aoc::y2016::day_10() {
+    return aoc::make_solver(
+        []() {
+            return parse(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2016, 10)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [init, instrs] = inp;
+            return do_part_1(init, instrs);
+        },
+        [](const auto& inp) {
+            const auto& [init, instrs] = inp;
+            return do_part_2(init, instrs);
+        }
     );
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1: {}", do_part_1(init, instrs) );
-    std::println("  part 2: {}", do_part_2(init, instrs) );
-    
 }
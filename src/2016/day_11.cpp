@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <queue>
@@ -257,18 +256,22 @@ namespace {
 
 }
 
-void aoc::y2016::day_11(const std::string& title) {
-
-    auto start_state = state(
-        parse_input(
-            aoc::file_to_string_vector(
-                aoc::input_path(2016, 11)
-            )
-        )
+aoc::solver_ptr aoc::y2016::day_11() {
+    return aoc::make_solver(
+        []() {
+            return state(
+                parse_input(
+                    aoc::file_to_string_vector(
+                        aoc::input_path(2016, 11)
+                    )
+                )
+            );
+        },
+        [](const auto& start_state) {
+            return minimum_moves(start_state);
+        },
+        [](const auto& start_state) {
+            return minimum_moves(make_part2_input(start_state));
+        }
     );
-
-    std::println("--- Day 11: {} ---", title);
-    std::println("  part 1: {}", minimum_moves(start_state));
-    std::println("  part 2: {}", minimum_moves(make_part2_input(start_state)));
-    
 }
@@ -1,13 +1,12 @@
 
 #include "../util/util.h"
 #include "../util/vec2.h"
+#include "../util/graph_search.h"
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
-#include <queue>
 #include <format>
 
 namespace r = std::ranges;
@@ -17,7 +16,6 @@ namespace rv = std::ranges::views;
 
 namespace {
     using point = aoc::vec2<int>;
-    using point_set = aoc::vec2_set<int>;
 
     int hamming_weight(int val) {
         int count = 0;
@@ -35,101 +33,76 @@ namespace {
         return hamming_weight(val) % 2 == 0;
     }
 
-    enum visit_result {
-        continue_traversal,
-        terminate_branch,
-        terminate_traversal
-    };
+    const point k_start = { 1,1 };
 
-    using visit_fn = std::function<visit_result(const point&, int)>;
-
-    point_set bfs(int magic_number, const visit_fn& visit) {
-        point_set visited;
-        point_set walls;
-        point_set floor;
-
-        std::queue<std::tuple<point, int>> queue;
+    // the open locations next to loc, none of which has a negative coordinate.
+    auto open_neighbors(int magic_number, const point& loc) {
         const static std::array<point, 4> deltas = { {
             {0,-1},{1,0},{0,1},{-1,0}
         } };
-
-        queue.emplace(point{ 1,1 }, 0);
-        while (!queue.empty()) {
-            auto [loc, dist] = queue.front();
-            queue.pop();
-
-            if (visited.contains(loc)) {
-                continue;
+        return deltas | rv::transform(
+            [loc](auto&& d) {
+                return d + loc;
             }
-
-            auto result = visit(loc, dist);
-            visited.insert(loc);
-
-            if (result == terminate_traversal) {
-                return visited;
-            } else if (result == terminate_branch) {
-                continue;
+        ) | rv::filter(
+            [magic_number](auto&& adj) {
+                return adj.x >= 0 && adj.y >= 0 && is_empty_location(magic_number, adj);
             }
-
-            for (auto adj : deltas | rv::transform([&](auto&& d) {return d + loc; })) {
-                if (adj.x < 0 || adj.y < 0) {
-                    continue;
-                }
-                if (!floor.contains(adj) && !walls.contains(adj)) {
-                    auto is_floor = is_empty_location(magic_number, adj);
-                    if (is_floor) {
-                        floor.insert(adj);
-                    }
-                    else {
-                        walls.insert(adj);
-                    }
-                }
-                if (floor.contains(adj)) {
-                    queue.emplace(adj, dist + 1);
-                }
-            }
-        }
-        return visited;
+        );
     }
 
     int shortest_path(int magic_number, const point& dest) {
-        int shortest_path_len = -1;
-        bfs(magic_number,
-            [&](const point& loc, int dist)->visit_result {
-                if (loc == dest) {
-                    shortest_path_len = dist;
-                    return terminate_traversal;
-                }
-                return continue_traversal;
+        auto result = aoc::breadth_first_search(
+            k_start,
+            [magic_number](const point& loc) {
+                return open_neighbors(magic_number, loc);
+            },
+            [&dest](const point& loc) {
+                return loc == dest;
             }
         );
-        return shortest_path_len;
+        return result.goal_distance().value_or(-1);
     }
 
+    // a location max_dist steps away lies within that Manhattan distance of the
+    // start, so the search is kept to that diamond and then counts the locations
+    // it reached in at most max_dist steps.
     int reachable_locations(int magic_number, int max_dist) {
-        auto visited = bfs(
-            magic_number,
-            [max_dist](const point& loc, int dist)->visit_result {
-                if (dist == max_dist) {
-                    return terminate_branch;
-                }
-                return continue_traversal;
+        auto result = aoc::breadth_first_search(
+            k_start,
+            [magic_number, max_dist](const point& loc) {
+                return open_neighbors(magic_number, loc) | rv::filter(
+                    [max_dist](auto&& adj) {
+                        return std::abs(adj.x - k_start.x) + std::abs(adj.y - k_start.y) <= max_dist;
+                    }
+                );
             }
         );
-        return static_cast<int>( visited.size() );
+        return static_cast<int>(
+            r::count_if(
+                result.visited(),
+                [&](const point& loc) {
+                    return *result.distance(loc) <= max_dist;
+                }
+            )
+        );
     }
 }
 
-void aoc::y2016::day_13(const std::string& title) {
-
-    auto magic = std::stoi(
-        aoc::file_to_string(
-            aoc::input_path(2016, 13)
-        )
+aoc::solver_ptr aoc::y2016::day_13() {
+    return aoc::make_solver(
+        []() {
+            return std::stoi(
+                aoc::file_to_string(
+                    aoc::input_path(2016, 13)
+                )
+            );
+        },
+        [](const auto& magic) {
+            return shortest_path(magic, { 31,39 });
+        },
+        [](const auto& magic) {
+            return reachable_locations(magic, 50);
+        }
     );
-
-    std::println("--- Day 13: {} ---", title);
-    std::println("  part 1: {}", shortest_path(magic, { 31,39 }));
-    std::println("  part 2: {}", reachable_locations(magic, 50));
-    
 }
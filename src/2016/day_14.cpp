@@ -1,13 +1,11 @@
-
 #include "../util/util.h"
-#include "../2015/md5.h"
+#include "../util/thread_pool.h"
+#include "../2015/md5_multi.h"
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
-#include <unordered_map>
-#include <optional>
+#include <vector>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -16,108 +14,139 @@ namespace rv = std::ranges::views;
 
 namespace {
 
-    std::optional<char> first_tripled_char(const std::string& str) {
-        auto adjacent_view = str | rv::adjacent<3>;
-
-        auto triplet = r::find_if(
-            adjacent_view,
-            [](const auto& triplet) {
-                auto [a, b, c] = triplet;
-                return a == b && b == c;
+    // a key's triple must be followed by a quintuple within this many hashes.
+    constexpr int k_window = 1000;
+
+    // the hashes computed at a time, split between the threads, and the size of
+    // the ring holding them, which must leave room for a batch beyond the window.
+    constexpr int k_batch_size = 2048;
+    constexpr int k_ring_size = 4096;
+    static_assert(k_window + 1 + k_batch_size <= k_ring_size);
+
+    constexpr int k_stretching_rounds = 2016;
+
+    // what the search needs to know about a hash: the hex digit of its first
+    // run of three, or -1 if it has none, and a mask of the digits that run five
+    // times.
+    struct hash_features {
+        int triple;
+        uint16_t quintuples;
+    };
+
+    hash_features features_of(const aoc::md5_digest& digest) {
+        hash_features features = { -1, 0 };
+        int prev = -1;
+        int run = 0;
+        for (int i = 0; i < 32; ++i) {
+            auto digit = aoc::md5_hex_digit(digest, i);
+            run = (digit == prev) ? run + 1 : 1;
+            prev = digit;
+            if (run == 3 && features.triple < 0) {
+                features.triple = digit;
             }
-        );
-
-        // Check if a triplet was found
-        if (triplet != r::end(adjacent_view)) {
-            return std::get<0>(*triplet);
-        }
-
-        return std::nullopt;
-
-    }
-
-    bool contains_quintuple(const std::string& str, char ch) {
-
-        auto adjacent_view = str | rv::adjacent<5>;
-
-        auto quintuple = r::find_if(
-            adjacent_view,
-            [ch](const auto& quint) {
-                auto [a, b, c, d, e] = quint;
-                return a == ch && b == ch && c == ch &&
-                    d == ch && e == ch;
+            if (run == 5) {
+                features.quintuples |= 1 << digit;
             }
-        );
-
-        return (quintuple != r::end(adjacent_view));
-    }
-
-    std::string generate_hash_no_stretching(const std::string& str) {
-        static std::unordered_map<std::string, std::string> memos;
-        if (!memos.contains(str)) {
-            return memos[str] = md5(str);
         }
-        return memos.at(str);
+        return features;
     }
 
-    std::string generate_hash(const std::string& str, bool use_stretching) {
-        if (!use_stretching) {
-            return generate_hash_no_stretching(str);
-        }
-        static std::unordered_map<std::string, std::string> memos;
-        if (memos.contains(str)) {
-            return memos.at(str);
+    // the features of the hashes of the salt followed by each index in turn,
+    // computed a batch at a time across the shared thread pool into a ring, so that memory
+    // use does not grow with the index. Indices must be read in increasing order
+    // and no more than the window apart.
+    class hash_stream {
+    public:
+        hash_stream(const std::string& salt, int stretching_rounds) :
+            salt_(salt),
+            stretching_rounds_(stretching_rounds),
+            pool_(aoc::shared_thread_pool()),
+            ring_(k_ring_size),
+            computed_(0) {
         }
-        auto hash = generate_hash_no_stretching(str);
-        for (int i = 0; i < 2016; ++i) {
-            hash = md5(hash);
+
+        const hash_features& operator[](int index) {
+            while (index >= computed_) {
+                compute_batch();
+            }
+            return ring_[index % k_ring_size];
         }
-        memos[str] = hash;
-        return hash;
-    }
 
-    bool is_key(const std::string& salt, int index, char ch, bool use_stretching) {
-        for (int i = index + 1; i <= index + 1000; ++i) {
-            auto hash = generate_hash(salt + std::to_string(i), use_stretching);
-            if (contains_quintuple(hash, ch)) {
-                return true;
+    private:
+        std::string salt_;
+        int stretching_rounds_;
+        aoc::thread_pool& pool_;
+        std::vector<hash_features> ring_;
+        int computed_;
+
+        void compute_batch() {
+            auto num_chunks = pool_.size();
+            aoc::thread_pool::task_group batch;
+            for (int chunk = 0; chunk < num_chunks; ++chunk) {
+                auto first = computed_ + chunk * k_batch_size / num_chunks;
+                auto last = computed_ + (chunk + 1) * k_batch_size / num_chunks;
+                pool_.submit(batch,
+                    [this, first, last]() {
+                        std::vector<std::string> messages;
+                        for (auto index = first; index < last; ++index) {
+                            messages.push_back(salt_ + std::to_string(index));
+                        }
+                        std::vector<std::string_view> views(messages.begin(), messages.end());
+                        std::vector<aoc::md5_digest> digests(messages.size());
+                        aoc::md5_many(views, digests);
+                        aoc::md5_stretch(digests, stretching_rounds_);
+                        for (auto index = first; index < last; ++index) {
+                            ring_[index % k_ring_size] = features_of(digests[index - first]);
+                        }
+                    }
+                );
             }
+            pool_.wait(batch);
+            computed_ += k_batch_size;
         }
-        return false;
-    }
+    };
 
+    // slides the window along the hashes, keeping a count of the quintuples of
+    // each digit in it, so whether a triple is a key is a single lookup.
     int index_of_nth_one_time_pad_key(const std::string& salt, int n, bool use_stretching) {
-        int index = 0;
-        for (int i = 0; i < n; ++i) {
-            bool key = false;
-            do {
-                auto hash = generate_hash(
-                    salt + std::to_string(index),
-                    use_stretching
-                );
-                auto tri = first_tripled_char(hash);
-                if (!tri) {
-                    ++index;
-                    continue;
+        hash_stream hashes(salt, use_stretching ? k_stretching_rounds : 0);
+        std::array<int, 16> quintuple_counts = {};
+        auto count_quintuples = [&](int index, int delta) {
+            auto quintuples = hashes[index].quintuples;
+            for (int digit = 0; digit < 16; ++digit) {
+                if (quintuples & (1 << digit)) {
+                    quintuple_counts[digit] += delta;
                 }
-                key = is_key(salt, index, *tri, use_stretching);
-                ++index;
-            } while (!key);
+            }
+        };
+
+        for (int index = 1; index <= k_window; ++index) {
+            count_quintuples(index, 1);
+        }
+        int keys = 0;
+        for (int index = 0; ; ++index) {
+            auto triple = hashes[index].triple;
+            if (triple >= 0 && quintuple_counts[triple] > 0 && ++keys == n) {
+                return index;
+            }
+            count_quintuples(index + 1, -1);
+            count_quintuples(index + k_window + 1, 1);
         }
-        return index-1;
     }
 }
 
-void aoc::y2016::day_14(const std::string& title) {
-
-    auto inp = aoc::file_to_string(
-            aoc::input_path(2016, 14)
-        ); 
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}", 
-        index_of_nth_one_time_pad_key(inp, 64, false));
-    std::println("  part 2: {}",
-        index_of_nth_one_time_pad_key(inp, 64, true));
-    
+aoc::solver_ptr aoc::y2016::day_14() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(
+                    aoc::input_path(2016, 14)
+                );
+        },
+        [](const auto& inp) {
+            return index_of_nth_one_time_pad_key(inp, 64, false);
+        },
+        [](const auto& inp) {
+            return index_of_nth_one_time_pad_key(inp, 64, true);
+        }
+    );
 }
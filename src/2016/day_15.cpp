@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -49,22 +48,25 @@ namespace {
     }
 }
 
-void aoc::y2016::day_15(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-        aoc::input_path(2016, 15)
-    ) | rv::transform(
-        parse_disc
-    ) | r::to<std::vector>();
-
-    std::println("--- Day 15: {} ---", title);
-    std::println("  part 1: {}", brute_force(inp) );
-
-    inp.emplace_back(
-        inp.back().index + 1,
-        11,
-        0
+aoc::solver_ptr aoc::y2016::day_15() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                aoc::input_path(2016, 15)
+            ) | rv::transform(
+                parse_disc
+            ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return brute_force(inp);
+        },
+        [](auto inp) {
+            inp.emplace_back(
+                inp.back().index + 1,
+                11,
+                0
+            );
+            return brute_force(inp);
+        }
     );
-    std::println("  part 2: {}", brute_force(inp) );
-    
 }
@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -54,14 +53,18 @@ namespace {
     }
 }
 
-void aoc::y2016::day_16(const std::string& title) {
-
-    auto inp = aoc::file_to_string(
-            aoc::input_path(2016, 16)
-        ); 
-
-    std::println("--- Day 16: {} ---", title);
-    std::println("  part 1: {}", brute_force_checksum(inp, 272));
-    std::println("  part 2: {}", brute_force_checksum(inp, 35651584));
-    
+aoc::solver_ptr aoc::y2016::day_16() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(
+                    aoc::input_path(2016, 16)
+                );
+        },
+        [](const auto& inp) {
+            return brute_force_checksum(inp, 272);
+        },
+        [](const auto& inp) {
+            return brute_force_checksum(inp, 35651584);
+        }
+    );
 }
@@ -1,11 +1,10 @@
 
 #include "../util/util.h"
 #include "../util/vec2.h"
-#include "../2015/md5.h"
+#include "../2015/md5_multi.h"
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <queue>
@@ -49,18 +48,17 @@ namespace {
         std::string path;
     };
 
-    bool is_open_char(char ch) {
-        return ch >= 'b' && ch <= 'f';
+    // a door is open if its hex digit of the hash is b, c, d, e or f.
+    bool is_open_digit(int digit) {
+        return digit >= 0xb;
     }
 
     auto next_states(const state& s, const vault& vault) {
         static const std::array<char, 4> directions = { 'U','D','L','R' };
-        return rv::zip(
-                md5(vault.passcode + s.path) | rv::take(4), directions
-            ) | rv::transform(
-                [&](auto&& pair)->char {
-                    const auto& [hash_code, dir] = pair;
-                    return (is_open_char(hash_code)) ? dir : ' ';
+        auto hash = aoc::md5_digest_of(vault.passcode + s.path);
+        return rv::iota(0, 4) | rv::transform(
+                [hash](int i)->char {
+                    return (is_open_digit(aoc::md5_hex_digit(hash, i))) ? directions[i] : ' ';
                 }
             ) | rv::filter(
                 [](char ch) {return ch != ' '; }
@@ -116,19 +114,23 @@ namespace {
     }
 }
 
-void aoc::y2016::day_17(const std::string& title) {
-
-    auto vault = ::vault{
-        aoc::file_to_string(
-            aoc::input_path(2016, 17)
-        ),
-        {0,0},
-        {3,3},
-        {4,4}
-    };
-
-    std::println("--- Day 17: {} ---", title);
-    std::println("  part 1: {}", shortest_path(vault) );
-    std::println("  part 2: {}", longest_path(vault) );
-    
+aoc::solver_ptr aoc::y2016::day_17() {
+    return aoc::make_solver(
+        []() {
+            return ::vault{
+                aoc::file_to_string(
+                    aoc::input_path(2016, 17)
+                ),
+                {0,0},
+                {3,3},
+                {4,4}
+            };
+        },
+        [](const auto& vault) {
+            return shortest_path(vault);
+        },
+        [](const auto& vault) {
+            return longest_path(vault);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <format>
 #include <unordered_set>
@@ -62,16 +61,20 @@ namespace {
     }
 }
 
-void aoc::y2016::day_18(const std::string& title) {
-
-    auto inp = trim(
-        aoc::file_to_string(
-            aoc::input_path(2016, 18)
-        )
+aoc::solver_ptr aoc::y2016::day_18() {
+    return aoc::make_solver(
+        []() {
+            return trim(
+                aoc::file_to_string(
+                    aoc::input_path(2016, 18)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return count_safe_tiles( inp , 40);
+        },
+        [](const auto& inp) {
+            return count_safe_tiles( inp, 400000 );
+        }
     );
-
-    std::println("--- Day 18: {} ---", title);
-    std::println("  part 1: {}", count_safe_tiles( inp , 40) );
-    std::println("  part 2: {}", count_safe_tiles( inp, 400000 ));
-    
 }
@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -39,16 +38,20 @@ namespace {
     }
 }
 
-void aoc::y2016::day_19(const std::string& title) {
-
-    auto inp = std::stoi(
-        aoc::file_to_string(
-            aoc::input_path(2016, 19)
-        )
+aoc::solver_ptr aoc::y2016::day_19() {
+    return aoc::make_solver(
+        []() {
+            return std::stoi(
+                aoc::file_to_string(
+                    aoc::input_path(2016, 19)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return josephus(inp);
+        },
+        [](const auto& inp) {
+            return n_cowboy_shootout(inp);
+        }
     );
-
-    std::println("--- Day 19: {} ---", title);
-    std::println("  part 1: {}", josephus(inp) );
-    std::println("  part 2: {}", n_cowboy_shootout(inp) );
-    
 }
@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/icl/interval_set.hpp>
@@ -72,17 +71,22 @@ namespace {
     }
 }
 
-void aoc::y2016::day_20(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 20)
-        ) | rv::transform(
-            [](auto&& str) {
-                return parse_interval(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 20: {} ---", title);
-    std::println("  part 1: {}", lowest_number_not_in_intervals(inp) );
-    std::println("  part 2: {}", size_of_complement(inp) );
+aoc::solver_ptr aoc::y2016::day_20() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2016, 20)
+                ) | rv::transform(
+                    [](auto&& str) {
+                        return parse_interval(str);
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return lowest_number_not_in_intervals(inp);
+        },
+        [](const auto& inp) {
+            return size_of_complement(inp);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -270,16 +269,20 @@ namespace {
     }
 }
 
-void aoc::y2016::day_21(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 21)
-        ) | rv::transform(
-            parse_command
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 21: {} ---", title);
-    std::println("  part 1: {}", scramble(inp, "abcdefgh"));
-    std::println("  part 2: {}", descramble(inp, "fbgdceah"));
-    
+aoc::solver_ptr aoc::y2016::day_21() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2016, 21)
+                ) | rv::transform(
+                    parse_command
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return scramble(inp, "abcdefgh");
+        },
+        [](const auto& inp) {
+            return descramble(inp, "fbgdceah");
+        }
+    );
 }
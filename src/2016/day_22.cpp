@@ -1,13 +1,13 @@
 
 #include "../util/util.h"
 #include "../util/vec2.h"
+#include "../util/graph_search.h"
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
 #include <print>
 #include <ranges>
 #include <unordered_set>
-#include <queue>
 #include <boost/functional/hash.hpp>
 
 namespace r = std::ranges;
@@ -130,8 +130,6 @@ namespace {
         }
     };
 
-    using state_set = std::unordered_set<state, hash_state>;
-
     bool in_bounds(const point& loc, const dimensions& bounds) {
         return loc.x >= 0 && loc.y >= 0 && loc.x < bounds.wd && loc.y < bounds.hgt;
     }
@@ -163,45 +161,46 @@ namespace {
             ) | r::to<std::vector>();
     }
 
+    // a state is the pair of the hole's and the goal data's locations, indexed
+    // densely as one location of the grid after the other.
     int fewest_steps(const grid_info& grid) {
-        const auto& walls = grid.walls;
         const auto& bounds = grid.bounds;
-        state_set visited;
-        std::queue<std::tuple<state, int>> queue;
-
-        queue.emplace( state{ grid.hole, grid.goal }, 0);
-        while (!queue.empty()) {
-            auto [curr_state, dist] = queue.front();
-            queue.pop();
-
-            if (visited.contains(curr_state)) {
-                continue;
-            }
-            visited.insert(curr_state);
-
-            if (curr_state.goal == point{0, 0}) {
-                return dist;
-            }
-
-            for (const auto& next_state : next_states(curr_state, walls, bounds)) {
-                queue.emplace(next_state, dist + 1);
-            }
-        }
-
-        return -1;
+        auto num_cells = static_cast<size_t>(bounds.wd) * static_cast<size_t>(bounds.hgt);
+        auto cell = [&bounds](const point& loc) {
+            return static_cast<size_t>(loc.y) * bounds.wd + static_cast<size_t>(loc.x);
+        };
+        auto result = aoc::breadth_first_search(
+            state{ grid.hole, grid.goal },
+            [&](const state& s) {
+                return next_states(s, grid.walls, bounds);
+            },
+            [](const state& s) {
+                return s.goal == point{ 0, 0 };
+            },
+            aoc::indexed_by<state, hash_state>(num_cells * num_cells,
+                [=](const state& s) {
+                    return cell(s.hole) * num_cells + cell(s.goal);
+                }
+            )
+        );
+        return result.goal_distance().value_or(-1);
     }
 }
 
-void aoc::y2016::day_22(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 22)
-        ) | rv::drop(2) | rv::transform(
-            parse_node
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 22: {} ---", title);
-    std::println("  part 1: {}", count_viable_pairs(inp) );
-    std::println("  part 2: {}", fewest_steps( build_grid(inp)));
-    
+aoc::solver_ptr aoc::y2016::day_22() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2016, 22)
+                ) | rv::drop(2) | rv::transform(
+                    parse_node
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return count_viable_pairs(inp);
+        },
+        [](const auto& inp) {
+            return fewest_steps( build_grid(inp));
+        }
+    );
 }
@@ -2,13 +2,12 @@
 #include "../util/util.h"
 #include "../util/vec2.h"
 #include "../util/concat.h"
+#include "../util/graph_search.h"
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
-#include <queue>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -19,39 +18,40 @@ namespace {
 
     using matrix = std::vector<std::vector<int>>;
     using point = aoc::vec2<int>;
-    using point_set = aoc::vec2_set<int>;
 
     size_t matrix_size(const std::vector<std::string>& grid) {
         auto str = grid | rv::join | r::to<std::string>();
         return static_cast<size_t>(r::max(aoc::extract_numbers(str))) + 1;
     }
 
+    // fills the row of the matrix for the digit at start with the distances to
+    // every digit it can reach.
     void populate_matrix(matrix& mat, const point& start, const std::vector<std::string>& grid) {
         auto u = grid[start.y][start.x] - '0';
-        point_set visited;
-        std::queue<std::tuple<point, int>> queue;
-        queue.emplace(start, 0);
-        while (!queue.empty()) {
-            auto [loc, dist] = queue.front();
-            queue.pop();
-
-            if (visited.contains(loc)) {
-                continue;
-            }
-            visited.insert(loc);
+        auto wd = static_cast<int>(grid.front().size());
+        auto hgt = static_cast<int>(grid.size());
+        auto result = aoc::breadth_first_search(
+            start,
+            [&](const point& loc) {
+                const static std::array<point, 4> deltas = {{ {0,-1},{1,0},{0,1},{-1,0} }};
+                return deltas | rv::transform(
+                    [loc](auto&& delta) {
+                        return loc + delta;
+                    }
+                ) | rv::filter(
+                    [&](auto&& next_loc) {
+                        return grid[next_loc.y][next_loc.x] != '#';
+                    }
+                );
+            },
+            aoc::no_goal{},
+            aoc::grid_states(wd, hgt)
+        );
 
+        for (const auto& loc : result.visited()) {
             auto tile = grid[loc.y][loc.x];
             if (std::isdigit(tile)) {
-                mat[u][tile - '0'] = dist;
-            }
-
-            const static std::array<point, 4> deltas = {{ {0,-1},{1,0},{0,1},{-1,0} }};
-            for (const auto& delta : deltas) {
-                auto next_loc = loc + delta;
-                if (grid[next_loc.y][next_loc.x] == '#') {
-                    continue;
-                }
-                queue.emplace(next_loc, dist + 1);
+                mat[u][tile - '0'] = *result.distance(loc);
             }
         }
     }
@@ -124,14 +124,18 @@ namespace {
     }
 }
 
-void aoc::y2016::day_24(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2016, 24)
-        ); 
-
-    std::println("--- Day 24: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp) );
-    std::println("  part 2: {}", do_part_2(inp) );
-    
+aoc::solver_ptr aoc::y2016::day_24() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2016, 24)
+                );
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
+    );
 }
@@ -1,12 +1,9 @@
-
 #include "../util/util.h"
+#include "assembunny.h"
 #include "y2016.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
-#include <unordered_set>
-#include <variant>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -15,63 +12,57 @@ namespace rv = std::ranges::views;
 
 namespace {
 
-    bool test(int64_t a) {
+    // the number of outputs taken to show that a clock signal repeats forever.
+    constexpr int k_signal_length = 100;
 
-        int out_index = 0;
+    // stops the machine once its output has strayed from 0, 1, 0, 1, ... or has
+    // kept to it for long enough.
+    struct clock_signal_handler : aoc::vm_handler {
+        int num_outputs = 0;
+        bool is_clock_signal = true;
 
-        int64_t b = 0;
-        int64_t c = 0;
-        int64_t d = 0;
+        bool before(int64_t ip, const aoc::vm_registers& regs) {
+            return is_clock_signal && num_outputs < k_signal_length;
+        }
 
-        d = a;
-        c = 9;
-    line_2: b = 282;
-    line_1: ++d;
-        --b;
-        if (b != 0) goto line_1;
-        --c;
-        if (c != 0) goto line_2;
-    line_11: a = d;
-    line_10: std::print("");
-        b = a;
-        a = 0;
-    line_6: c = 2;
-    line_5: if (b != 0) goto line_3;
-        goto line_4;
-    line_3: --b;
-        --c;
-        if (c != 0) goto line_5;
-        ++a;
-        goto line_6;
-    line_4: b = 2;
-    line_9: if (c != 0) goto line_7;
-        goto line_8;
-    line_7: --b;
-        --c;
-        goto line_9;
-    line_8: std::print("");
-        if (out_index % 2 == b) {
-            out_index++;
-            if (out_index > 100) {
-                return true;
-            }
-        } else {
-            return false;
+        void output(int64_t value) {
+            is_clock_signal = (value == num_outputs % 2);
+            ++num_outputs;
         }
-        if (a != 0) goto line_10;
-        goto line_11;
+    };
+
+    bool generates_clock_signal(const aoc::vm_program& program, int64_t a) {
+        aoc::vm_machine machine(program);
+        machine.reg('a') = a;
+        clock_signal_handler handler;
+        machine.run(handler);
+        return handler.is_clock_signal && handler.num_outputs == k_signal_length;
     }
 
-    int do_part_1() {
-        return *r::find_if(rv::iota(0), test);
+    int do_part_1(const aoc::vm_program& program) {
+        return *r::find_if(
+            rv::iota(0),
+            [&](int a) {
+                return generates_clock_signal(program, a);
+            }
+        );
     }
 }
 
-
-void aoc::y2016::day_25(const std::string& title) {
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}", do_part_1());
-    std::println("  part 2: {}", "<xmas freebie>");
-    
+aoc::solver_ptr aoc::y2016::day_25() {
+    return aoc::make_solver(
+        []() {
+            return aoc::assemble_assembunny(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2016, 25)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto&) {
+            return "<xmas freebie>";
+        }
+    );
 }
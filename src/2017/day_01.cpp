@@ -4,7 +4,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -28,18 +27,22 @@ namespace {
     }
 }
 
-void aoc::y2017::day_01(const std::string& title) {
-    
-    auto inp = aoc::file_to_string(
-            aoc::input_path(2017, 1)
-        ) | rv::transform(
-            [](char ch)->int {
-                return ch - '0';
-            }
-        ) | r::to<std::vector>();
-    
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}", sum_of_digits_matching_next_digit(inp, 1));
-    std::println("  part 2: {}", sum_of_digits_matching_next_digit(inp, inp.size()/2));
-    
+aoc::solver_ptr aoc::y2017::day_01() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(
+                    aoc::input_path(2017, 1)
+                ) | rv::transform(
+                    [](char ch)->int {
+                        return ch - '0';
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return sum_of_digits_matching_next_digit(inp, 1);
+        },
+        [](const auto& inp) {
+            return sum_of_digits_matching_next_digit(inp, inp.size()/2);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -28,34 +27,32 @@ namespace {
 
 }
 
-void aoc::y2017::day_02(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2017, 2)
-        ) | rv::transform(
-            [](const auto& str) {
-                return extract_numbers(str, true);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 2: {} ---", title);
-
-    std::println("  part 1: {}", 
-        r::fold_left(
-            inp | rv::transform(
-                [](const std::vector<int>& row) { return r::max(row) - r::min(row); }
-            ),
-            0,
-            std::plus<>()
-        )
-    );
-
-    std::println("  part 2: {}",
-        r::fold_left(
-            inp | rv::transform( find_quotient ),
-            0,
-            std::plus<>()
-        )
+aoc::solver_ptr aoc::y2017::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2017, 2)
+                ) | rv::transform(
+                    [](const auto& str) {
+                        return extract_numbers(str, true);
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return r::fold_left(
+                inp | rv::transform(
+                    [](const std::vector<int>& row) { return r::max(row) - r::min(row); }
+                ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& inp) {
+            return r::fold_left(
+                inp | rv::transform( find_quotient ),
+                0,
+                std::plus<>()
+            );
+        }
     );
-    
 }
@@ -4,7 +4,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -78,20 +77,22 @@ namespace {
     }
 }
 
-void aoc::y2017::day_03(const std::string& title) {
-
-    auto inp = std::stoi(
-            aoc::file_to_string(
-                aoc::input_path(2017, 3)
-            )
-        );
-
-    std::println("--- Day 3: {} ---", title);
-    std::println("  part 1: {}", 
-        manhattan_distance_from_origin(
-            ulam_spiral_coordinates(inp)
-        )
+aoc::solver_ptr aoc::y2017::day_03() {
+    return aoc::make_solver(
+        []() {
+            return std::stoi(
+                    aoc::file_to_string(
+                        aoc::input_path(2017, 3)
+                    )
+                );
+        },
+        [](const auto& inp) {
+            return manhattan_distance_from_origin(
+                ulam_spiral_coordinates(inp)
+            );
+        },
+        [](const auto& inp) {
+            return do_part_two(inp);
+        }
     );
-    std::println("  part 2: {}", do_part_two(inp) );
-    
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -38,16 +37,20 @@ namespace {
     }
 }
 
-void aoc::y2017::day_04(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2017, 4)
-        ) | rv::transform(
-            aoc::extract_alphabetic
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}", r::count_if(inp, contains_no_duplicates));
-    std::println("  part 2: {}", r::count_if(inp, contains_no_anagrams));
-    
+aoc::solver_ptr aoc::y2017::day_04() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2017, 4)
+                ) | rv::transform(
+                    aoc::extract_alphabetic
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return r::count_if(inp, contains_no_duplicates);
+        },
+        [](const auto& inp) {
+            return r::count_if(inp, contains_no_anagrams);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -31,25 +30,25 @@ namespace {
     }
 }
 
-void aoc::y2017::day_05(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2017, 5)
-        ) | rv::transform(
-            [](auto&& str) {
-                return std::stoi(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}", 
-        do_jump_maze(inp, [](int) {return 1; })
-    );
-    std::println("  part 2: {}", 
-        do_jump_maze(
-            inp, 
-            [](int v) {return (v >= 3) ? -1 : 1; }
-        )
+aoc::solver_ptr aoc::y2017::day_05() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2017, 5)
+                ) | rv::transform(
+                    [](auto&& str) {
+                        return std::stoi(str);
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return do_jump_maze(inp, [](int) {return 1; });
+        },
+        [](const auto& inp) {
+            return do_jump_maze(
+                inp, 
+                [](int v) {return (v >= 3) ? -1 : 1; }
+            );
+        }
     );
-    
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <boost/functional/hash.hpp>
@@ -95,19 +94,25 @@ namespace {
 
 }
 
-void aoc::y2017::day_06(const std::string& title) {
-
-    auto inp = aoc::extract_numbers(
-        aoc::file_to_string(
-            aoc::input_path(2017, 6)
-        ),
-        true
+aoc::solver_ptr aoc::y2017::day_06() {
+    return aoc::make_solver(
+        []() {
+            return num_nonrepearing_redistributions(
+                aoc::extract_numbers(
+                    aoc::file_to_string(
+                        aoc::input_path(2017, 6)
+                    ),
+                    true
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [first_repeat_count, size_of_loop] = inp;
+            return first_repeat_count;
+        },
+        [](const auto& inp) {
+            const auto& [first_repeat_count, size_of_loop] = inp;
+            return size_of_loop;
+        }
     );
-
-    std::println("--- Day 6: {} ---", title);
-
-    auto [first_repeat_count, size_of_loop] = num_nonrepearing_redistributions( inp );
-    std::println("  part 1: {}", first_repeat_count);
-    std::println("  part 2: {}", size_of_loop);
-    
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -122,20 +121,22 @@ namespace {
 
 }
 
-void aoc::y2017::day_07(const std::string& title) {
-
-    auto tower = build_tower(
-        aoc::file_to_string_vector(
-            aoc::input_path(2017, 7)
-        ) | rv::transform(
-            parse_tower_node
-        ) | r::to<std::vector>()
-    );
-
-    std::println("--- Day 7: {} ---", title);
-    std::println("  part 1: {}",
-        tower_root(tower)
+aoc::solver_ptr aoc::y2017::day_07() {
+    return aoc::make_solver(
+        []() {
+            return build_tower(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2017, 7)
+                ) | rv::transform(
+                    parse_tower_node
+                ) | r::to<std::vector>()
+            );
+        },
+        [](const auto& tower) {
+            return tower_root(tower);
+        },
+        [](const auto& tower) {
+            return balancing_weight(tower);
+        }
     );
-    std::println("  part 2: {}", balancing_weight(tower));
-    
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -104,16 +103,20 @@ namespace {
     }
 }
 
-void aoc::y2017::day_08(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2017, 8)
-        ) | rv::transform(
-            parse_instruction
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp) );
-    std::println("  part 2: {}", do_part_2(inp) );
-    
+aoc::solver_ptr aoc::y2017::day_08() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2017, 8)
+                ) | rv::transform(
+                    parse_instruction
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <variant>
 
@@ -147,16 +146,20 @@ namespace {
     }
 }
 
-void aoc::y2017::day_09(const std::string& title) {
-
-    auto groups = parse(
-        aoc::file_to_string(
-            aoc::input_path(2017, 9)
-        )
+aoc::solver_ptr aoc::y2017::day_09() {
+    return aoc::make_solver(
+        []() {
+            return parse(
+                aoc::file_to_string(
+                    aoc::input_path(2017, 9)
+                )
+            );
+        },
+        [](const auto& groups) {
+            return score_group(groups);
+        },
+        [](const auto& groups) {
+            return count_junk_characters(groups);
+        }
     );
-
-    std::println("--- Day 9: {} ---", title);
-    std::println("  part 1: {}", score_group(groups) );
-    std::println("  part 2: {}", count_junk_characters(groups));
-    
 }
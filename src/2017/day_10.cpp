@@ -4,7 +4,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <span>
@@ -24,18 +23,26 @@ namespace {
     }
 }
 
-void aoc::y2017::day_10(const std::string& title) {
-    auto inp_str = aoc::file_to_string(aoc::input_path(2017, 10));
-    auto inp = aoc::split(
-            inp_str, ','
-        ) | rv::transform(
-            [](const std::string& str) {
-                return std::stoi(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp) );
-    std::println("  part 2: {}", knot_hash(inp_str));
-    
+aoc::solver_ptr aoc::y2017::day_10() {
+    return aoc::make_solver(
+        []() {
+            auto inp_str = aoc::file_to_string(aoc::input_path(2017, 10));
+            auto inp = aoc::split(
+                    inp_str, ','
+                ) | rv::transform(
+                    [](const std::string& str) {
+                        return std::stoi(str);
+                    }
+                ) | r::to<std::vector>();
+            return std::tuple{ std::move(inp_str), std::move(inp) };
+        },
+        [](const auto& parsed) {
+            const auto& [inp_str, inp] = parsed;
+            return do_part_1(inp);
+        },
+        [](const auto& parsed) {
+            const auto& [inp_str, inp] = parsed;
+            return knot_hash(inp_str);
+        }
+    );
 }
@@ -4,7 +4,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -53,23 +52,29 @@ namespace {
     }
 }
 
-void aoc::y2017::day_11(const std::string& title) {
-
-    auto [ending_distance, furthest_distance] = traverse_hex_grid(
-        aoc::split(
-            aoc::trim(
-                aoc::file_to_string(
-                    aoc::input_path(2017, 11)
-                )
-            ),
-            ','
-        ) | rv::transform(
-            str_to_hex_dir
-        ) | r::to<std::vector>()
+aoc::solver_ptr aoc::y2017::day_11() {
+    return aoc::make_solver(
+        []() {
+            return traverse_hex_grid(
+                aoc::split(
+                    aoc::trim(
+                        aoc::file_to_string(
+                            aoc::input_path(2017, 11)
+                        )
+                    ),
+                    ','
+                ) | rv::transform(
+                    str_to_hex_dir
+                ) | r::to<std::vector>()
+            );
+        },
+        [](const auto& inp) {
+            const auto& [ending_distance, furthest_distance] = inp;
+            return ending_distance;
+        },
+        [](const auto& inp) {
+            const auto& [ending_distance, furthest_distance] = inp;
+            return furthest_distance;
+        }
     );
-
-    std::println("--- Day 11: {} ---", title);
-    std::println("  part 1: {}", ending_distance );
-    std::println("  part 2: {}", furthest_distance );
-    
 }
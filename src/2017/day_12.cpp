@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -68,20 +67,24 @@ namespace {
     }
 }
 
-void aoc::y2017::day_12(const std::string& title) {
-
-    auto graph = build_graph(
-        aoc::file_to_string_vector(
-            aoc::input_path(2017, 12)
-        ) | rv::transform(
-            [](const std::string& str) {
-                return aoc::extract_numbers(str);
-            }
-        ) | r::to<std::vector>()
+aoc::solver_ptr aoc::y2017::day_12() {
+    return aoc::make_solver(
+        []() {
+            return build_graph(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2017, 12)
+                ) | rv::transform(
+                    [](const std::string& str) {
+                        return aoc::extract_numbers(str);
+                    }
+                ) | r::to<std::vector>()
+            );
+        },
+        [](const auto& graph) {
+            return size_of_connected_component(graph, 0);
+        },
+        [](const auto& graph) {
+            return count_connected_components(graph);
+        }
     );
-
-    std::println("--- Day 12: {} ---", title);
-    std::println("  part 1: {}", size_of_connected_component(graph, 0) );
-    std::println("  part 2: {}", count_connected_components(graph) );
-    
 }
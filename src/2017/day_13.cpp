@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -59,19 +58,23 @@ namespace {
     }
 }
 
-void aoc::y2017::day_13(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2017, 13)
-        ) | rv::transform(
-            [](auto&& str)->scanner {
-                auto nums = aoc::extract_numbers(str);
-                return { nums.front(), nums.back() };
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 13: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp) );
-    std::println("  part 2: {}", do_part_2(inp) );
-    
+aoc::solver_ptr aoc::y2017::day_13() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2017, 13)
+                ) | rv::transform(
+                    [](auto&& str)->scanner {
+                        auto nums = aoc::extract_numbers(str);
+                        return { nums.front(), nums.back() };
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
+    );
 }
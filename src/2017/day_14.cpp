@@ -1,15 +1,12 @@
-
 #include "../util/util.h"
 #include "../util/vec2.h"
 #include "knot_hash.h"
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
-#include <unordered_set>
 #include <bitset>
-#include <queue>
+#include <stack>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -19,40 +16,36 @@ namespace rv = std::ranges::views;
 namespace {
 
     using loc = aoc::vec2<int>;
-    using loc_set = aoc::vec2_set<int>;
 
-    std::string to_binary(int val) {
-        std::bitset<8> binary(val); 
-        return binary.to_string();
-    }
+    constexpr int k_grid_size = 128;
 
-    std::string generate_row(const std::string& key, int row) {
-        std::string row_key = key + "-" + std::to_string(row);
-        auto vals = aoc::knot_hash_to_values(row_key);
-        auto binary_str = vals | rv::transform(
-                to_binary
-            ) | rv::join | r::to<std::string>();
-        return binary_str | rv::transform(
-                [](auto ch) {
-                    return (ch == '1') ? '#' : '.';
-                }
-            ) | r::to<std::string>();
-    }
+    // bit x of row y is the x-th bit, most significant first, of the knot hash
+    // of the row's key.
+    using grid = std::array<std::bitset<k_grid_size>, k_grid_size>;
 
-    std::vector<std::string> generate_grid(const std::string& key) {
-        return rv::iota(0, 128) |
+    grid generate_grid(const std::string& key) {
+        auto row_keys = rv::iota(0, k_grid_size) |
             rv::transform(
-                [key](auto row) {
-                    return generate_row(key, row);
+                [&key](auto row) {
+                    return key + "-" + std::to_string(row);
                 }
             ) | r::to<std::vector>();
+        auto digests = aoc::knot_hash_many(row_keys);
+
+        grid grid;
+        for (int y = 0; y < k_grid_size; ++y) {
+            for (int x = 0; x < k_grid_size; ++x) {
+                grid[y][x] = (digests[y][x / 8] >> (7 - x % 8)) & 1;
+            }
+        }
+        return grid;
     }
 
-    int count_used(const std::vector<std::string>& grid) {
+    int count_used(const grid& grid) {
         return r::fold_left(
             grid | rv::transform(
                 [](auto&& row)->int {
-                    return r::count_if(row, [](auto ch) {return ch == '#'; });
+                    return static_cast<int>(row.count());
                 }
             ),
             0,
@@ -71,43 +64,37 @@ namespace {
                 }
             ) | rv::filter(
                 [](auto loc) {
-                    return loc.x >= 0 && loc.x < 128 && loc.y >= 0 && loc.y < 128;
+                    return loc.x >= 0 && loc.x < k_grid_size && loc.y >= 0 && loc.y < k_grid_size;
                 }
             );
     }
 
-    void find_connected_component(
-            const std::vector<std::string>& grid, loc_set& visited, const loc& start) {
+    // clears the used squares connected to start, which must be used.
+    void clear_connected_component(grid& grid, const loc& start) {
+        std::stack<loc> stack;
+        grid[start.y][start.x] = false;
+        stack.push(start);
 
-        std::queue<loc> queue;
-        queue.push(start);
-
-        while (!queue.empty()) {
-            auto curr = queue.front();
-            queue.pop();
-
-            if (visited.contains(curr)) {
-                continue;
-            }
-            visited.insert(curr);
+        while (!stack.empty()) {
+            auto curr = stack.top();
+            stack.pop();
 
             for (auto adj : neighbors(curr)) {
-                if (grid[adj.y][adj.x] == '#') {
-                    queue.push(adj);
+                if (grid[adj.y][adj.x]) {
+                    grid[adj.y][adj.x] = false;
+                    stack.push(adj);
                 }
             }
         }
     }
 
-    int count_connected_components(const std::vector<std::string>& grid) {
-        loc_set visited;
+    int count_connected_components(grid grid) {
         int count = 0;
-        for (int y = 0; y < 128; ++y) {
-            for (int x = 0; x < 128; ++x) {
-                loc start(x, y);
-                if (grid[y][x] == '#' && !visited.contains(start)) {
+        for (int y = 0; y < k_grid_size; ++y) {
+            for (int x = 0; x < k_grid_size; ++x) {
+                if (grid[y][x]) {
                     ++count;
-                    find_connected_component(grid, visited, start);
+                    clear_connected_component(grid, { x, y });
                 }
             }
         }
@@ -115,16 +102,19 @@ namespace {
     }
 }
 
-void aoc::y2017::day_14(const std::string& title) {
-
-    auto inp = aoc::file_to_string(
-            aoc::input_path( 2017, 14 )
-        ); 
-
-    auto grid = generate_grid( inp );
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}", count_used(grid) );
-    std::println("  part 2: {}", count_connected_components(grid) );
-    
+aoc::solver_ptr aoc::y2017::day_14() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string(
+                    aoc::input_path( 2017, 14 )
+                );
+            return generate_grid( inp );
+        },
+        [](const auto& grid) {
+            return count_used(grid);
+        },
+        [](const auto& grid) {
+            return count_connected_components(grid);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -50,13 +49,20 @@ namespace {
 
 }
 
-void aoc::y2017::day_15(const std::string& title) {
-
-    auto [gen_a, gen_b] = create_tuple<2>(
-            extract_numbers(aoc::file_to_string( aoc::input_path(2017, 15) ))
-        );
-    std::println("--- Day 15: {} ---", title);
-    std::println("  part 1: {}", count_matches(gen_a, gen_b, 40000000));
-    std::println("  part 2: {}", count_matches(gen_a, gen_b, 5000000, 4, 8));
-    
+aoc::solver_ptr aoc::y2017::day_15() {
+    return aoc::make_solver(
+        []() {
+            return create_tuple<2>(
+                    extract_numbers(aoc::file_to_string( aoc::input_path(2017, 15) ))
+                );
+        },
+        [](const auto& inp) {
+            const auto& [gen_a, gen_b] = inp;
+            return count_matches(gen_a, gen_b, 40000000);
+        },
+        [](const auto& inp) {
+            const auto& [gen_a, gen_b] = inp;
+            return count_matches(gen_a, gen_b, 5000000, 4, 8);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -116,16 +115,20 @@ namespace {
     }
 }
 
-void aoc::y2017::day_16(const std::string& title) {
-
-    auto inp = aoc::split(
-            aoc::file_to_string(aoc::input_path(2017, 16)), ','
-        ) | rv::transform(
-            parse_dance_move
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 16: {} ---", title);
-    std::println("  part 1: {}", perform_dance(inp, initial_state(), 1) );
-    std::println("  part 2: {}", dance_a_billion_times(inp) );
-    
+aoc::solver_ptr aoc::y2017::day_16() {
+    return aoc::make_solver(
+        []() {
+            return aoc::split(
+                    aoc::file_to_string(aoc::input_path(2017, 16)), ','
+                ) | rv::transform(
+                    parse_dance_move
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return perform_dance(inp, initial_state(), 1);
+        },
+        [](const auto& inp) {
+            return dance_a_billion_times(inp);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 
 namespace r = std::ranges;
@@ -48,16 +47,20 @@ namespace {
     }
 }
 
-void aoc::y2017::day_17(const std::string& title) {
-
-    auto inp = std::stoi(
-        aoc::file_to_string(
-            aoc::input_path(2017, 17)
-        )
+aoc::solver_ptr aoc::y2017::day_17() {
+    return aoc::make_solver(
+        []() {
+            return std::stoi(
+                aoc::file_to_string(
+                    aoc::input_path(2017, 17)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
     );
-
-    std::println("--- Day 17: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp));
-    std::println("  part 2: {}", do_part_2(inp));
-    
 }
@@ -4,7 +4,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <iterator>
@@ -74,16 +73,22 @@ namespace {
 
 }
 
-void aoc::y2017::day_19(const std::string& title) {
-
-    auto [letters, steps] = traverse_tubes(
-        aoc::file_to_string_vector(
-            aoc::input_path(2017, 19)
-        )
-    ); 
-
-    std::println("--- Day 19: {} ---", title);
-    std::println("  part 1: {}", letters );
-    std::println("  part 2: {}", steps );
-    
+aoc::solver_ptr aoc::y2017::day_19() {
+    return aoc::make_solver(
+        []() {
+            return traverse_tubes(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2017, 19)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [letters, steps] = inp;
+            return letters;
+        },
+        [](const auto& inp) {
+            const auto& [letters, steps] = inp;
+            return steps;
+        }
+    );
 }
@@ -4,7 +4,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <numbers>
 #include <unordered_map>
@@ -244,18 +243,22 @@ namespace {
     }
 }
 
-void aoc::y2017::day_21(const std::string& title) {
-
-    auto rules = to_rules_tbl(
-        aoc::file_to_string_vector(
-            aoc::input_path(2017, 21)
-        ) | rv::transform(
-            parse_rule
-        ) | r::to<std::vector>()
+aoc::solver_ptr aoc::y2017::day_21() {
+    return aoc::make_solver(
+        []() {
+            return to_rules_tbl(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2017, 21)
+                ) | rv::transform(
+                    parse_rule
+                ) | r::to<std::vector>()
+            );
+        },
+        [](const auto& rules) {
+            return apply_rules(rules, 5);
+        },
+        [](const auto& rules) {
+            return apply_rules(rules, 18);
+        }
     );
-
-    std::println("--- Day 21: {} ---", title);
-    std::println("  part 1: {}", apply_rules(rules, 5) );
-    std::println("  part 2: {}", apply_rules(rules, 18) );
-    
 }
@@ -4,7 +4,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -136,27 +135,27 @@ namespace {
     }
 }
 
-void aoc::y2017::day_22(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2017, 22)
-        ); 
-
-    auto starting_loc = initial_loc(inp);
-    auto infected_set = get_infected_cells(inp);
-
-    std::println("--- Day 22: {} ---", title);
-
-    std::println("  part 1: {}", 
-        simulate_virus(
-            simple_update, infected_set, starting_loc, 10000
-        )
-    );
-
-    std::println("  part 2: {}",
-        simulate_virus(
-            multistate_update, infected_set, starting_loc, 10000000
-        )
+aoc::solver_ptr aoc::y2017::day_22() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(
+                    aoc::input_path(2017, 22)
+                );
+            auto starting_loc = initial_loc(inp);
+            auto infected_set = get_infected_cells(inp);
+            return std::tuple{ std::move(starting_loc), std::move(infected_set) };
+        },
+        [](const auto& inp) {
+            const auto& [starting_loc, infected_set] = inp;
+            return simulate_virus(
+                simple_update, infected_set, starting_loc, 10000
+            );
+        },
+        [](const auto& inp) {
+            const auto& [starting_loc, infected_set] = inp;
+            return simulate_virus(
+                multistate_update, infected_set, starting_loc, 10000000
+            );
+        }
     );
-
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -155,19 +154,21 @@ namespace {
     }
 }
 
-void aoc::y2017::day_24(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2017, 24)
-        ) | rv::transform(
-            parse_edge
-        ) | r::to<std::vector>();
-
-    auto graph = to_graph(inp);
-   
-
-    std::println("--- Day 24: {} ---", title);
-    std::println("  part 1: {}", max_weight_path(graph, 0));
-    std::println("  part 2: {}", max_weight_longest_path(graph, 0));
-    
+aoc::solver_ptr aoc::y2017::day_24() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(
+                    aoc::input_path(2017, 24)
+                ) | rv::transform(
+                    parse_edge
+                ) | r::to<std::vector>();
+            return to_graph(inp);
+        },
+        [](const auto& graph) {
+            return max_weight_path(graph, 0);
+        },
+        [](const auto& graph) {
+            return max_weight_longest_path(graph, 0);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2017.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -79,16 +78,21 @@ namespace {
     }
 }
 
-void aoc::y2017::day_25(const std::string& title) {
-
-    auto [num_steps, tm] = parse(
-        aoc::file_to_string_vector(
-            aoc::input_path(2017, 25)
-        )
+aoc::solver_ptr aoc::y2017::day_25() {
+    return aoc::make_solver(
+        []() {
+            return parse(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2017, 25)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [num_steps, tm] = inp;
+            return run_turing_machine(tm, num_steps);
+        },
+        [](const auto&) {
+            return "<xmas freebie>";
+        }
     );
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}", run_turing_machine(tm, num_steps));
-    std::println("  part 2: {}", "<xmas freebie>");
-    
 }
@@ -1,17 +1,19 @@
 #include "knot_hash.h"
-#include <iterator>
-#include <ranges>
-#include <sstream>
+#include "../util/thread_pool.h"
 #include <algorithm>
-
-namespace r = std::ranges;
-namespace rv = std::ranges::views;
+#include <cstring>
+#include <format>
+#include <numeric>
 
 /*------------------------------------------------------------------------------------------------*/
 
 namespace {
     using state = aoc::knot_hash_state;
 
+    constexpr int k_list_size = 256;
+    constexpr int k_rounds = 64;
+    constexpr std::array<uint8_t, 5> k_suffix = { {17, 31, 73, 47, 23} };
+
     int incr(int i, size_t sz, int amnt = 1) {
         return (i + amnt) % sz;
     }
@@ -37,52 +39,93 @@ namespace {
         state.skip_size++;
     }
 
-    std::vector<int> process_input(const std::string& str) {
-        auto lengths = str | rv::transform(
-            [](char ch)->int {
-                return ch;
+    // the list for the full 64 rounds, kept rotated so that the current position
+    // is always its first element. Every span to reverse is then contiguous, and
+    // moving the current position forward is a copy of the skipped elements onto
+    // the end of the list rather than an index taken modulo its size at every
+    // swap. The list slides along a buffer several times its size and is moved
+    // back to the start whenever it reaches the end.
+    class knot_hash_engine {
+    public:
+        knot_hash_engine() : offset_(0), rotation_(0), skip_size_(0) {
+            std::iota(buffer_.begin(), buffer_.begin() + k_list_size, 0);
+        }
+
+        void step(uint8_t len) {
+            auto* list = buffer_.data() + offset_;
+            std::reverse(list, list + len);
+            auto advance = (len + skip_size_++) % k_list_size;
+            if (offset_ + k_list_size + advance > static_cast<int>(buffer_.size())) {
+                std::memmove(buffer_.data(), list, k_list_size);
+                offset_ = 0;
+                list = buffer_.data();
             }
-        ) | r::to<std::vector>();
-        const static std::array<int, 5> suffix = { {17, 31, 73, 47, 23} };
-        r::copy(suffix, std::back_inserter(lengths));
-        return lengths;
-    }
+            std::memcpy(list + k_list_size, list, advance);
+            offset_ += advance;
+            rotation_ = (rotation_ + advance) % k_list_size;
+        }
 
-    std::vector<int> make_dense(const std::vector<int>& sparse) {
-        return sparse | rv::chunk(16) | rv::transform(
-            [](auto rng)->int {
-                return r::fold_left(
-                    rng, 0, [](int lhs, int rhs) { return lhs ^ rhs; }
-                );
+        aoc::knot_hash_digest digest() const {
+            std::array<uint8_t, k_list_size> sparse;
+            for (int i = 0; i < k_list_size; ++i) {
+                sparse[(rotation_ + i) % k_list_size] = buffer_[offset_ + i];
             }
-        ) | r::to<std::vector>();
-    }
+            aoc::knot_hash_digest dense = {};
+            for (int i = 0; i < k_list_size; ++i) {
+                dense[i / 16] ^= sparse[i];
+            }
+            return dense;
+        }
 
-    std::string to_hex(int v) {
-        std::stringstream ss;
-        ss << std::hex << v;
-        auto str = ss.str();
-        if (str.size() == 1) {
-            str = std::string{ '0' } + str;
+    private:
+        std::array<uint8_t, 8 * k_list_size> buffer_;
+        int offset_;
+        int rotation_;
+        int skip_size_;
+    };
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::knot_hash_digest aoc::knot_hash_digest_of(std::string_view inp) {
+    knot_hash_engine engine;
+    for (int i = 0; i < k_rounds; ++i) {
+        for (auto ch : inp) {
+            engine.step(static_cast<uint8_t>(ch));
+        }
+        for (auto len : k_suffix) {
+            engine.step(len);
         }
-        return str;
     }
+    return engine.digest();
 }
 
-std::vector<int> aoc::knot_hash_to_values(const std::string& inp) {
-    auto sparse = rv::iota(0, 256) | r::to<std::vector>();
-    knot_hash_state state;
-    auto lengths = process_input(inp);
-    for (int i = 0; i < 64; ++i) {
-        aoc::knot_hash_iteration(sparse, state, lengths);
+std::string aoc::knot_hash(const std::string& inp) {
+    std::string hex;
+    for (auto byte : knot_hash_digest_of(inp)) {
+        hex += std::format("{:02x}", byte);
     }
-    return make_dense(sparse);
+    return hex;
 }
 
-std::string aoc::knot_hash(const std::string& inp) {
-    return knot_hash_to_values(inp) | rv::transform(
-        to_hex
-    ) | rv::join | r::to<std::string>();
+std::vector<aoc::knot_hash_digest> aoc::knot_hash_many(
+        const std::vector<std::string>& inps, thread_pool& pool) {
+    std::vector<knot_hash_digest> digests(inps.size());
+    thread_pool::task_group group;
+    auto num_chunks = std::min(inps.size(), static_cast<size_t>(pool.size()));
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        pool.submit(group,
+            [&, chunk]() {
+                auto first = chunk * inps.size() / num_chunks;
+                auto last = (chunk + 1) * inps.size() / num_chunks;
+                for (auto i = first; i < last; ++i) {
+                    digests[i] = knot_hash_digest_of(inps[i]);
+                }
+            }
+        );
+    }
+    pool.wait(group);
+    return digests;
 }
 
 void aoc::knot_hash_iteration(std::vector<int>& list, knot_hash_state& state, const std::vector<int>& lengths) {
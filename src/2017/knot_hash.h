@@ -1,7 +1,11 @@
 #pragma once
 
+#include "../util/thread_pool.h"
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <string_view>
 
 namespace aoc {
 
@@ -13,6 +17,15 @@ namespace aoc {
     };
 
     void knot_hash_iteration(std::vector<int>& list, knot_hash_state& state, const std::vector<int>& lengths);
-    std::vector<int> knot_hash_to_values(const std::string& inp);
+
+    // the dense hash: the XOR of each run of 16 values of the sparse hash.
+    using knot_hash_digest = std::array<uint8_t, 16>;
+
+    knot_hash_digest knot_hash_digest_of(std::string_view inp);
     std::string knot_hash(const std::string& inp);
-}
\ No newline at end of file
+
+    // the digests of many inputs, hashed in parallel on a thread pool, the shared
+    // one by default.
+    std::vector<knot_hash_digest> knot_hash_many(const std::vector<std::string>& inps,
+        thread_pool& pool = shared_thread_pool());
+}
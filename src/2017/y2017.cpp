@@ -1,48 +1,32 @@
-
 #include "y2017.h"
-#include <vector>
-#include <functional>
-#include <print>
 
-void aoc::y2017::do_advent_of_code(int day) {
-    const static auto advent_of_code_2017 = std::vector<std::function<void()>>{
-        []() { day_01( "Inverse Captcha" ); },
-        []() { day_02( "Corruption Checksum" ); },
-        []() { day_03( "Spiral Memory" ); },
-        []() { day_04( "High-Entropy Passphrases" ); },
-        []() { day_05( "A Maze of Twisty Trampolines, All Alike" ); },
-        []() { day_06( "Memory Reallocation" ); },
-        []() { day_07( "Recursive Circus" ); },
-        []() { day_08( "I Heard You Like Registers" ); },
-        []() { day_09( "Stream Processing" ); },
-        []() { day_10( "Knot Hash" ); },
-        []() { day_11( "Hex Ed" ); },
-        []() { day_12( "Digital Plumber" ); },
-        []() { day_13( "Packet Scanners" ); },
-        []() { day_14( "Disk Defragmentation" ); },
-        []() { day_15( "Dueling Generators" ); },
-        []() { day_16( "Permutation Promenade" ); },
-        []() { day_17( "Spinlock" ); },
-        []() { day_18( "Duet" ); },
-        []() { day_19( "A Series of Tubes" ); },
-        []() { day_20( "Particle Swarm" ); },
-        []() { day_21( "Fractal Art" ); },
-        []() { day_22( "Sporifica Virus" ); },
-        []() { day_23( "Coprocessor Conflagration" ); },
-        []() { day_24( "Electromagnetic Moat" ); },
-        []() { day_25( "The Halting Problem" ); }
+const aoc::day_table& aoc::y2017::days() {
+    const static auto advent_of_code_2017 = aoc::day_table{
+        { "Inverse Captcha", day_01 },
+        { "Corruption Checksum", day_02 },
+        { "Spiral Memory", day_03 },
+        { "High-Entropy Passphrases", day_04 },
+        { "A Maze of Twisty Trampolines, All Alike", day_05 },
+        { "Memory Reallocation", day_06 },
+        { "Recursive Circus", day_07 },
+        { "I Heard You Like Registers", day_08 },
+        { "Stream Processing", day_09 },
+        { "Knot Hash", day_10 },
+        { "Hex Ed", day_11 },
+        { "Digital Plumber", day_12 },
+        { "Packet Scanners", day_13 },
+        { "Disk Defragmentation", day_14 },
+        { "Dueling Generators", day_15 },
+        { "Permutation Promenade", day_16 },
+        { "Spinlock", day_17 },
+        { "Duet", day_18 },
+        { "A Series of Tubes", day_19 },
+        { "Particle Swarm", day_20 },
+        { "Fractal Art", day_21 },
+        { "Sporifica Virus", day_22 },
+        { "Coprocessor Conflagration", day_23 },
+        { "Electromagnetic Moat", day_24 },
+        { "The Halting Problem", day_25 }
     };
-    
-    auto index = day - 1;
-    if (index < 0) {
-        std::print("invalid day: {0}\n", day);
-        return;
-    }
-
-    if (index < advent_of_code_2017.size()) {
-        advent_of_code_2017[index]();
-    }
-    else {
-        std::print("Day {0} is not complete.\n", day);
-    }
+    return advent_of_code_2017;
 }
@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -36,18 +35,22 @@ namespace {
     }
 }
 
-void aoc::y2018::day_01(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2018, 1)
-        ) | rv::transform(
-            [](auto&& str)->int {
-                return std::stoi(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}", r::fold_left(inp, 0, std::plus<>()));
-    std::println("  part 2: {}", find_first_repeated_freq(inp));
-    
+aoc::solver_ptr aoc::y2018::day_01() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2018, 1)
+                ) | rv::transform(
+                    [](auto&& str)->int {
+                        return std::stoi(str);
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return r::fold_left(inp, 0, std::plus<>());
+        },
+        [](const auto& inp) {
+            return find_first_repeated_freq(inp);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -73,14 +72,18 @@ namespace {
     }
 }
 
-void aoc::y2018::day_02(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-        aoc::input_path(2018, 2)
+aoc::solver_ptr aoc::y2018::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                aoc::input_path(2018, 2)
+            );
+        },
+        [](const auto& inp) {
+            return calculate_checksum(inp);
+        },
+        [](const auto& inp) {
+            return find_boxes(inp);
+        }
     );
-
-    std::println( "--- Day 2: {} ---", title);
-    std::println( "  part 1: {}", calculate_checksum(inp) );
-    std::println("  part 2: {}", find_boxes(inp));
-    
 }
@@ -1,6 +1,5 @@
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include "../util/util.h"
@@ -60,36 +59,38 @@ namespace {
     }
 }
 
-void aoc::y2018::day_03(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2018, 3)
-        ) | rv::transform(
-            [](auto&& line)->fabric_claim {
-                auto vals = aoc::extract_numbers(line, false);
-                return {
-                    vals[0],
-                    vals[1],
-                    vals[2],
-                    vals[3],
-                    vals[4]
-                };
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 3: {} ---", title);
-
-    auto grid = find_counts(inp);
-
-    std::println("  part 1: {}", 
-        r::count_if(
-            grid, 
-            [](auto v) {
-                return v >= 2; 
-            }
-        )
+aoc::solver_ptr aoc::y2018::day_03() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(
+                    aoc::input_path(2018, 3)
+                ) | rv::transform(
+                    [](auto&& line)->fabric_claim {
+                        auto vals = aoc::extract_numbers(line, false);
+                        return {
+                            vals[0],
+                            vals[1],
+                            vals[2],
+                            vals[3],
+                            vals[4]
+                        };
+                    }
+                ) | r::to<std::vector>();
+            auto grid = find_counts(inp);
+            return std::tuple{ std::move(inp), std::move(grid) };
+        },
+        [](const auto& parsed) {
+            const auto& [inp, grid] = parsed;
+            return r::count_if(
+                grid, 
+                [](auto v) {
+                    return v >= 2; 
+                }
+            );
+        },
+        [](const auto& parsed) {
+            const auto& [inp, grid] = parsed;
+            return find_non_overlapping_claim(grid, inp);
+        }
     );
-
-    std::println("  part 2: {}", find_non_overlapping_claim(grid, inp));
-    
 }
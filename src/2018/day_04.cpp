@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <variant>
@@ -119,20 +118,23 @@ namespace {
     }
 }
 
-void aoc::y2018::day_04(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-        aoc::input_path(2018, 4)
+aoc::solver_ptr aoc::y2018::day_04() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(
+                aoc::input_path(2018, 4)
+            );
+            r::sort(inp);
+            auto events = inp | rv::transform(
+                    parse_inp_line
+                ) | r::to<std::vector>();
+            return make_guard_table(events);
+        },
+        [](const auto& guard_table) {
+            return do_part_1(guard_table);
+        },
+        [](const auto& guard_table) {
+            return do_part_2(guard_table);
+        }
     );
-    
-    r::sort(inp);
-    auto events = inp | rv::transform(
-            parse_inp_line
-        ) | r::to<std::vector>();
-    auto guard_table = make_guard_table(events);
-    
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}", do_part_1(guard_table));
-    std::println("  part 2: {}", do_part_2(guard_table));
-    
 }
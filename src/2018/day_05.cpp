@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <stack>
@@ -46,16 +45,20 @@ namespace {
     }
 }
 
-void aoc::y2018::day_05(const std::string& title) {
-
-    auto inp = aoc::file_to_string(
-            aoc::input_path(2018, 5)
-        ) | rv::filter(
-            [](char ch) { return std::isalpha(ch); }
-        ) | r::to<std::string>();
-    
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}", do_reduction(inp));
-    std::println("  part 2: {}", do_part_2(inp));
-    
+aoc::solver_ptr aoc::y2018::day_05() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(
+                    aoc::input_path(2018, 5)
+                ) | rv::filter(
+                    [](char ch) { return std::isalpha(ch); }
+                ) | r::to<std::string>();
+        },
+        [](const auto& inp) {
+            return do_reduction(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
+    );
 }
@@ -1,6 +1,5 @@
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <queue>
@@ -130,16 +129,20 @@ namespace {
 
 }
 
-void aoc::y2018::day_06(const std::string& title) {
-
-    auto points = aoc::file_to_string_vector(
-            aoc::input_path(2018, 6)
-        ) | rv::transform(
-            parse_point
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}", largest_finite_area(points) );
-    std::println("  part 2: {}", safe_area_size(points, 10000));
-    
+aoc::solver_ptr aoc::y2018::day_06() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2018, 6)
+                ) | rv::transform(
+                    parse_point
+                ) | r::to<std::vector>();
+        },
+        [](const auto& points) {
+            return largest_finite_area(points);
+        },
+        [](const auto& points) {
+            return safe_area_size(points, 10000);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -161,18 +160,20 @@ namespace {
     }
 }
 
-void aoc::y2018::day_07(const std::string& title) {
-
-    auto graph = parse_digraph(
-        aoc::file_to_string_vector(
-            aoc::input_path(2018, 7)
-        )
-    );
-
-    std::println("--- Day 7: {} ---", title);
-    std::println("  part 1: {}", 
-        lexographically_smallest_topological_order(graph)
+aoc::solver_ptr aoc::y2018::day_07() {
+    return aoc::make_solver(
+        []() {
+            return parse_digraph(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2018, 7)
+                )
+            );
+        },
+        [](const auto& graph) {
+            return lexographically_smallest_topological_order(graph);
+        },
+        [](const auto& graph) {
+            return min_time(graph, 5, 60);
+        }
     );
-    std::println("  part 2: {}", min_time(graph, 5, 60));
-    
 }
@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <memory>
@@ -78,18 +77,21 @@ namespace {
 
 }
 
-void aoc::y2018::day_08(const std::string& title) {
-
-    auto inp = aoc::extract_numbers(
-        aoc::file_to_string(
-            aoc::input_path(2018, 8)
-        )
+aoc::solver_ptr aoc::y2018::day_08() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::extract_numbers(
+                aoc::file_to_string(
+                    aoc::input_path(2018, 8)
+                )
+            );
+            return parse(inp);
+        },
+        [](const auto& root) {
+            return sum_of_metadata(root);
+        },
+        [](const auto& root) {
+            return value_of_node(root);
+        }
     );
-
-    auto root = parse(inp);
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}", sum_of_metadata(root) );
-    std::println("  part 2: {}", value_of_node(root) );
-    
 }
@@ -111,17 +111,20 @@ namespace {
     }
 }
 
-void aoc::y2018::day_09(const std::string& title) {
-
-
-    auto inp = aoc::extract_numbers_int64(
-        aoc::file_to_string(
-            aoc::input_path(2018, 9)
-        )
+aoc::solver_ptr aoc::y2018::day_09() {
+    return aoc::make_solver(
+        []() {
+            return aoc::extract_numbers_int64(
+                aoc::file_to_string(
+                    aoc::input_path(2018, 9)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return play_game(inp[0], inp[1]);
+        },
+        [](const auto& inp) {
+            return play_game(inp[0], 100 * inp[1]);
+        }
     );
-
-    std::println("--- Day 9: {} ---", title);
-    std::println("  part 1: {}", play_game(inp[0], inp[1]));
-    std::println("  part 2: {}", play_game(inp[0], 100 * inp[1]));
-    
 }
@@ -5,7 +5,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <queue>
@@ -146,18 +145,22 @@ namespace {
     }
 }
 
-void aoc::y2018::day_10(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path( 2018, 10 )
-        ) | rv::transform(
-            parse_particle
-        ) | r::to<std::vector>();
-
-    auto [steps, message] = find_message(inp);
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1:\n\n{}", message );
-    std::println("  part 2: {}", steps);
-    
+aoc::solver_ptr aoc::y2018::day_10() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path( 2018, 10 )
+                ) | rv::transform(
+                    parse_particle
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            auto [steps, message] = find_message(inp);
+            return message;
+        },
+        [](const auto& inp) {
+            auto [steps, message] = find_message(inp);
+            return steps;
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <format>
@@ -104,23 +103,23 @@ namespace {
     }
 }
 
-void aoc::y2018::day_11(const std::string& title) {
-
-    int serial_number = std::stoi(
-        aoc::file_to_string(
-            aoc::input_path(2018, 11)
-        )
+aoc::solver_ptr aoc::y2018::day_11() {
+    return aoc::make_solver(
+        []() {
+            int serial_number = std::stoi(
+                aoc::file_to_string(
+                    aoc::input_path(2018, 11)
+                )
+            );
+            return summed_area_table(construct_grid(serial_number));
+        },
+        [](const auto& sums_tbl) {
+            auto [max_3x3_x, max_3x3_y, _] = max_for_window_sz(sums_tbl, 3);
+            return std::format("{},{}", max_3x3_x, max_3x3_y);
+        },
+        [](const auto& sums_tbl) {
+            auto [max_x, max_y, max_sz] = max_across_all_window_sizes(sums_tbl);
+            return std::format("{},{},{}", max_x, max_y, max_sz);
+        }
     );
-
-    auto grid = construct_grid(serial_number);
-    auto sums_tbl = summed_area_table(grid);
-
-    std::println("--- Day 11: {} ---", title);
-
-    auto [max_3x3_x, max_3x3_y, _] = max_for_window_sz(sums_tbl, 3);
-    std::println("  part 1: {},{}", max_3x3_x, max_3x3_y);
-
-    auto [max_x, max_y, max_sz] = max_across_all_window_sizes(sums_tbl);
-    std::println("  part 2: {},{},{}", max_x, max_y, max_sz);
-    
 }
@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <set>
 #include <unordered_set>
@@ -145,16 +144,22 @@ namespace {
     }
 }
 
-void aoc::y2018::day_12(const std::string& title) {
-
-    auto [init_state, rules] = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2018, 12)
-        )
+aoc::solver_ptr aoc::y2018::day_12() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2018, 12)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [init_state, rules] = inp;
+            return sum_after_n_generations(init_state, rules, 20);
+        },
+        [](const auto& inp) {
+            const auto& [init_state, rules] = inp;
+            return do_part_2(init_state, rules);
+        }
     );
-
-    std::println("--- Day 12: {} ---", title);
-    std::println("  part 1: {}", sum_after_n_generations(init_state, rules, 20));
-    std::println("  part 2: {}", do_part_2(init_state, rules));
-    
 }
@@ -4,7 +4,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -196,7 +195,7 @@ namespace {
     }
 
     vec2 simulate_until_first_collision(
-            const track_features& tracks, std::vector<mine_cart>& init_carts) {
+            const track_features& tracks, const std::vector<mine_cart>& init_carts) {
         auto carts = init_carts;
         std::optional<vec2> collision = {};
         while (!collision) {
@@ -206,7 +205,7 @@ namespace {
     }
 
     vec2 simulate_until_final_cart(
-        const track_features& tracks, std::vector<mine_cart>& init_carts) {
+        const track_features& tracks, const std::vector<mine_cart>& init_carts) {
         auto carts = init_carts;
         std::optional<vec2> final_cart = {};
         while (!final_cart) {
@@ -219,20 +218,24 @@ namespace {
     }
 }
 
-void aoc::y2018::day_13(const std::string& title) {
-
-    auto [carts, tracks] = parse(
-        aoc::file_to_string_vector(
-            aoc::input_path(2018, 13)
-        )
+aoc::solver_ptr aoc::y2018::day_13() {
+    return aoc::make_solver(
+        []() {
+            return parse(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2018, 13)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [carts, tracks] = inp;
+            auto collision = simulate_until_first_collision(tracks, carts);
+            return std::format("{},{}", collision.x, collision.y);
+        },
+        [](const auto& inp) {
+            const auto& [carts, tracks] = inp;
+            auto final_cart = simulate_until_final_cart(tracks, carts);
+            return std::format("{},{}", final_cart.x, final_cart.y);
+        }
     );
-
-    std::println("--- Day 13: {} ---", title);
-
-    auto collision = simulate_until_first_collision(tracks, carts);
-    std::println("  part 1: {},{}", collision.x, collision.y);
-
-    auto final_cart = simulate_until_final_cart(tracks, carts);
-    std::println("  part 2: {},{}", final_cart.x, final_cart.y);
-    
 }
@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -100,16 +99,20 @@ namespace {
     }
 }
 
-void aoc::y2018::day_14(const std::string& title) {
-
-    auto inp = std::stoi(
-        aoc::file_to_string(
-            aoc::input_path(2018, 14)
-        )
+aoc::solver_ptr aoc::y2018::day_14() {
+    return aoc::make_solver(
+        []() {
+            return std::stoi(
+                aoc::file_to_string(
+                    aoc::input_path(2018, 14)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return do_part_1( inp );
+        },
+        [](const auto& inp) {
+            return do_part_2( inp );
+        }
     );
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}", do_part_1( inp ) );
-    std::println("  part 2: {}", do_part_2( inp ) );
-    
 }
@@ -489,16 +489,20 @@ namespace {
 
 }
 
-void aoc::y2018::day_15(const std::string& title) {
-
-    auto input_battle = battle(
-        aoc::file_to_string_vector(
-            aoc::input_path(2018, 15)
-        )
+aoc::solver_ptr aoc::y2018::day_15() {
+    return aoc::make_solver(
+        []() {
+            return battle(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2018, 15)
+                )
+            );
+        },
+        [](const auto& input_battle) {
+            return simulate_battle(input_battle, false).score;
+        },
+        [](const auto& input_battle) {
+            return do_part_2(input_battle);
+        }
     );
-
-    std::println("--- Day 15: {} ---", title);
-    std::println("  part 1: {}", simulate_battle(input_battle, false).score );
-    std::println("  part 2: {}", do_part_2(input_battle));
-    
 }
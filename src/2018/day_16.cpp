@@ -1,9 +1,9 @@
 
 #include "../util/util.h"
+#include "elfcode.h"
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -18,8 +18,7 @@ namespace rv = std::ranges::views;
 
 namespace {
 
-    using op_fn = std::function<int(int, int)>;
-
+    // the elfcode dialect's codes are in the order of op_code.
     enum op_code {
         addr = 0,
         addi,
@@ -45,82 +44,27 @@ namespace {
         );
     }
 
-    struct op_info {
-        op_code code;
-        op_fn func;
-        bool a_is_reg;
-        bool b_is_reg;
-    };
-
     using code_set_tbl = std::unordered_map<int, std::unordered_set<op_code>>;
     using op_code_tbl = std::unordered_map<int, op_code>;
     using quadruple = std::array<int, 4>;
 
-    int add(int a, int b) {
-        return a + b;
-    }
-
-    int mul(int a, int b) {
-        return a * b;
-    }
-
-    int ban(int a, int b) {
-        return a & b;
-    }
-
-    int bor(int a, int b) {
-        return a | b;
-    }
-
-    int set(int a, int b) {
-        return a;
-    }
-
-    int gt(int a, int b) {
-        return (a > b) ? 1 : 0;
+    aoc::vm_statement to_statement(op_code op, int a, int b, int c) {
+        return { op, { aoc::vm_imm(a), aoc::vm_imm(b), aoc::vm_imm(c) } };
     }
 
-    int eq(int a, int b) {
-        return (a == b) ? 1 : 0;
-    }
-
-    const std::array<op_info, 16> g_ops = { {
-        {addr, add, true, true},
-        {addi, add, true, false},
-        {mulr, mul, true, true},
-        {muli, mul, true, false},
-        {banr, ban, true, true},
-        {bani, ban, true, false},
-        {borr, bor, true, true},
-        {bori, bor, true, false},
-        {setr, set, true, false},
-        {seti, set, false, false},
-        {gtir,  gt, false, true},
-        {gtri,  gt, true, false},
-        {gtrr,  gt, true, true},
-        {eqir,  eq, false, true},
-        {eqri,  eq, true, false},
-        {eqrr,  eq, true, true}
-    } };
-
+    // decodes the instruction and evaluates it on the registers directly.
     quadruple perform_op(const quadruple& inp_state, op_code op, int a, int b, int c) {
+        auto instr = aoc::elfcode_dialect().decode(to_statement(op, a, b, c));
+        aoc::vm_registers regs = {};
+        r::copy(inp_state, regs.begin());
 
-        static std::unordered_map<op_code, op_info> tbl;
-        if (tbl.empty()) {
-            tbl = g_ops | rv::transform(
-                [](const auto& oi)->std::unordered_map<op_code, op_info>::value_type {
-                    return { oi.code, oi };
-                }
-            ) | r::to<std::unordered_map<op_code, op_info>>();
-        }
-
-        auto state = inp_state;
-        const auto& info = tbl.at(op);
-        int arg_a = info.a_is_reg ? state.at(a) : a;
-        int arg_b = info.b_is_reg ? state.at(b) : b;
-        state.at(c) = info.func(arg_a, arg_b);
-
-        return state;
+        auto a_val = (instr.reg_flags & aoc::vm_instruction::k_a_is_reg) ? regs[instr.a] : instr.a;
+        auto b_val = (instr.reg_flags & aoc::vm_instruction::k_b_is_reg) ? regs[instr.b] : instr.b;
+        regs[instr.dst] = aoc::vm_apply(instr.op, a_val, b_val);
+        return { {
+            static_cast<int>(regs[0]), static_cast<int>(regs[1]),
+            static_cast<int>(regs[2]), static_cast<int>(regs[3])
+        } };
     }
 
     struct test {
@@ -250,11 +194,14 @@ namespace {
     }
 
     int run_code(const op_code_tbl& op_tbl, const std::vector<quadruple>& code) {
-        quadruple registers = { {0,0,0,0} };
-        for (const auto& instr : code) {
-            registers = perform_op(registers, op_tbl.at(instr[0]), instr[1], instr[2], instr[3]);
-        }
-        return registers[0];
+        auto statements = code | rv::transform(
+            [&](const auto& instr) {
+                return to_statement(op_tbl.at(instr[0]), instr[1], instr[2], instr[3]);
+            }
+        ) | r::to<std::vector>();
+        aoc::vm_machine machine(aoc::vm_assemble(aoc::elfcode_dialect(), statements));
+        machine.run();
+        return static_cast<int>(machine[0]);
     }
 
     int do_part_2(const std::vector<test>& tests, const std::vector<quadruple>& code) {
@@ -263,16 +210,22 @@ namespace {
     }
 }
 
-void aoc::y2018::day_16(const std::string& title) {
-
-    auto [tests, code] = parse(
-        aoc::file_to_string_vector(
-            aoc::input_path(2018, 16)
-        )
+aoc::solver_ptr aoc::y2018::day_16() {
+    return aoc::make_solver(
+        []() {
+            return parse(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2018, 16)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [tests, code] = inp;
+            return do_part_1( tests);
+        },
+        [](const auto& inp) {
+            const auto& [tests, code] = inp;
+            return do_part_2( tests, code);
+        }
     );
-
-    std::println("--- Day 16: {} ---", title);
-    std::println("  part 1: {}", do_part_1( tests) );
-    std::println("  part 2: {}", do_part_2( tests, code) );
-    
 }
@@ -4,7 +4,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <stack>
@@ -167,29 +166,34 @@ namespace {
     }
 }
 
-void aoc::y2018::day_17(const std::string& title) {
-
-    auto reservoir = make_reservoir(
-        aoc::file_to_string_vector(
-            aoc::input_path(2018, 17)
-        ) | rv::transform(
-            parse_command
-        ) | r::to<std::vector>()
-    );
-
-    fill_reservoir(reservoir);
-
-    std::println("--- Day 17: {} ---", title);
-    std::println("  part 1: {}", r::count_if(
-        reservoir | rv::values,
-        [](tile_type tile) {
-            return tile == standing_water || tile == falling_water;
-        }
-    ));
-    std::println("  part 2: {}", r::count_if(
-        reservoir | rv::values,
-        [](tile_type tile) {
-            return tile == standing_water;
+aoc::solver_ptr aoc::y2018::day_17() {
+    return aoc::make_solver(
+        []() {
+            auto reservoir = make_reservoir(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2018, 17)
+                ) | rv::transform(
+                    parse_command
+                ) | r::to<std::vector>()
+            );
+            fill_reservoir(reservoir);
+            return reservoir;
+        },
+        [](const auto& reservoir) {
+            return r::count_if(
+                reservoir | rv::values,
+                [](tile_type tile) {
+                    return tile == standing_water || tile == falling_water;
+                }
+            );
+        },
+        [](const auto& reservoir) {
+            return r::count_if(
+                reservoir | rv::values,
+                [](tile_type tile) {
+                    return tile == standing_water;
+                }
+            );
         }
-    ));
+    );
 }
@@ -5,7 +5,6 @@
 #include <boost/functional/hash.hpp>
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <memory>
@@ -368,23 +367,24 @@ namespace {
     }
 }
 
-void aoc::y2018::day_20(const std::string& title) {
-
-    auto inp = aoc::file_to_string(
-            aoc::input_path(2018, 20)
-        ); 
-
-    auto distances = explore_north_pole_base(inp);
-
-    std::println("--- Day 20: {} ---", title);
-    std::println("  part 1: {}", r::max( distances | rv::values ) );
-    std::println("  part 2: {}",
-        r::count_if(
-            distances | rv::values,
-            [](int dist) {
-                return dist >= 1000;
-            }
-        )
+aoc::solver_ptr aoc::y2018::day_20() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string(
+                    aoc::input_path(2018, 20)
+                );
+            return explore_north_pole_base(inp);
+        },
+        [](const auto& distances) {
+            return r::max( distances | rv::values );
+        },
+        [](const auto& distances) {
+            return r::count_if(
+                distances | rv::values,
+                [](int dist) {
+                    return dist >= 1000;
+                }
+            );
+        }
     );
-    
 }
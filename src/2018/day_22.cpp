@@ -1,6 +1,7 @@
 #include "../util/util.h"
 #include "../util/vec2.h"
 #include "../util/grid.h"
+#include "../util/graph_search.h"
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
@@ -194,67 +195,64 @@ namespace {
         return moves;
     }
 
-    using time_map = std::unordered_map<traversal_state, int, traversal_state_hash>;
-
+    // the states are indexed densely by location and tool, the tool varying
+    // fastest.
+    template<template<typename, typename> typename Queue>
     int lowest_time_path(const grid<cave_type>& cavern, const point& target) {
-
-        time_map elapsed_time;
-
-        aoc::priority_queue<traversal_state, traversal_state_hash> queue;
-        traversal_state start_state = { {0, 0}, torch };
-        elapsed_time[start_state] = 0;
-        queue.insert(start_state, 0);
-
-        while (!queue.empty()) {
-            auto u = queue.extract_min();
-            auto moves = next_moves(cavern, u);
-
-            for (auto [v, time_to_v] : moves) {
-                auto dist_to_u = elapsed_time.at(u);
-                auto dist_through_u_to_v = dist_to_u + time_to_v;
-                auto curr_dist_to_v = elapsed_time.contains(v) ?
-                    elapsed_time.at(v) :
-                    std::numeric_limits<int>::max();
-
-                if (dist_through_u_to_v < curr_dist_to_v) {
-
-                    if (v.loc == target && v.tool_equipped == torch) {
-                        return dist_through_u_to_v;
-                    }
-
-                    elapsed_time[v] = dist_through_u_to_v;
-                    if (queue.contains(v)) {
-                        queue.change_priority(v, dist_through_u_to_v);
-                    } else {
-                        queue.insert(v, dist_through_u_to_v);
-                    }
+        auto [wd, hgt] = cavern.dimensions();
+        traversal_state target_state = { target, torch };
+        auto result = aoc::dijkstra_search<aoc::search_tracking::distances, Queue>(
+            traversal_state{ {0, 0}, torch },
+            [&](const traversal_state& ts) {
+                return next_moves(cavern, ts);
+            },
+            [&](const traversal_state& ts) {
+                return ts == target_state;
+            },
+            aoc::indexed_by<traversal_state, traversal_state_hash>(
+                static_cast<size_t>(wd) * hgt * 3,
+                [wd](const traversal_state& ts) {
+                    return (static_cast<size_t>(ts.loc.y) * wd + ts.loc.x) * 3 + ts.tool_equipped;
                 }
-            }
-        }
-
-        return -1;
+            )
+        );
+        return result.goal_distance().value_or(-1);
     }
 
+    template<template<typename, typename> typename Queue>
     int do_part_2(const scan_results& scan) {
         const int k_padding = 250;
         auto cave_system = build_cave_system(
             scan, scan.target.x + k_padding, 
             scan.target.y + k_padding
         );
-        return lowest_time_path(cave_system, scan.target);
+        return lowest_time_path<Queue>(cave_system, scan.target);
     }
 }
 
-void aoc::y2018::day_22(const std::string& title) {
-
-    auto scan = parse(
-        aoc::file_to_string_vector(
-            aoc::input_path(2018, 22)
-        )
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2018::day_22_with_queue() {
+    return aoc::make_solver(
+        []() {
+            return parse(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2018, 22)
+                )
+            );
+        },
+        [](const auto& scan) {
+            return do_part_1(scan);
+        },
+        [](const auto& scan) {
+            return do_part_2<Queue>(scan);
+        }
     );
-
-    std::println("--- Day 22: {} ---", title);
-    std::println("  part 1: {}", do_part_1(scan) );
-    std::println("  part 2: {}", do_part_2(scan) );
-    
 }
+
+template aoc::solver_ptr aoc::y2018::day_22_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2018::day_22_with_queue<aoc::indexed_4ary_heap>();
+template aoc::solver_ptr aoc::y2018::day_22_with_queue<aoc::radix_heap>();
+
+aoc::solver_ptr aoc::y2018::day_22() {
+    return day_22_with_queue<aoc::radix_heap>();
+}
\ No newline at end of file
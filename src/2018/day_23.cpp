@@ -4,7 +4,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -285,15 +284,20 @@ namespace {
     }
 }
 
-void aoc::y2018::day_23(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2018, 23)
-        ) | rv::transform(
-            string_to_nanobot
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 23: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp) );
-    std::println("  part 2: {}", do_part_2(inp) );
+aoc::solver_ptr aoc::y2018::day_23() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2018, 23)
+                ) | rv::transform(
+                    string_to_nanobot
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <set>
 #include <unordered_set>
@@ -285,18 +284,22 @@ namespace {
     }
 }
 
-void aoc::y2018::day_24(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2018, 24)
-        ); 
-
-    auto [immune_system, infection] = parse(inp);
-
-    std::println("--- Day 24: {} ---", title);
-    std::println("  part 1: {}", 
-        do_war(immune_system, infection).units_remaining
+aoc::solver_ptr aoc::y2018::day_24() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(
+                    aoc::input_path(2018, 24)
+                );
+            auto [immune_system, infection] = parse(inp);
+            return std::tuple{ std::move(immune_system), std::move(infection) };
+        },
+        [](const auto& inp) {
+            const auto& [immune_system, infection] = inp;
+            return do_war(immune_system, infection).units_remaining;
+        },
+        [](const auto& inp) {
+            const auto& [immune_system, infection] = inp;
+            return do_part_2(immune_system, infection);
+        }
     );
-    std::println("  part 2: {}", do_part_2(immune_system, infection));
-    
 }
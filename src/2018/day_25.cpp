@@ -4,7 +4,6 @@
 #include "y2018.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/geometry.hpp>
@@ -110,16 +109,20 @@ namespace {
     }
 }
 
-void aoc::y2018::day_25(const std::string& title) {
-
-    auto points = aoc::file_to_string_vector(
-            aoc::input_path(2018, 25)
-        ) | rv::transform(
-            parse_vec4
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}", number_of_constellations(points) );
-    std::println("  part 2: {}", "<x-mas freebie>");
-    
+aoc::solver_ptr aoc::y2018::day_25() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2018, 25)
+                ) | rv::transform(
+                    parse_vec4
+                ) | r::to<std::vector>();
+        },
+        [](const auto& points) {
+            return number_of_constellations(points);
+        },
+        [](const auto&) {
+            return "<x-mas freebie>";
+        }
+    );
 }
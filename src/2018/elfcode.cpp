@@ -0,0 +1,219 @@
+#include "elfcode.h"
+#include "../util/util.h"
+#include <format>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    bool is_elfcode_op(aoc::vm_op op) {
+        switch (op) {
+            case aoc::vm_op::set:
+            case aoc::vm_op::add:
+            case aoc::vm_op::mul:
+            case aoc::vm_op::bit_and:
+            case aoc::vm_op::bit_or:
+            case aoc::vm_op::gt:
+            case aoc::vm_op::eq:
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+const aoc::vm_dialect& aoc::elfcode_dialect() {
+    static const vm_dialect dialect({
+        {"addr", vm_op::add, vm_as_reg(2), vm_as_reg(0), vm_as_reg(1)},
+        {"addi", vm_op::add, vm_as_reg(2), vm_as_reg(0), vm_as_imm(1)},
+        {"mulr", vm_op::mul, vm_as_reg(2), vm_as_reg(0), vm_as_reg(1)},
+        {"muli", vm_op::mul, vm_as_reg(2), vm_as_reg(0), vm_as_imm(1)},
+        {"banr", vm_op::bit_and, vm_as_reg(2), vm_as_reg(0), vm_as_reg(1)},
+        {"bani", vm_op::bit_and, vm_as_reg(2), vm_as_reg(0), vm_as_imm(1)},
+        {"borr", vm_op::bit_or, vm_as_reg(2), vm_as_reg(0), vm_as_reg(1)},
+        {"bori", vm_op::bit_or, vm_as_reg(2), vm_as_reg(0), vm_as_imm(1)},
+        {"setr", vm_op::set, vm_as_reg(2), vm_as_reg(0), vm_none()},
+        {"seti", vm_op::set, vm_as_reg(2), vm_as_imm(0), vm_none()},
+        {"gtir", vm_op::gt, vm_as_reg(2), vm_as_imm(0), vm_as_reg(1)},
+        {"gtri", vm_op::gt, vm_as_reg(2), vm_as_reg(0), vm_as_imm(1)},
+        {"gtrr", vm_op::gt, vm_as_reg(2), vm_as_reg(0), vm_as_reg(1)},
+        {"eqir", vm_op::eq, vm_as_reg(2), vm_as_imm(0), vm_as_reg(1)},
+        {"eqri", vm_op::eq, vm_as_reg(2), vm_as_reg(0), vm_as_imm(1)},
+        {"eqrr", vm_op::eq, vm_as_reg(2), vm_as_reg(0), vm_as_reg(1)}
+    });
+    return dialect;
+}
+
+aoc::vm_program aoc::assemble_elfcode(const std::vector<std::string>& lines) {
+    int ip_register = -1;
+    std::vector<std::string> code;
+    for (const auto& line : lines) {
+        if (line.starts_with("#ip")) {
+            ip_register = aoc::extract_numbers(line).front();
+        } else {
+            code.push_back(line);
+        }
+    }
+    return vm_assemble(elfcode_dialect(), code, ip_register);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::elfcode_jit::elfcode_jit(const vm_program& program, const std::vector<int64_t>& entry_points) :
+        registers_{},
+        ip_(0),
+        ip_register_(program.ip_register),
+        code_(program.plain),
+        entry_points_(program.plain.size(), false),
+        block_index_(program.plain.size(), -1) {
+    for (const auto& instr : code_) {
+        if (!is_elfcode_op(instr.op)) {
+            throw std::runtime_error(std::format("elfcode: cannot compile {}", vm_op_name(instr.op)));
+        }
+    }
+    for (auto ip : entry_points) {
+        if (ip >= 0 && ip < static_cast<int64_t>(code_.size())) {
+            entry_points_[ip] = true;
+        }
+    }
+}
+
+int64_t& aoc::elfcode_jit::operator[](int reg) {
+    return registers_.at(reg);
+}
+
+int64_t aoc::elfcode_jit::operator[](int reg) const {
+    return registers_.at(reg);
+}
+
+const aoc::vm_registers& aoc::elfcode_jit::registers() const {
+    return registers_;
+}
+
+int64_t aoc::elfcode_jit::ip() const {
+    return ip_;
+}
+
+aoc::vm_status aoc::elfcode_jit::run() {
+    vm_handler handler;
+    return run(handler);
+}
+
+bool aoc::elfcode_jit::is_register(int64_t operand, bool reads_register) const {
+    return reads_register && operand != ip_register_;
+}
+
+const int64_t* aoc::elfcode_jit::bind(int64_t ip, int64_t operand, bool reads_register) {
+    if (is_register(operand, reads_register)) {
+        return &registers_[operand];
+    }
+    constants_.push_back(reads_register ? ip : operand);
+    return &constants_.back();
+}
+
+int aoc::elfcode_jit::block_at(int64_t ip) {
+    auto size = static_cast<int64_t>(code_.size());
+    if (ip < 0 || ip >= size) {
+        return k_halted;
+    }
+    if (block_index_[ip] >= 0) {
+        return block_index_[ip];
+    }
+
+    block blk = {
+        ip, addresses_.size(), 0, steps_.size(), 0, exit_kind::fall_through, 0, bind(ip, 0, false),
+        { k_unresolved, k_unresolved }, 0, 0
+    };
+    for (auto addr = ip; ; ++addr) {
+        const auto& instr = code_[addr];
+        auto a_reads_register = (instr.reg_flags & vm_instruction::k_a_is_reg) != 0;
+        auto b_reads_register = (instr.reg_flags & vm_instruction::k_b_is_reg) != 0;
+        auto a_is_constant = !is_register(instr.a, a_reads_register);
+        auto b_is_constant = !is_register(instr.b, b_reads_register);
+        const auto* a = bind(addr, instr.a, a_reads_register);
+        const auto* b = bind(addr, instr.b, b_reads_register);
+        addresses_.push_back(addr);
+
+        if (instr.dst == ip_register_) {
+            if (a_is_constant && b_is_constant) {
+                auto target = vm_apply(instr.op, *a, *b);
+                auto length = addresses_.size() - blk.addresses_begin;
+                if (target + 1 != ip && target + 1 >= 0 && target + 1 < size && !entry_points_[target + 1] &&
+                        length < k_max_block_length) {
+                    addr = target;
+                    continue;
+                }
+                blk.exit = exit_kind::jump;
+                blk.target = target;
+            } else if (instr.op == vm_op::add && (a_is_constant || b_is_constant)) {
+                blk.exit = exit_kind::skip;
+                blk.target = a_is_constant ? *a : *b;
+                blk.offset = a_is_constant ? b : a;
+            } else {
+                blk.exit = exit_kind::computed;
+                steps_.push_back({ instr.op, &registers_[instr.dst], a, b });
+            }
+            break;
+        }
+        steps_.push_back({ instr.op, &registers_[instr.dst], a, b });
+
+        if (addr + 1 == size || entry_points_[addr + 1]) {
+            blk.target = addr;
+            break;
+        }
+    }
+    blk.addresses_end = addresses_.size();
+    blk.steps_end = steps_.size();
+
+    blocks_.push_back(blk);
+    block_index_[ip] = static_cast<int>(blocks_.size()) - 1;
+    return block_index_[ip];
+}
+
+int aoc::elfcode_jit::run_block(int index) {
+    auto& blk = blocks_[index];
+    ++blk.hits;
+    for (auto i = blk.steps_begin; i < blk.steps_end; ++i) {
+        const auto& s = steps_[i];
+        *s.dst = vm_apply(s.op, *s.a, *s.b);
+    }
+
+    if (blk.exit == exit_kind::computed) {
+        ip_ = registers_[ip_register_] + 1;
+        return block_at(ip_);
+    }
+    auto offset = *blk.offset;
+    if (ip_register_ >= 0) {
+        registers_[ip_register_] = blk.target + offset;
+    }
+    ip_ = blk.target + offset + 1;
+    if (offset != 0 && offset != 1) {
+        return block_at(ip_);
+    }
+    if (blk.successors[offset] == k_unresolved) {
+        auto successor = block_at(ip_);
+        blocks_[index].successors[offset] = successor;
+        return successor;
+    }
+    return blk.successors[offset];
+}
+
+void aoc::elfcode_jit::record_profile() {
+    auto* profile = vm_profile::active();
+    if (profile == nullptr) {
+        return;
+    }
+    for (auto& blk : blocks_) {
+        auto count = blk.hits - blk.recorded_hits;
+        if (count == 0) {
+            continue;
+        }
+        for (auto i = blk.addresses_begin; i < blk.addresses_end; ++i) {
+            profile->record(addresses_[i], code_[addresses_[i]], count);
+        }
+        profile->record_block(blk.first, addresses_[blk.addresses_end - 1], count);
+        blk.recorded_hits = blk.hits;
+    }
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "../util/register_vm.h"
+#include "../util/self_test.h"
+#include <array>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+    // the elfcode of days 16, 19 and 21 as a dialect of the register machine.
+    // Its opcodes are in the order of the puzzle's descriptions, addr to eqrr,
+    // and its operands are numbers that each opcode reads as a register index or
+    // as an immediate.
+    const vm_dialect& elfcode_dialect();
+
+    // assembles a program, binding the instruction pointer to the register its
+    // "#ip" line declares, if it has one.
+    vm_program assemble_elfcode(const std::vector<std::string>& lines);
+
+    // runs an elfcode program compiled, as it first reaches each address, into
+    // blocks: runs of instructions from the address jumped to up to the next
+    // one that writes the instruction pointer's register. Within a block, reads
+    // of that register are folded into constants and each instruction is bound
+    // to pointers to the registers and constants it reads, so running it is a
+    // single switch on its operation. A seti or addi that jumps to a fixed
+    // address is resolved when the block is compiled, and the block carries on
+    // at the address it jumps to, so a loop body joined up by such jumps runs as
+    // one block. A block that ends on an addr that skips ahead by a flag keeps
+    // the blocks it goes on to.
+    //
+    // the handler passed to run sees the start of each block rather than every
+    // instruction, so addresses it waits for must be given as entry points,
+    // which always start a block. Each block counts how often it runs, and the
+    // counts go to the profile recording on the thread, if any.
+
+    class elfcode_jit {
+    public:
+        explicit elfcode_jit(const vm_program& program, const std::vector<int64_t>& entry_points = {});
+
+        // the compiled blocks point into the machine's own registers.
+        elfcode_jit(const elfcode_jit&) = delete;
+        elfcode_jit& operator=(const elfcode_jit&) = delete;
+
+        int64_t& operator[](int reg);
+        int64_t operator[](int reg) const;
+
+        const vm_registers& registers() const;
+        int64_t ip() const;
+
+        // runs until the instruction pointer leaves the program, returning
+        // halted, or until the handler stops the machine at the start of a block.
+        template<typename Handler>
+        vm_status run(Handler& handler) {
+            auto status = vm_status::halted;
+            for (auto index = block_at(ip_); index >= 0; index = run_block(index)) {
+                if (ip_register_ >= 0) {
+                    registers_[ip_register_] = ip_;
+                }
+                if (!handler.before(ip_, registers_)) {
+                    status = vm_status::stopped;
+                    break;
+                }
+            }
+            record_profile();
+            return status;
+        }
+
+        vm_status run();
+
+    private:
+        struct step {
+            vm_op op;
+            int64_t* dst;
+            const int64_t* a;
+            const int64_t* b;
+        };
+
+        // how a block leaves: on to the address after its last instruction, by a
+        // jump to a fixed address, by an addr that skips ahead by the value of a
+        // register, or to wherever its last step sets the instruction pointer's
+        // register.
+        enum class exit_kind {
+            fall_through,
+            jump,
+            skip,
+            computed
+        };
+
+        static constexpr int k_halted = -1;
+        static constexpr int k_unresolved = -2;
+
+        // the most instructions, jumps included, a block runs through by
+        // following jumps, which also ends a block caught in a cycle of jumps.
+        static constexpr size_t k_max_block_length = 64;
+
+        // a block starts at first and covers the instructions in its range of
+        // addresses, in the order they run, jumps included.
+        struct block {
+            int64_t first;
+            size_t addresses_begin;
+            size_t addresses_end;
+            size_t steps_begin;
+            size_t steps_end;
+            exit_kind exit;
+
+            // unless the exit is computed, the block leaves target plus offset in
+            // the instruction pointer's register. The offset is 0 but for a skip,
+            // which is nearly always by a flag, so the blocks after an offset of 0
+            // and of 1 are kept once compiled.
+            int64_t target;
+            const int64_t* offset;
+            std::array<int, 2> successors;
+
+            uint64_t hits;
+            uint64_t recorded_hits;
+        };
+
+        vm_registers registers_;
+        int64_t ip_;
+        int ip_register_;
+        std::vector<vm_instruction> code_;
+        std::vector<bool> entry_points_;
+        std::vector<int> block_index_;
+        std::vector<block> blocks_;
+        std::vector<int64_t> addresses_;
+        std::vector<step> steps_;
+        std::deque<int64_t> constants_;
+
+        // the block starting at ip, compiled if it has not been, or k_halted if
+        // ip is outside the program.
+        int block_at(int64_t ip);
+
+        // true if an operand reads a register other than the instruction
+        // pointer's, whose reads are folded into constants.
+        bool is_register(int64_t operand, bool reads_register) const;
+
+        // the register an operand reads or, if it is an immediate or reads the
+        // instruction pointer's register, a constant holding its value at ip.
+        const int64_t* bind(int64_t ip, int64_t operand, bool reads_register);
+
+        // runs a block, returning the next block, or k_halted.
+        int run_block(int index);
+
+        void record_profile();
+    };
+
+    // checks of the compiled blocks against the reference machine; 'test'.
+    const self_test_table& elfcode_self_tests();
+
+}
@@ -0,0 +1,55 @@
+#include "elfcode.h"
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // stops a machine after a fixed number of calls.
+    struct step_limit_handler : aoc::vm_handler {
+        int remaining;
+
+        bool before(int64_t ip, const aoc::vm_registers& regs) {
+            return remaining-- > 0;
+        }
+    };
+
+    // a jump to a fixed address below 0 halts the program, and must not be
+    // followed into the block.
+    bool elfcode_jump_below_zero_halts() {
+        auto prog = aoc::assemble_elfcode({
+            "#ip 0",
+            "addi 1 1 1",
+            "seti -5 0 0",
+            "addi 1 1 1"
+        });
+        aoc::vm_machine reference(prog);
+        aoc::elfcode_jit jit(prog);
+        return reference.run() == aoc::vm_status::halted && jit.run() == aoc::vm_status::halted &&
+            jit.registers() == reference.registers() && jit[1] == 1;
+    }
+
+    // jumps between 1 and 3 that never come back to the block's first address
+    // must still end the block, so compiling it terminates.
+    bool elfcode_cycle_of_jumps_compiles() {
+        auto prog = aoc::assemble_elfcode({
+            "#ip 0",
+            "addi 1 1 1",
+            "seti 2 0 0",
+            "addi 2 1 2",
+            "seti 0 0 0"
+        });
+        aoc::elfcode_jit jit(prog);
+        step_limit_handler handler{ {}, 1000 };
+        return jit.run(handler) == aoc::vm_status::stopped && jit[1] == 1;
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+const aoc::self_test_table& aoc::elfcode_self_tests() {
+    static const self_test_table tests = {
+        { "elfcode jump below zero halts", elfcode_jump_below_zero_halts },
+        { "elfcode cycle of jumps compiles", elfcode_cycle_of_jumps_compiles }
+    };
+    return tests;
+}
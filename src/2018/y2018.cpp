@@ -1,48 +1,32 @@
-
 #include "y2018.h"
-#include <vector>
-#include <functional>
-#include <print>
 
-void aoc::y2018::do_advent_of_code(int day) {
-    const static auto advent_of_code_2018 = std::vector<std::function<void()>>{
-        []() { day_01( "Chronal Calibration" ); },
-        []() { day_02( "Inventory Management System" ); },
-        []() { day_03( "No Matter How You Slice It" ); },
-        []() { day_04( "Repose Record" ); },
-        []() { day_05( "Alchemical Reduction" ); },
-        []() { day_06( "Chronal Coordinates" ); },
-        []() { day_07( "The Sum of Its Parts" ); },
-        []() { day_08( "Memory Maneuver" ); },
-        []() { day_09( "Marble Mania" ); },
-        []() { day_10( "The Stars Align" ); },
-        []() { day_11( "Chronal Charge" ); },
-        []() { day_12( "Subterranean Sustainability" ); },
-        []() { day_13( "Mine Cart Madness" ); },
-        []() { day_14( "Chocolate Charts" ); },
-        []() { day_15( "Beverage Bandits" ); },
-        []() { day_16( "Chronal Classification" ); },
-        []() { day_17( "Reservoir Research" ); },
-        []() { day_18( "Settlers of The North Pole" ); },
-        []() { day_19( "Go With The Flow" ); },
-        []() { day_20( "A Regular Map" ); },
-        []() { day_21( "Chronal Conversion" ); },
-        []() { day_22( "Mode Maze" ); },
-        []() { day_23( "Experimental Emergency Teleportation" ); },
-        []() { day_24( "Immune System Simulator 20XX" ); },
-        []() { day_25( "Four-Dimensional Adventure" ); }
+const aoc::day_table& aoc::y2018::days() {
+    const static auto advent_of_code_2018 = aoc::day_table{
+        { "Chronal Calibration", day_01 },
+        { "Inventory Management System", day_02 },
+        { "No Matter How You Slice It", day_03 },
+        { "Repose Record", day_04 },
+        { "Alchemical Reduction", day_05 },
+        { "Chronal Coordinates", day_06 },
+        { "The Sum of Its Parts", day_07 },
+        { "Memory Maneuver", day_08 },
+        { "Marble Mania", day_09 },
+        { "The Stars Align", day_10 },
+        { "Chronal Charge", day_11 },
+        { "Subterranean Sustainability", day_12 },
+        { "Mine Cart Madness", day_13 },
+        { "Chocolate Charts", day_14 },
+        { "Beverage Bandits", day_15 },
+        { "Chronal Classification", day_16 },
+        { "Reservoir Research", day_17 },
+        { "Settlers of The North Pole", day_18 },
+        { "Go With The Flow", day_19 },
+        { "A Regular Map", day_20 },
+        { "Chronal Conversion", day_21 },
+        { "Mode Maze", day_22 },
+        { "Experimental Emergency Teleportation", day_23 },
+        { "Immune System Simulator 20XX", day_24 },
+        { "Four-Dimensional Adventure", day_25 }
     };
-    
-    auto index = day - 1;
-    if (index < 0) {
-        std::print("invalid day: {0}\n", day);
-        return;
-    }
-
-    if (index < advent_of_code_2018.size()) {
-        advent_of_code_2018[index]();
-    }
-    else {
-        std::print("Day {0} is not complete.\n", day);
-    }
+    return advent_of_code_2018;
 }
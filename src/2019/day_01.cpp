@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -26,32 +25,34 @@ namespace {
 
 }
 
-void aoc::y2019::day_01(const std::string& title) {
-
-    auto nums = aoc::file_to_string_vector(aoc::input_path(2019, 1)) | rv::transform(
-        [](auto&& str) {return std::stoi(str); }
-    ) | r::to<std::vector<int>>();
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}",
-        r::fold_left(
-            nums | rv::transform(
+aoc::solver_ptr aoc::y2019::day_01() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2019, 1)) | rv::transform(
+                [](auto&& str) {return std::stoi(str); }
+            ) | r::to<std::vector<int>>();
+        },
+        [](const auto& nums) {
+            return r::fold_left(
+                nums | rv::transform(
+                        [](int mass) {
+                            return required_fuel(mass, false); 
+                        }
+                    ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& nums) {
+            return r::fold_left(
+                nums | rv::transform(
                     [](int mass) {
-                        return required_fuel(mass, false); 
+                        return required_fuel(mass, true); 
                     }
                 ),
-            0,
-            std::plus<>()
-        )
+                0,
+                std::plus<>()
+            );
+        }
     );
-    std::println("  part 2: {}",
-        r::fold_left(
-            nums | rv::transform(
-                [](int mass) {
-                    return required_fuel(mass, true); 
-                }
-            ),
-            0,
-            std::plus<>()
-        ));
 }
\ No newline at end of file
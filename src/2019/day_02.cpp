@@ -1,9 +1,9 @@
 #include "../util/util.h"
 #include "y2019.h"
 #include "intcode.h"
+#include "intcode_batch.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <tuple>
@@ -25,13 +25,24 @@ namespace {
         return intcode.value(0);
     }
 
+    // runs every noun and verb at once across a batch, which shares the decoded
+    // program between the runs.
     std::tuple<int64_t, int64_t> find_noun_and_verb(const std::vector<int64_t>& memory, int target) {
-        for (auto [noun, verb] : rv::cartesian_product(rv::iota(0, 100), rv::iota(0, 100))) {
-            if (run_program(memory, noun, verb) == target) {
-                return { noun, verb };
+        aoc::intcode_batch batch(memory);
+        auto results = batch.map(100 * 100,
+            [](aoc::intcode_computer& intcode, size_t i) {
+                intcode.value(1) = static_cast<int64_t>(i / 100);
+                intcode.value(2) = static_cast<int64_t>(i % 100);
+                intcode.run();
+                return intcode.value(0);
             }
+        );
+        auto iter = r::find(results, target);
+        if (iter == results.end()) {
+            throw std::runtime_error("target not found");
         }
-        throw std::runtime_error("target not found");
+        auto i = iter - results.begin();
+        return { i / 100, i % 100 };
     }
 
     int score_noun_and_verb(const std::vector<int64_t>& memory, int target) {
@@ -40,22 +51,19 @@ namespace {
     }
 }
 
-void aoc::y2019::day_02(const std::string& title) {
-
-    auto inp = split(
-            aoc::file_to_string(aoc::input_path(2019, 2)), ','
-        ) | rv::transform(
-            [](auto&& str)->int64_t {
-                return std::stoi(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 2: {} ---", title);
-
-    std::println("  part 1: {}",
-        run_program( inp, 12, 2 )
-    );
-    std::println("  part 2: {}",
-        score_noun_and_verb(inp, 19690720)
+aoc::solver_ptr aoc::y2019::day_02() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 2));
+            return aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return run_program( inp, 12, 2 );
+        },
+        [](const auto& inp) {
+            return score_noun_and_verb(inp, 19690720);
+        }
     );
 }
\ No newline at end of file
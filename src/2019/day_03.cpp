@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/functional/hash.hpp>
@@ -134,19 +133,20 @@ namespace {
     }
 }
 
-void aoc::y2019::day_03(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2019, 3)
-        ) | rv::transform(
-            to_instructions
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 3: {} ---", title);
-    std::println("  part 1: {}",
-        closest_intersection(inp.front(), inp.back(), true)
-    );
-    std::println("  part 2: {}",
-        closest_intersection(inp.front(), inp.back(), false)
+aoc::solver_ptr aoc::y2019::day_03() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2019, 3)
+                ) | rv::transform(
+                    to_instructions
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return closest_intersection(inp.front(), inp.back(), true);
+        },
+        [](const auto& inp) {
+            return closest_intersection(inp.front(), inp.back(), false);
+        }
     );
 }
\ No newline at end of file
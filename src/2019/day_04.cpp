@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -57,27 +56,28 @@ namespace {
     }
 }
 
-void aoc::y2019::day_04(const std::string& title) {
-
-    auto inp = aoc::split(
-            aoc::file_to_string(aoc::input_path(2019, 4)), '-'
-        ) | rv::transform(
-            [](auto&& str) {return std::stoi(str); }
-        ) | r::to<std::vector<int>>();
-
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}",
-        count_valid( inp.front(), inp.back(),
-            [](int num)->bool {
-                return is_increasing(num) && contains_adjacent_duplicate(num);
-            }
-        )
-    );
-    std::println("  part 2: {}",
-        count_valid(inp.front(), inp.back(),
-            [](int num)->bool {
-                return is_increasing(num) && contains_unique_adj_duplicate(num);
-            }
-        )
+aoc::solver_ptr aoc::y2019::day_04() {
+    return aoc::make_solver(
+        []() {
+            return aoc::split(
+                    aoc::file_to_string(aoc::input_path(2019, 4)), '-'
+                ) | rv::transform(
+                    [](auto&& str) {return std::stoi(str); }
+                ) | r::to<std::vector<int>>();
+        },
+        [](const auto& inp) {
+            return count_valid( inp.front(), inp.back(),
+                [](int num)->bool {
+                    return is_increasing(num) && contains_adjacent_duplicate(num);
+                }
+            );
+        },
+        [](const auto& inp) {
+            return count_valid(inp.front(), inp.back(),
+                [](int num)->bool {
+                    return is_increasing(num) && contains_unique_adj_duplicate(num);
+                }
+            );
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -98,17 +97,18 @@ namespace {
     }
 }
 
-void aoc::y2019::day_06(const std::string& title) {
-
-    auto inp = build_orbit_graph(
-        aoc::file_to_string_vector(aoc::input_path(2019, 6))
-    );
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}",
-        count_orbits(inp)
-    );
-    std::println("  part 2: {}",
-        shortest_path(inp, inp["YOU"].parent, inp["SAN"].parent)
+aoc::solver_ptr aoc::y2019::day_06() {
+    return aoc::make_solver(
+        []() {
+            return build_orbit_graph(
+                aoc::file_to_string_vector(aoc::input_path(2019, 6))
+            );
+        },
+        [](auto inp) {
+            return count_orbits(inp);
+        },
+        [](auto inp) {
+            return shortest_path(inp, inp["YOU"].parent, inp["SAN"].parent);
+        }
     );
 }
\ No newline at end of file
@@ -1,9 +1,10 @@
 #include "../util/util.h"
 #include "y2019.h"
 #include "intcode.h"
+#include "intcode_pipeline.h"
+#include "intcode_batch.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <algorithm>
@@ -17,94 +18,85 @@ namespace {
 
     using phase_setting_seq = std::array<int, 5>;
 
-    int generate_output_signal(const std::vector<int64_t>& program, const phase_setting_seq& seq) {
+    std::vector<phase_setting_seq> permutations(phase_setting_seq seq) {
+        std::vector<phase_setting_seq> perms;
+        do {
+            perms.push_back(seq);
+        } while (r::next_permutation(seq).found);
+        return perms;
+    }
+
+    // each amplifier is a copy of icc, which has not yet run.
+    int generate_output_signal(const aoc::intcode_computer& icc, const phase_setting_seq& seq) {
         int phase_inp = 0;
         for (int phase_setting : seq) {
             aoc::input_buffer prog_inp({ phase_setting, phase_inp });
-            aoc::intcode_computer icc(program);
-            icc.run(prog_inp);
-            phase_inp = icc.output();
+            auto amp = icc;
+            amp.run(prog_inp);
+            phase_inp = amp.output();
         }
         return phase_inp;
     }
 
-    int max_output_signal(const std::vector<int64_t>& program) {
-        phase_setting_seq permutation = { 0,1,2,3,4 };
-        int max_signal = 0;
-        
-        do {
-            int output = generate_output_signal(program, permutation);
-            max_signal = std::max(max_signal, output);
-        } while (r::next_permutation(permutation).found);
-
-        return max_signal;
-    }
-
     int generate_output_signal_with_feedback(
-            const std::vector<int64_t>& program, const phase_setting_seq& seq) {
+            const aoc::intcode_computer& icc, const phase_setting_seq& seq) {
 
-        std::array<aoc::intcode_computer, 5> amp = {{
-            {program},{program},{program},{program},{program},
-        }};
+        std::vector<aoc::intcode_computer> amps(5, icc);
+        aoc::intcode_scheduler scheduler;
 
+        std::array<aoc::intcode_channel*, 5> wires;
         for (auto [index, phase_setting] : rv::enumerate(seq)) {
-            auto event = amp[index].run_until_event(phase_setting);
-            if (event != aoc::received_input) {
-                throw std::runtime_error("error priming amps");
-            }
+            wires[index] = &scheduler.make_channel();
+            wires[index]->push(phase_setting);
         }
+        wires[0]->push(0);
 
-        bool initialized = false;
-        int curr_amp_index = 0;
-        bool done = false;
-        while (!done) {
-            int prev_amp_index = (curr_amp_index > 0) ? curr_amp_index - 1 : 4;
-            int input = (!initialized) ? 0 : amp[prev_amp_index].output();
-            initialized = true;
-
-            aoc::icc_event next_event = aoc::terminated;
-            do {
-                next_event = amp[curr_amp_index].run_until_event(input);
-            } while (next_event == aoc::received_input);
-
-            done = next_event == aoc::terminated;
-            curr_amp_index = (curr_amp_index + 1) % 5;
+        for (int i = 0; i < 5; ++i) {
+            scheduler.spawn(amps[i], *wires[i], *wires[(i + 1) % 5]);
+        }
+        if (!scheduler.run()) {
+            throw std::runtime_error("amplifiers deadlocked");
         }
 
-        return amp[4].output();
+        // the last amplifier's final signal is left unread on the first wire.
+        return static_cast<int>(wires[0]->pop());
     }
 
-    int max_output_signal_with_feedback(const std::vector<int64_t>& program) {
-        phase_setting_seq permutation = { 5,6,7,8,9 };
-        int max_signal = 0;
+    // tries every permutation of the phase settings at once across a batch.
+    template<typename Fn>
+    int max_signal(const std::vector<int64_t>& program, const phase_setting_seq& phases, Fn signal) {
+        auto perms = permutations(phases);
+        aoc::intcode_batch batch(program);
+        auto signals = batch.map(perms.size(),
+            [&](const aoc::intcode_computer& icc, size_t i) {
+                return signal(icc, perms[i]);
+            }
+        );
+        return r::max(signals);
+    }
 
-        do {
-            int output = generate_output_signal_with_feedback( program, permutation );
-            max_signal = std::max(max_signal, output);
-        } while (r::next_permutation(permutation).found);
+    int max_output_signal(const std::vector<int64_t>& program) {
+        return max_signal(program, { 0,1,2,3,4 }, generate_output_signal);
+    }
 
-        return max_signal;
+    int max_output_signal_with_feedback(const std::vector<int64_t>& program) {
+        return max_signal(program, { 5,6,7,8,9 }, generate_output_signal_with_feedback);
     }
 }
 
-void aoc::y2019::day_07(const std::string& title) {
-
-    auto instructions = split(
-            aoc::file_to_string(aoc::input_path(2019, 7)), ','
-        ) | rv::transform(
-            [](auto&& str)->int64_t {
-                return std::stoi(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 7: {} ---", title);
-
-    std::println("  part 1: {}",
-        max_output_signal( instructions )
-    );
-
-    std::println("  part 2: {}",
-        max_output_signal_with_feedback( instructions )
+aoc::solver_ptr aoc::y2019::day_07() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 7));
+            return aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+        },
+        [](const auto& instructions) {
+            return max_output_signal( instructions );
+        },
+        [](const auto& instructions) {
+            return max_output_signal_with_feedback( instructions );
+        }
     );
-
 }
\ No newline at end of file
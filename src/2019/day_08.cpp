@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -71,32 +70,38 @@ namespace {
 
         return output;
     }
-}
-
-void aoc::y2019::day_08(const std::string& title) {
 
-    auto img = to_space_image(
-            aoc::file_to_string(
-                    aoc::input_path(2019, 8)
-                ) | rv::transform(
-                    [](auto ch) {return ch - '0'; }
-                ) | r::to<std::vector<int>>(), 
-            25, 
-            6
-        );
+    std::string image_to_string(const image_layer& img) {
+        return img | rv::transform(
+                [](const auto& row) {
+                    return row | rv::transform(
+                            [](int pix) {
+                                return (pix == 1) ? '#' : ' ';
+                            }
+                        ) | r::to<std::string>();
+                }
+            ) | rv::join_with('\n') | r::to<std::string>();
+    }
+}
 
-    std::println("--- Day 8: {} ---\n", title);
-    std::println("  part 1: {}",
-        verify_image(img)
-    );
-    std::println("  part 2:\n"
-    );
-    auto output = decode_image(img);
-    for (const auto& row : output) {
-        std::print("  ");
-        for (const auto& pix : row) {
-            std::print("{}", (pix == 1) ? '#' : ' ');
+aoc::solver_ptr aoc::y2019::day_08() {
+    return aoc::make_solver(
+        []() {
+            return to_space_image(
+                aoc::file_to_string(
+                        aoc::input_path(2019, 8)
+                    ) | rv::transform(
+                        [](auto ch) {return ch - '0'; }
+                    ) | r::to<std::vector<int>>(), 
+                25, 
+                6
+            );
+        },
+        [](const auto& img) {
+            return verify_image(img);
+        },
+        [](const auto& img) {
+            return image_to_string(decode_image(img));
         }
-        std::println("");
-    }
+    );
 }
\ No newline at end of file
@@ -3,7 +3,6 @@
 #include "intcode.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -21,21 +20,19 @@ namespace {
     }
 }
 
-void aoc::y2019::day_09(const std::string& title) {
-
-    auto instructions = split(
-            aoc::file_to_string(aoc::input_path(2019, 9)), ','
-        ) | rv::transform(
-            [](auto&& str)->int64_t {
-                return std::stoi(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 9: {} ---\n", title);
-    std::println("  part 1: {}",
-        run_boost_program(instructions, 1)
-    );
-    std::println("  part 2: {}",
-        run_boost_program(instructions, 2)
+aoc::solver_ptr aoc::y2019::day_09() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 9));
+            return aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+        },
+        [](const auto& instructions) {
+            return run_boost_program(instructions, 1);
+        },
+        [](const auto& instructions) {
+            return run_boost_program(instructions, 2);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <numbers>
@@ -152,21 +151,21 @@ namespace {
 /*------------------------------------------------------------------------------------------------*/
 
 
-void aoc::y2019::day_10(const std::string& title) {
-
-    auto inp = grid_to_point_set(
-            aoc::file_to_string_vector(aoc::input_path(2019, 10))
-        );
-
-    std::println("--- Day 10: {} ---\n", title);
-
-    auto [location, count] = point_with_max_visible_points(inp);
-
-    std::println("  part 1: {}", count);
-
-    auto two_hundreth_destroyed = nth_destroyed_point(inp, location, 200);
-    std::println("  part 2: {}",
-        100 * two_hundreth_destroyed.x + two_hundreth_destroyed.y
+aoc::solver_ptr aoc::y2019::day_10() {
+    return aoc::make_solver(
+        []() {
+            return grid_to_point_set(
+                aoc::file_to_string_vector(aoc::input_path(2019, 10))
+            );
+        },
+        [](const auto& inp) {
+            auto [location, count] = point_with_max_visible_points(inp);
+            return count;
+        },
+        [](const auto& inp) {
+            auto [location, count] = point_with_max_visible_points(inp);
+            auto two_hundreth_destroyed = nth_destroyed_point(inp, location, 200);
+            return 100 * two_hundreth_destroyed.x + two_hundreth_destroyed.y;
+        }
     );
-
 }
\ No newline at end of file
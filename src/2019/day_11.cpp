@@ -3,7 +3,6 @@
 #include "intcode.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -136,7 +135,7 @@ namespace {
         return static_cast<int>(painted_at_least_once.size());
     }
 
-    void print_registration_identifier(const std::vector<int64_t>& instructions) {
+    std::string registration_identifier(const std::vector<int64_t>& instructions) {
         point_set white_panels;
         point_set test;
         white_panels.insert({ 0,0 });
@@ -153,30 +152,23 @@ namespace {
             canvas[pt.y - y][pt.x - x] = '#';
         }
 
-        for (auto&& row : canvas) {
-            std::print("  ");
-            for (auto ch : row) {
-                std::print("{}", ch);
-            }
-            std::println("");
-        }
+        return canvas | rv::join_with('\n') | r::to<std::string>();
     }
 }
 
-void aoc::y2019::day_11(const std::string& title) {
-
-    auto inp = split(
-        aoc::file_to_string(aoc::input_path(2019, 11)), ','
-    ) | rv::transform(
-        [](auto&& str)->int64_t {
-            return aoc::string_to_int64(str);
+aoc::solver_ptr aoc::y2019::day_11() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 11));
+            return aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return panels_painted_at_least_once(inp);
+        },
+        [](const auto& inp) {
+            return registration_identifier(inp);
         }
-    ) | r::to<std::vector>();
-
-    std::println("--- Day 11: {} ---", title);
-    std::println("  part 1: {}",
-        panels_painted_at_least_once(inp)
     );
-    std::println("  part 2:\n");
-    print_registration_identifier(inp);
 }
\ No newline at end of file
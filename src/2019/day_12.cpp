@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <numeric>
@@ -146,25 +145,24 @@ namespace {
     }
  }
 
-void aoc::y2019::day_12(const std::string& title) {
-
-    auto initial_sys_state = parse_system_state(
-            aoc::file_to_string_vector(aoc::input_path(2019, 12))
-        );
-
-    std::println("--- Day 12: {} ---", title);
-
-    std::println("  part 1: {}",
-        energy_after_n_timesteps(initial_sys_state, 1000)
-    );
-
-    std::println("  part 2: {}",
-        std::lcm( 
-            find_cycle_on_axis(initial_sys_state[0]),
-            std::lcm(
-                find_cycle_on_axis(initial_sys_state[1]),
-                find_cycle_on_axis(initial_sys_state[2])
-            )
-        )
+aoc::solver_ptr aoc::y2019::day_12() {
+    return aoc::make_solver(
+        []() {
+            return parse_system_state(
+                    aoc::file_to_string_vector(aoc::input_path(2019, 12))
+                );
+        },
+        [](auto initial_sys_state) {
+            return energy_after_n_timesteps(initial_sys_state, 1000);
+        },
+        [](auto initial_sys_state) {
+            return std::lcm( 
+                find_cycle_on_axis(initial_sys_state[0]),
+                std::lcm(
+                    find_cycle_on_axis(initial_sys_state[1]),
+                    find_cycle_on_axis(initial_sys_state[2])
+                )
+            );
+        }
     );
 }
\ No newline at end of file
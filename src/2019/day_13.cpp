@@ -3,7 +3,6 @@
 #include "intcode.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <deque>
@@ -161,7 +160,7 @@ namespace {
 
             frame(const aoc::intcode_computer& i, HBITMAP bmp) : 
                 complete(false), 
-                pre_input(i), 
+                pre_input(i.fork()), 
                 frame_buffer(bmp) {
             }
 
@@ -363,7 +362,7 @@ namespace {
         }
 
         void receive_input(user_input inp) {
-            frames_.back().post_input = frames_.back().pre_input;
+            frames_.back().post_input = frames_.back().pre_input.fork();
             auto result = frames_.back().post_input->run_until_event(
                 static_cast<int64_t>(inp)
             );
@@ -472,26 +471,24 @@ namespace {
 #endif
 }
 
-void aoc::y2019::day_13(const std::string& title) {
-
-    auto inp = split(
-            aoc::file_to_string(aoc::input_path(2019, 13)), ','
-        ) | rv::transform(
-            [](auto&& str)->int64_t {
-                return std::stoi(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 13: {} ---", title);
-    std::println("  part 1: {}",
-        count_blocks(inp)
-    );
-
+aoc::solver_ptr aoc::y2019::day_13() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 13));
+            return aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return count_blocks(inp);
+        },
+        [](const auto& inp) {
 #ifdef WIN32
-    std::println("  part 2: <see game window>" );
-    run_game(inp);
+            run_game(inp);
+            return "<see game window>";
 #else
-    std::println("  part 2: <sorry only a Windows implementation here>");
+            return "<sorry only a Windows implementation here>";
 #endif
-    
+        }
+    );
 }
\ No newline at end of file
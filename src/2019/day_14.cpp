@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -179,19 +178,22 @@ namespace {
     }
 }
 
-void aoc::y2019::day_14(const std::string& title) {
-
-    auto reactions = make_recipe_table(
-            aoc::file_to_string_vector(
-                aoc::input_path(2019, 14)
-            ) | rv::transform(
-                parse_reaction
-            ) | r::to<std::vector<reaction>>()
-        );
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}", minimum_ore_for_fuel(reactions, 1));
-    std::println("  part 2: {}",
-        maximum_fuel_from_given_ore(reactions, 1000000000000)
+aoc::solver_ptr aoc::y2019::day_14() {
+    return aoc::make_solver(
+        []() {
+            return make_recipe_table(
+                    aoc::file_to_string_vector(
+                        aoc::input_path(2019, 14)
+                    ) | rv::transform(
+                        parse_reaction
+                    ) | r::to<std::vector<reaction>>()
+                );
+        },
+        [](const auto& reactions) {
+            return minimum_ore_for_fuel(reactions, 1);
+        },
+        [](const auto& reactions) {
+            return maximum_fuel_from_given_ore(reactions, 1000000000000);
+        }
     );
 }
\ No newline at end of file
@@ -1,13 +1,12 @@
 #include "../util/util.h"
+#include "../util/graph_search.h"
 #include "y2019.h"
 #include "intcode.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
-#include <queue>
 
 #include <boost/functional/hash.hpp>
 
@@ -74,13 +73,6 @@ namespace {
 
     using computer = aoc::intcode_computer;
 
-    struct state {
-        computer icc;
-        point loc;
-        int dist;
-        bool is_on_goal;
-    };
-
     move_result run_robot(computer& robot, direction dir) {
         move_result result;
         robot.run_until_event(static_cast<int64_t>(dir));
@@ -88,102 +80,85 @@ namespace {
         return static_cast<move_result>(robot.output());
     }
 
-    std::vector<state> adjacent_states(const state& state) {
-        std::vector<::state> output;
-        for (auto dir : directions()) {
-            auto robot = state.icc;
-            auto result = run_robot(robot, dir);
-            if (result == moved || result == moved_to_goal) {
-                output.emplace_back(
-                    robot,
-                    state.loc + dir_to_delta(dir),
-                    state.dist + 1,
-                    result == moved_to_goal
-                );
-            }
-        }
-        return output;
-    }
-
     struct traversal_info {
         int shortest_path;
         point_set map;
         point goal_location;
     };
 
+    // a breadth-first search of the locations, keeping a robot at each location
+    // found to try the moves from there.
     traversal_info perform_traversal(const std::vector<int64_t>& program) {
 
         traversal_info ti;
+        std::unordered_map<point, computer, point_hash> robots;
+        robots.emplace(point{ 0,0 }, computer{ program });
+
+        auto result = aoc::breadth_first_search(
+            point{ 0,0 },
+            [&](const point& loc) {
+                std::vector<point> open;
+                for (auto dir : directions()) {
+                    auto robot = robots.at(loc).fork();
+                    auto outcome = run_robot(robot, dir);
+                    if (outcome == blocked) {
+                        continue;
+                    }
+                    auto adj = loc + dir_to_delta(dir);
+                    if (outcome == moved_to_goal) {
+                        ti.goal_location = adj;
+                    }
+                    robots.try_emplace(adj, std::move(robot));
+                    open.push_back(adj);
+                }
+                return open;
+            },
+            aoc::no_goal{},
+            aoc::hashed_states<point, point_hash>{}
+        );
 
-        std::queue<state> queue;
-        queue.push({ computer{program}, {0,0}, 0, false });
-
-        while (!queue.empty()) {
-            auto state = queue.front();
-            queue.pop();
-
-            if (ti.map.contains(state.loc)) {
-                continue;
-            }
-            ti.map.insert(state.loc);
-
-            if (state.is_on_goal) {
-                ti.goal_location = state.loc;
-                ti.shortest_path = state.dist;
-            }
-
-            for (const auto& adj : adjacent_states(state)) {
-                queue.push(adj);
-            }
-         
-        }
+        ti.map = result.visited() | r::to<point_set>();
+        ti.shortest_path = *result.distance(ti.goal_location);
         return ti;
     }
 
-    point_set new_frontier(const point_set& old_frontier, const point_set& open_locations) {
-        point_set new_frontier;
-        for (auto pt : old_frontier) {
-            for (auto delta : directions() | rv::transform(dir_to_delta)) {
-                auto new_pt = pt + delta;
-                if (open_locations.contains(new_pt)) {
-                    new_frontier.insert(new_pt);
-                }
-            }
-        }
-        return new_frontier;
-    }
-
+    // the time for oxygen to fill the map is the distance to its farthest
+    // location, which the search settles last.
     int flood_fill_duration(const point& seed, const point_set& map) {
-        auto open_locations = map;
-        point_set frontier;
-        frontier.insert(seed);
-        int time_step = 0;
-        while (!open_locations.empty()) {
-            for (auto pt : frontier) {
-                open_locations.erase(pt);
-            }
-            frontier = new_frontier(frontier, open_locations);
-            ++time_step;
-        }
-        return time_step - 1;
+        auto result = aoc::breadth_first_search(
+            seed,
+            [&](const point& loc) {
+                return directions() | rv::transform(
+                    [loc](auto dir) {
+                        return loc + dir_to_delta(dir);
+                    }
+                ) | rv::filter(
+                    [&](auto&& pt) {
+                        return map.contains(pt);
+                    }
+                );
+            },
+            aoc::no_goal{},
+            aoc::hashed_states<point, point_hash>{}
+        );
+        return *result.distance(result.visited().back());
     }
 }
 
-void aoc::y2019::day_15(const std::string& title) {
-
-    auto program = split(
-            aoc::file_to_string(aoc::input_path(2019, 15)), ','
-        ) | rv::transform(
-            [](auto&& str)->int64_t {
-                return aoc::string_to_int64(str);
-            }
-        ) | r::to<std::vector>();
-
-    auto trav_info = perform_traversal(program);
-
-    std::println("--- Day 15: {} ---", title);
-    std::println("  part 1: {}", trav_info.shortest_path);
-    std::println("  part 2: {}",
-        flood_fill_duration(trav_info.goal_location, trav_info.map)
+aoc::solver_ptr aoc::y2019::day_15() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 15));
+            auto program = aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+            return perform_traversal(program);
+        },
+        [](const auto& trav_info) {
+            return trav_info.shortest_path;
+        },
+        [](const auto& trav_info) {
+            return flood_fill_duration(trav_info.goal_location, trav_info.map);
+        }
     );
 }
\ No newline at end of file
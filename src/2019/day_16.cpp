@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <sstream>
@@ -93,26 +92,25 @@ namespace {
     }
 }
 
-void aoc::y2019::day_16(const std::string& title) {
-    auto inp_str = aoc::file_to_string(aoc::input_path(2019, 16));
-
-    auto inp = inp_str | rv::filter(
-            [](char ch) {return std::isdigit(ch); }
-        ) | rv::transform(
-            [](char ch)->int { return ch - '0'; }
-        ) | r::to<std::vector<int>>();
-
-    std::println("--- Day 1: {} ---", title);
-
-    std::println("  part 1: {}",
-        first_n_digits( fft(inp, { 0, 1, 0, -1 }, 100), 8)
-    );
-
-    seq_generator gen = [&inp](int i) { return inp[i % inp.size()]; };
-    std::println("  part 2: {}",
-        first_n_digits(
-            fast_fft(gen, first_n_digits(inp,7), inp.size() * 10000, 100),
-            8
-        )
+aoc::solver_ptr aoc::y2019::day_16() {
+    return aoc::make_solver(
+        []() {
+            auto inp_str = aoc::file_to_string(aoc::input_path(2019, 16));
+            return inp_str | rv::filter(
+                    [](char ch) {return std::isdigit(ch); }
+                ) | rv::transform(
+                    [](char ch)->int { return ch - '0'; }
+                ) | r::to<std::vector<int>>();
+        },
+        [](const auto& inp) {
+            return first_n_digits( fft(inp, { 0, 1, 0, -1 }, 100), 8);
+        },
+        [](const auto& inp) {
+            seq_generator gen = [&inp](int i) { return inp[i % inp.size()]; };
+            return first_n_digits(
+                fast_fft(gen, first_n_digits(inp,7), inp.size() * 10000, 100),
+                8
+            );
+        }
     );
 }
\ No newline at end of file
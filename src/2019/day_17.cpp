@@ -3,7 +3,6 @@
 #include "intcode.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <format>
 #include <fstream>
 #include <ranges>
@@ -94,26 +93,25 @@ namespace {
     }
 }
 
-void aoc::y2019::day_17(const std::string& title) {
-
-    auto program = split(
-            aoc::file_to_string(aoc::input_path(2019, 17)), ','
-        ) | rv::transform(
-            [](auto&& str)->int64_t {
-                return aoc::string_to_int64(str);
-            }
-        ) | r::to<std::vector>();
-
-    auto grid = generate_grid(program);
-
-    std::println("--- Day 17: {} ---", title);
-
-    std::println("  part 1: {}",
-        calculate_alignment_parameters(
-            find_intersections(grid) 
-        )
+aoc::solver_ptr aoc::y2019::day_17() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 17));
+            auto program = aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+            auto grid = generate_grid(program);
+            return std::tuple{ std::move(program), std::move(grid) };
+        },
+        [](const auto& inp) {
+            const auto& [program, grid] = inp;
+            return calculate_alignment_parameters(
+                find_intersections(grid) 
+            );
+        },
+        [](const auto& inp) {
+            const auto& [program, grid] = inp;
+            return do_part_2(program);
+        }
     );
-
-    std::println("  part 2: {}", do_part_2(program) );
-    
 }
\ No newline at end of file
@@ -1,13 +1,12 @@
 #include "../util/util.h"
+#include "../util/graph_search.h"
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
 #include <set>
-#include <queue>
 #include <boost/functional/hash.hpp>
 
 namespace r = std::ranges;
@@ -72,51 +71,42 @@ namespace {
         int dist;
     };
     
+    // the items reachable from start without passing another item, other than a
+    // robot's starting location, with their distances.
     std::vector<tunnel> find_tunnels(
             const point_set& hallways, const point& start, const vault_item_map& items) {
 
-        struct state {
-            point loc;
-            int dist;
+        auto blocks = [&](const point& loc) {
+            auto iter = items.find(loc);
+            if (loc == start || iter == items.end()) {
+                return false;
+            }
+            auto item = iter->second;
+            return item != '@' && item != '$' && item != '%' && item != '&';
         };
 
-        std::vector<tunnel> tunnels;
         std::array<point, 4> neighborhood = {{ {0,-1},{1,0},{0,1},{-1,0} }};
-        point_set visited;
-        std::queue<state> queue;
-        queue.emplace( start, 0 );
-
-        while (!queue.empty()) {
-            auto current = queue.front();
-            queue.pop();
-
-            if (visited.contains(current.loc)) {
-                continue;
-            }
-            visited.insert(current.loc);
-
-            if (items.contains(current.loc)  && current.dist != 0) {
-                auto item = items.at(current.loc);
-                if (item != '@' && item != '$' && item != '%' && item != '&') {
-                    tunnels.emplace_back(item, current.dist);
-                    continue;
+        auto result = aoc::breadth_first_search(
+            start,
+            [&](const point& loc) {
+                std::vector<point> neighbors;
+                if (!blocks(loc)) {
+                    for (const auto& delta : neighborhood) {
+                        if (hallways.contains(loc + delta)) {
+                            neighbors.push_back(loc + delta);
+                        }
+                    }
                 }
-            }
+                return neighbors;
+            },
+            aoc::no_goal{},
+            aoc::hashed_states<point, point_hash>{}
+        );
 
-            auto neighbors = neighborhood | rv::transform(
-                    [&](auto&& delta)->point {
-                        return current.loc + delta;
-                    }
-                ) | rv::filter(
-                    [&](auto&& pt) {
-                        return hallways.contains(pt);
-                    }
-                );
-            for (const auto& neighbor : neighbors) {
-                queue.emplace(
-                    neighbor,
-                    current.dist + 1
-                );
+        std::vector<tunnel> tunnels;
+        for (const auto& loc : result.visited()) {
+            if (blocks(loc)) {
+                tunnels.emplace_back(items.at(loc), *result.distance(loc));
             }
         }
         return tunnels;
@@ -225,52 +215,25 @@ namespace {
         return ary | rv::join | r::to<std::vector>();
     }
 
-    int find_best_solution(const vault_graph& g, const auto& distance_map) {
-        int num_keys = r::count_if(g | rv::keys, is_key);
-        auto all_keys = distance_map | rv::filter(
-            [num_keys](auto&& state_to_dist) {
-                const auto& [state, distance] = state_to_dist;
-                return state.keys.size() == num_keys;
-            }
-        ) | r::to<std::vector>();
-
-        auto closest = r::min_element(
-            all_keys,
-            [](auto&& lhs, auto&& rhs) {
-                return lhs.second < rhs.second;
-            }
-        );
-
-        return closest->second;
+    size_t count_keys(const vault_graph& g) {
+        return static_cast<size_t>(r::count_if(g | rv::keys, is_key));
     }
 
+    // the search stops at the first state holding every key it settles.
+    template<template<typename, typename> typename Queue>
     int dijkstra_shortest_path_part1(const vault_graph& g) {
-        
-        std::unordered_map<traversal_state, int, traversal_state_hash> dist;
-        aoc::priority_queue<traversal_state, traversal_state_hash> queue;
-        traversal_state start_state = { '@', {} };
-        queue.insert(start_state, 0);
-        dist[start_state] = 0;
-
-        while (!queue.empty()) {
-            auto u = queue.extract_min();
-            for (auto [v, dist_to_v] : neighboring_states(u, g)) {
-                auto dist_to_u = dist.at(u);
-                auto dist_through_u_to_v = dist_to_u + dist_to_v;
-                auto curr_dist_to_v = dist.contains(v) ? dist.at(v) : std::numeric_limits<int>::max();
-
-                if (dist_through_u_to_v < curr_dist_to_v) {
-                    dist[v] = dist_through_u_to_v;
-                    if (queue.contains(v)) {
-                        queue.change_priority(v, dist_through_u_to_v);
-                    } else {
-                        queue.insert(v, dist_through_u_to_v);
-                    }
-                }
-            }
-        }
-
-        return find_best_solution(g, dist);
+        auto num_keys = count_keys(g);
+        auto result = aoc::dijkstra_search<aoc::search_tracking::distances, Queue>(
+            traversal_state{ '@', {} },
+            [&](const traversal_state& u) {
+                return neighboring_states(u, g);
+            },
+            [num_keys](const traversal_state& s) {
+                return s.keys.size() == num_keys;
+            },
+            aoc::hashed_states<traversal_state, traversal_state_hash>{}
+        );
+        return *result.goal_distance();
     }
 
     point find_start(const std::vector<std::string>& grid) {
@@ -367,50 +330,45 @@ namespace {
         return output;
     }
 
+    template<template<typename, typename> typename Queue>
     int dijkstra_shortest_path_part2(const vault_graph& g) {
-        std::unordered_map<multi_trav_state, int, multi_trav_state_hash> dist;
-        aoc::priority_queue<multi_trav_state, multi_trav_state_hash> queue;
-        multi_trav_state start_state = { {{'@','$','%','&'}}, {} };
-        queue.insert(start_state, 0);
-        dist[start_state] = 0;
-
-        while (!queue.empty()) {
-            auto u = queue.extract_min();
-            for (auto [v, dist_to_v] : neighboring_multi_states(u, g)) {
-                auto dist_to_u = dist.at(u);
-                auto dist_through_u_to_v = dist_to_u + dist_to_v;
-                auto curr_dist_to_v = dist.contains(v) ? dist.at(v) : std::numeric_limits<int>::max();
-
-                if (dist_through_u_to_v < curr_dist_to_v) {
-                    dist[v] = dist_through_u_to_v;
-                    if (queue.contains(v)) {
-                        queue.change_priority(v, dist_through_u_to_v);
-                    }
-                    else {
-                        queue.insert(v, dist_through_u_to_v);
-                    }
-                }
-            }
-        }
-
-        return find_best_solution(g, dist);
+        auto num_keys = count_keys(g);
+        auto result = aoc::dijkstra_search<aoc::search_tracking::distances, Queue>(
+            multi_trav_state{ {{'@','$','%','&'}}, {} },
+            [&](const multi_trav_state& u) {
+                return neighboring_multi_states(u, g);
+            },
+            [num_keys](const multi_trav_state& s) {
+                return s.keys.size() == num_keys;
+            },
+            aoc::hashed_states<multi_trav_state, multi_trav_state_hash>{}
+        );
+        return *result.goal_distance();
     }
 }
 
-void aoc::y2019::day_18(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(aoc::input_path(2019, 18));
-    auto part1_graph = grid_to_graph(inp);
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}",
-        dijkstra_shortest_path_part1(part1_graph)
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2019::day_18_with_queue() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2019, 18));
+        },
+        [](const auto& inp) {
+            auto part1_graph = grid_to_graph(inp);
+            return dijkstra_shortest_path_part1<Queue>(part1_graph);
+        },
+        [](const auto& inp) {
+            auto part2_grid = make_part2_grid(inp);
+            auto part2_graph = grid_to_graph(part2_grid);
+            return dijkstra_shortest_path_part2<Queue>(part2_graph);
+        }
     );
+}
 
-    auto part2_grid = make_part2_grid(inp);
-    auto part2_graph = grid_to_graph(part2_grid);
+template aoc::solver_ptr aoc::y2019::day_18_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2019::day_18_with_queue<aoc::indexed_4ary_heap>();
+template aoc::solver_ptr aoc::y2019::day_18_with_queue<aoc::radix_heap>();
 
-    std::println("  part 2: {}",
-        dijkstra_shortest_path_part2(part2_graph)
-    );
+aoc::solver_ptr aoc::y2019::day_18() {
+    return day_18_with_queue<aoc::radix_heap>();
 }
\ No newline at end of file
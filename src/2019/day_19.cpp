@@ -1,9 +1,9 @@
 #include "../util/util.h"
 #include "intcode.h"
+#include "intcode_batch.h"
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -16,17 +16,19 @@ namespace {
 
     using computer = aoc::intcode_computer;
 
+    // probes the whole area at once across a batch.
     int count_tractor_beam(const std::vector<int64_t>& program) {
-        computer c(program);
-        int sum = 0;
+        std::vector<std::vector<int64_t>> points;
         for (int y = 0; y < 50; ++y) {
             for (int x = 0; x < 50; ++x) {
-                auto computer = c;
-                aoc::input_buffer buffer({ x,y });
-                computer.run(buffer);
-                sum += computer.output();
+                points.push_back({ x, y });
             }
         }
+        aoc::intcode_batch batch(program);
+        int sum = 0;
+        for (const auto& output : batch.run(points)) {
+            sum += static_cast<int>(output.back());
+        }
         return sum;
     }
 
@@ -145,8 +147,8 @@ namespace {
         // linear search above the row we got via
         // binary search for the correct result...
 
-        auto beam = [&program](int x, int y) {
-                computer c(program);
+        computer c(program);
+        auto beam = [&c](int x, int y) {
                 return test_point(c, x, y);
             };
 
@@ -165,21 +167,20 @@ namespace {
     }
 }
 
-void aoc::y2019::day_19(const std::string& title) {
-
-    auto program = split(
-        aoc::file_to_string(aoc::input_path(2019, 19)), ','
-    ) | rv::transform(
-        [](auto&& str)->int64_t {
-            return aoc::string_to_int64(str);
+aoc::solver_ptr aoc::y2019::day_19() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 19));
+            return aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+        },
+        [](const auto& program) {
+            return count_tractor_beam(program);
+        },
+        [](const auto& program) {
+            return do_part_2(program);
         }
-    ) | r::to<std::vector>();
-
-    std::println("--- Day 19: {} ---", title);
-
-    std::println("  part 1: {} ", count_tractor_beam(program));
-    std::println("  part 2: {}",
-        do_part_2(program)
     );
 }
     
\ No newline at end of file
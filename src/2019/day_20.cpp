@@ -1,13 +1,12 @@
 #include "../util/util.h"
+#include "../util/graph_search.h"
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <format>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
-#include <queue>
 
 #include <boost/functional/hash.hpp>
 
@@ -177,26 +176,18 @@ namespace {
         }
     };
 
-    using maze_loc_set = std::unordered_set<maze_loc, maze_loc_hash>;
+    std::vector<maze_loc> neighboring_locs(
+            const maze_loc& current, const donut_maze& maze, bool recursive_maze) {
 
-    struct state {
-        maze_loc loc;
-        int dist;
-    };
-
-    std::vector<state> neighboring_states(
-            const state& current, const donut_maze& maze, bool recursive_maze) {
-
-        const auto& adj_list = maze.at(current.loc.node).neighbors;
+        const auto& adj_list = maze.at(current.node).neighbors;
 
         if (!recursive_maze) {
             return adj_list |
                 rv::transform(
-                    [&](auto&& passage)->state {
+                    [&](auto&& passage)->maze_loc {
                         return {
-                            current.loc.level,
-                            passage.dest,
-                            current.dist + 1
+                            current.level,
+                            passage.dest
                         };
                     }
                 ) | r::to<std::vector>();
@@ -204,59 +195,50 @@ namespace {
         return adj_list | 
             rv::filter(
                 [&](auto&& passage)->bool {
-                    if (current.loc.level > 0) {
+                    if (current.level > 0) {
                         return true;
                     }
                     return passage.level_delta >= 0;
                 }
             ) | rv::transform(
-                [&](auto&& passage)->state {
+                [&](auto&& passage)->maze_loc {
                     return {
-                        current.loc.level + passage.level_delta,
-                        passage.dest,
-                        current.dist + 1
+                        current.level + passage.level_delta,
+                        passage.dest
                     };
                 }
             ) | r::to<std::vector>();
     }
 
     int solve_donut_maze(const donut_maze& maze, int start, int finish, bool recursive_maze) {
-        
-        maze_loc_set visited;
-        std::queue<state> queue;
-        queue.emplace(maze_loc{ 0, start }, 0);
-        while (!queue.empty()) {
-            auto current = queue.front();
-            queue.pop();
-
-            if (visited.contains(current.loc)) {
-                continue;
-            }
-            visited.insert(current.loc);
-
-            if (current.loc == maze_loc{0, finish}) {
-                return current.dist;
-            }
-
-            for (const auto& neighbor : neighboring_states(current, maze, recursive_maze)) {
-                queue.push(neighbor);
-            }
-        }
-
-        return -1;
+        auto result = aoc::breadth_first_search(
+            maze_loc{ 0, start },
+            [&](const maze_loc& loc) {
+                return neighboring_locs(loc, maze, recursive_maze);
+            },
+            [finish](const maze_loc& loc) {
+                return loc == maze_loc{ 0, finish };
+            },
+            aoc::hashed_states<maze_loc, maze_loc_hash>{}
+        );
+        return result.goal_distance().value_or(-1);
     }
 }
 
-void aoc::y2019::day_20(const std::string& title) {
-
-    auto grid = aoc::file_to_string_vector( aoc::input_path(2019, 20) );
-    auto [maze, start, finish] = grid_to_donut_maze(grid);
-
-    std::println("--- Day 20: {} ---", title);
-    std::println("  part 1: {}",
-        solve_donut_maze(maze, start, finish, false)
-    );
-    std::println("  part 2: {}", 
-        solve_donut_maze(maze, start, finish, true) 
+aoc::solver_ptr aoc::y2019::day_20() {
+    return aoc::make_solver(
+        []() {
+            auto grid = aoc::file_to_string_vector( aoc::input_path(2019, 20) );
+            auto [maze, start, finish] = grid_to_donut_maze(grid);
+            return std::tuple{ std::move(maze), std::move(start), std::move(finish) };
+        },
+        [](const auto& inp) {
+            const auto& [maze, start, finish] = inp;
+            return solve_donut_maze(maze, start, finish, false);
+        },
+        [](const auto& inp) {
+            const auto& [maze, start, finish] = inp;
+            return solve_donut_maze(maze, start, finish, true);
+        }
     );
 }
\ No newline at end of file
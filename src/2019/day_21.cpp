@@ -50,51 +50,45 @@ namespace {
 
 }
 
-void aoc::y2019::day_21(const std::string& title) {
-
-    auto program = split(
-            aoc::file_to_string(aoc::input_path(2019, 21)), ','
-        ) | rv::transform(
-            [](auto&& str)->int64_t {
-                return aoc::string_to_int64(str);
-            }
-        ) | r::to<std::vector>();
-
-    computer springdroid(program);
-    ;
-
-    
-    std::println("--- Day 21: {} ---", title);
-    std::println("  part 1: {}",
-        run_springdroid(
-            springdroid,
-            "NOT A J\n"  // o_
-
-            "NOT C T\n" // o#?_#
-            "AND A T\n"
-            "AND D T\n"
-
-            "OR T J\n"
-
-            "WALK\n"
-        )
-    );
-    std::println("  part 2: {}",
-        run_springdroid(
-            springdroid,
-            "NOT A J\n"  // o_
-
-            "NOT C T\n" // o#?_#  || o#-?#
-            "NOT T T\n"
-            "AND B T\n"
-            "NOT T T\n"
-            "AND A T\n"
-            "AND D T\n"
-
-            "OR T J\n"
-
-            "RUN\n"
-        )
+aoc::solver_ptr aoc::y2019::day_21() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 21));
+            auto program = aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+            return computer(program);
+        },
+        [](const auto& springdroid) {
+            return run_springdroid(
+                springdroid,
+                "NOT A J\n"  // o_
+
+                "NOT C T\n" // o#?_#
+                "AND A T\n"
+                "AND D T\n"
+
+                "OR T J\n"
+
+                "WALK\n"
+            );
+        },
+        [](const auto& springdroid) {
+            return run_springdroid(
+                springdroid,
+                "NOT A J\n"  // o_
+
+                "NOT C T\n" // o#?_#  || o#-?#
+                "NOT T T\n"
+                "AND B T\n"
+                "NOT T T\n"
+                "AND A T\n"
+                "AND D T\n"
+
+                "OR T J\n"
+
+                "RUN\n"
+            );
+        }
     );
-    
 }
\ No newline at end of file
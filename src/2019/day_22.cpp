@@ -2,7 +2,6 @@
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/multiprecision/cpp_int.hpp>
@@ -162,7 +161,7 @@ namespace {
     }
 }
 
-void aoc::y2019::day_22(const std::string& title) {
+aoc::solver_ptr aoc::y2019::day_22() {
 
     /*
         I couldn't figure part 2 of this one out. This code implements
@@ -171,28 +170,27 @@ void aoc::y2019::day_22(const std::string& title) {
     
     */
 
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2019, 22)
-        ) | rv::transform(
-            str_to_shuffle
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}",
-        to_string(compose_shuffles(inp, 10007)(2019))
-    );
-
-    std::println("  part 2: {}",
-        to_string(
-            invert(
-                pow_compose(
-                    compose_shuffles(inp, 119315717514047),
-                    101741582076661
-                ),
-                2020
-            )
-        )
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2019, 22)
+                ) | rv::transform(
+                    str_to_shuffle
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return to_string(compose_shuffles(inp, 10007)(2019));
+        },
+        [](const auto& inp) {
+            return to_string(
+                invert(
+                    pow_compose(
+                        compose_shuffles(inp, 119315717514047),
+                        101741582076661
+                    ),
+                    2020
+                )
+            );
+        }
     );
-
-
 }
\ No newline at end of file
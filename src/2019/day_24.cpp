@@ -1,11 +1,10 @@
 #include "../util/util.h"
+#include "../util/vec3.h"
 #include "y2019.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
-#include <boost/functional/hash.hpp>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -13,31 +12,8 @@ namespace rv = std::ranges::views;
 /*------------------------------------------------------------------------------------------------*/
 
 namespace {
-    struct vec3 {
-        int x;
-        int y;
-        int z;
-
-        bool operator==(const vec3& v) const {
-            return x == v.x && y == v.y && z == v.z;
-        }
-    };
-
-    vec3 operator+(const vec3& lhs, const vec3& rhs) {
-        return { lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z };
-    }
-
-    struct vec3_hash {
-        size_t operator()(const vec3& v) const {
-            size_t seed = 0;
-            boost::hash_combine(seed, v.x);
-            boost::hash_combine(seed, v.y);
-            boost::hash_combine(seed, v.z);
-            return seed;
-        }
-    };
-
-    using vec3_set = std::unordered_set<vec3, vec3_hash>;
+    using vec3 = aoc::vec3<int>;
+    using vec3_set = aoc::vec3_set<int>;
 
     constexpr int k_dim = 5;
 
@@ -176,16 +152,16 @@ namespace {
     }
 }
 
-void aoc::y2019::day_24(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(aoc::input_path(2019, 24));
-
-
-    std::println("--- Day 24: {} ---", title);
-    std::println("  part 1: {}",
-        do_part_1(inp)
-    );
-    std::println("  part 2: {}",
-        do_part_2(inp)
+aoc::solver_ptr aoc::y2019::day_24() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2019, 24));
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
     );
 }
\ No newline at end of file
@@ -95,9 +95,6 @@ namespace {
                 commands_.push_back(std::format("take {}", items_.at(index)));
             }
             commands_.push_back("west");
-            for (const auto& index : set_indices) {
-                commands_.push_back(std::format("drop {}", items_.at(index)));
-            }
             iter_ = commands_.begin();
             str_ = ss.str();
         }
@@ -126,55 +123,58 @@ namespace {
             "south","west","drop dark matter","drop jam","drop manifold","drop candy cane",
             "drop antenna","drop hypercube","drop dehydrated water","drop bowl of rice"
         };
-        auto cmd_iter = commands.begin();
-        std::vector<std::vector<int>> sets = get_all_subsets();
-        auto sets_iter = sets.begin();
-        std::optional<try_item_set> curr_set;
         int64_t result = -1;
+        auto find_result = [&](std::string str) {
+            auto nums = aoc::extract_numbers_int64(str, false);
+            if (!nums.empty() && nums.front() > 10000) {
+                result = nums.front();
+            }
+        };
 
+        // collect every item, leave them all at the security checkpoint, and then
+        // try each subset from a snapshot of the droid standing there rather than
+        // dropping the items again after each failed attempt.
+        auto cmd_iter = commands.begin();
         run_droid(droid,
             [&]()->std::string {
-                if (cmd_iter != commands.end()) {
-                    auto cmd = *cmd_iter++;
-                    return cmd + '\n';
-                } else {
-                    if (!curr_set || curr_set->is_done()) {
-                        curr_set = try_item_set(*sets_iter);
-                        sets_iter++;
-                    }
-                    auto cmd = curr_set->next_command();
-                    return cmd + '\n';
-                }
+                return (cmd_iter != commands.end()) ? *cmd_iter++ + '\n' : "quit\n";
             },
-            [&](std::string str) {
-                auto nums = aoc::extract_numbers_int64(str, false);
-                if (!nums.empty() && nums.front() > 10000) {
-                    result = nums.front();
-                }
-            }
+            find_result
         );
 
+        auto checkpoint = droid.snapshot();
+        for (const auto& set : get_all_subsets()) {
+            droid.restore(checkpoint);
+            try_item_set attempt(set);
+            run_droid(droid,
+                [&]()->std::string {
+                    return attempt.is_done() ? "quit\n" : attempt.next_command() + '\n';
+                },
+                find_result
+            );
+            if (result >= 0) {
+                break;
+            }
+        }
+
         return result;
     }
 }
 
-void aoc::y2019::day_25(const std::string& title) {
-
-    auto program = split(
-            aoc::file_to_string(aoc::input_path(2019, 25)), ','
-        ) | rv::transform(
-            [](auto&& str)->int64_t {
-                return aoc::string_to_int64(str);
-            }
-        ) | r::to<std::vector>();
-
-    computer droid(program);
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}",
-        run_droid_autopilot(droid)
-    );
-    std::println("  part 2: {}",
-        "<xmas freebie>"
+aoc::solver_ptr aoc::y2019::day_25() {
+    return aoc::make_solver(
+        []() {
+            auto text = aoc::file_to_string(aoc::input_path(2019, 25));
+            auto program = aoc::split_view(text, ',') | rv::transform(
+                    aoc::parse_field<int64_t>
+                ) | r::to<std::vector>();
+            return computer(program);
+        },
+        [](auto droid) {
+            return run_droid_autopilot(droid);
+        },
+        [](const auto&) {
+            return "<xmas freebie>";
+        }
     );
 }
\ No newline at end of file
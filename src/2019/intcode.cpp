@@ -1,7 +1,11 @@
 #include "../util/util.h"
 #include "intcode.h"
+#include "intcode_ops.h"
+#include "intcode_pipeline.h"
+#include "intcode_profile.h"
 #include <functional>
 #include <algorithm>
+#include <format>
 #include <string>
 #include <ranges>
 #include <unordered_map>
@@ -13,240 +17,530 @@ namespace r = std::ranges;
 namespace rv = std::ranges::views;
 
 namespace aoc {
+
+    using namespace intcode_ops;
+
+    // The execution engine. Each address is decoded arithmetically the first time
+    // it is executed into the computer's instruction cache (opcode, parameter modes
+    // and the raw parameter words) and later visits dispatch straight from the
+    // cached instruction through a switch, with no allocation per instruction.
+    //
+    // Decoding also specializes a few idioms into superinstructions: arithmetic or
+    // a comparison whose inputs are both immediate stores a folded constant, a
+    // conditional jump on an immediate is either an unconditional jump or a no-op,
+    // and arithmetic or a comparison into a cell followed by a conditional jump on
+    // that same cell executes as one fused instruction. These still count as the
+    // instructions they replace in ticks() and in a profile.
+    //
+    // Loads from fixed addresses are not folded into constants: the cells they
+    // read are a program's globals, which it writes, so a folded load would need
+    // every write to look for the instructions that read the cell written. Nor
+    // are counted loops over the relative base run as one step; a loop body is
+    // arbitrary code, so beyond the fused compare and jump that closes each
+    // iteration there is no fixed pattern to replace.
+
     class impl {
     public:
 
         using computer = intcode_computer;
+        using instruction = intcode_computer::decoded_instruction;
 
-        enum op_code {
-            terminate_op = 99,
-            add_op = 1,
-            mult_op = 2,
-            inp_op = 3,
-            outp_op = 4,
-            jmp_if_true_op = 5,
-            jmp_if_false_op = 6,
-            less_than_op = 7,
-            equals_op = 8,
-            set_rel_base_op = 9
-        };
+        static void decode(const computer& icc, int64_t addr, instruction& instr) {
+            auto word = icc.memory_.read(addr);
+            if (!is_valid_opcode(word % 100)) {
+                throw std::runtime_error(std::format("invalid opcode {} at address {}", word, addr));
+            }
+            auto decoded = intcode_ops::decode(word);
+            if (!decoded) {
+                throw std::runtime_error(std::format("invalid parameter mode in {} at address {}", word, addr));
+            }
+            for (int i = 0; i < 3; ++i) {
+                instr.modes[i] = static_cast<uint8_t>(decoded->modes[i]);
+                instr.args[i] = (i < decoded->num_args) ? icc.memory_.read(addr + i + 1) : 0;
+            }
+            instr.length = static_cast<uint8_t>(decoded->num_args + 1);
+            instr.op = static_cast<uint8_t>(decoded->op);
+        }
 
-        enum param_mode {
-            position = 0,
-            immediate,
-            relative
-        };
+        // a conditional jump at addr that tests the cell instr writes to, if there
+        // is one. Words that do not decode are left alone, as they may be data.
+        static std::optional<instruction> branch_on_result(
+                const computer& icc, int64_t addr, const instruction& instr) {
+            auto decoded = intcode_ops::decode(icc.memory_.read(addr));
+            if (!decoded || !is_branch(decoded->op) || decoded->modes[0] != instr.modes[2]) {
+                return {};
+            }
+            instruction branch;
+            decode(icc, addr, branch);
+            if (branch.args[0] != instr.args[2]) {
+                return {};
+            }
+            return branch;
+        }
 
-        struct parameter {
-            int64_t val;
-            param_mode mode;
-        };
+        static void specialize(const computer& icc, int64_t addr, instruction& instr) {
+            if (is_branch(instr.op) && instr.modes[0] == immediate) {
+                bool taken = (instr.args[0] != 0) == (instr.op == jmp_if_true_op);
+                instr.base_op = instr.op;
+                instr.op = taken ? jump_op : skip_op;
+                return;
+            }
+            if (!is_arith(instr.op) || instr.modes[2] == immediate) {
+                return;
+            }
+            if (auto branch = branch_on_result(icc, addr + k_arith_length, instr); branch) {
+                instr.base_op = instr.op;
+                instr.branch_if = (branch->op == jmp_if_true_op);
+                instr.target = branch->args[1];
+                instr.target_mode = branch->modes[1];
+                instr.length = k_fused_length;
+                instr.op = fused_branch_op;
+            } else if (instr.modes[0] == immediate && instr.modes[1] == immediate) {
+                instr.args[0] = arith(instr.op, instr.args[0], instr.args[1]);
+                instr.base_op = instr.op;
+                instr.op = const_store_op;
+            }
+        }
 
-        struct instruction {
-            op_code op;
-            std::vector<parameter> parameters;
-        };
+        // returns the instruction by value: executing it may invalidate its cache
+        // entry, which copies the cache if it is shared with another computer.
+        static instruction fetch(computer& icc) {
+            auto addr = icc.program_counter_;
+            if (static_cast<uint64_t>(addr) < icc.icache_.size() && icc.icache_[addr].op) {
+                return icc.icache_[addr];
+            }
+            if (addr < 0) {
+                throw std::runtime_error("bad memory access");
+            }
+            return decode_into_cache(icc, addr);
+        }
 
-        using op_fn = std::function<
-            void(computer&,
-                const std::vector<parameter>& params,
-                const input_fn& inp, const output_fn& out
-                )>;
+        static const instruction& decode_into_cache(computer& icc, int64_t addr) {
+            auto& instr = icc.icache_.writable(addr);
+            decode(icc, addr, instr);
+            specialize(icc, addr, instr);
+            return instr;
+        }
 
+        static int64_t load(const computer& icc, const instruction& instr, int i) {
+            switch (instr.modes[i]) {
+                case immediate:
+                    return instr.args[i];
+                case relative:
+                    return icc.memory_.read(icc.rel_base_ + instr.args[i]);
+                default:
+                    return icc.memory_.read(instr.args[i]);
+            }
+        }
 
-        struct op_def {
-            op_code code;
-            int num_args;
-            op_fn fn;
-        };
+        static int64_t load_target(const computer& icc, const instruction& instr) {
+            switch (instr.target_mode) {
+                case immediate:
+                    return instr.target;
+                case relative:
+                    return icc.memory_.read(icc.rel_base_ + instr.target);
+                default:
+                    return icc.memory_.read(instr.target);
+            }
+        }
 
-        static const int64_t& eval_param_as_ref( const computer& icc, const parameter& p) {
-            if (p.mode == immediate) {
+        // returns the address written.
+        template<typename Hooks>
+        static int64_t store(computer& icc, const instruction& instr, int i, int64_t val, Hooks& hooks) {
+            if (instr.modes[i] == immediate) {
                 throw std::runtime_error("attempted to write to immediate mode param");
             }
-            int64_t base = (p.mode == position) ? 0 : icc.rel_base_;
-            return icc.value(base + p.val);
+            auto addr = instr.args[i] + ((instr.modes[i] == relative) ? icc.rel_base_ : 0);
+            icc.memory_.at(addr) = val;
+            icc.invalidate(addr);
+            hooks.wrote(addr);
+            return addr;
         }
 
-        static int64_t& eval_param_as_ref(computer& icc, const parameter& p) {
-            return const_cast<int64_t&>(
-                eval_param_as_ref(const_cast<const computer&>(icc), p)
-            );
+        // runs until the program terminates or, when the I/O policy asks for it,
+        // until an input or output instruction has executed. io.read returns false
+        // when no input is available and io.can_write returns false when output
+        // cannot be accepted, in which case the instruction is left to run again
+        // later.
+        //
+        // the hooks are told of every instruction executed and every write. An
+        // input or output instruction is only reported once it can complete, and
+        // the jump of a fused instruction through branching once its arithmetic
+        // has not overwritten it.
+        template<typename IO, typename Hooks>
+        static icc_event execute(computer& icc, IO& io, Hooks& hooks) {
+            for (;;) {
+                const auto instr = fetch(icc);
+                if (instr.op != inp_op && instr.op != outp_op) {
+                    hooks.executing(icc, instr);
+                }
+                switch (instr.op) {
+                    case add_op:
+                        store(icc, instr, 2, load(icc, instr, 0) + load(icc, instr, 1), hooks);
+                        break;
+                    case mult_op:
+                        store(icc, instr, 2, load(icc, instr, 0) * load(icc, instr, 1), hooks);
+                        break;
+                    case inp_op: {
+                            int64_t val;
+                            if (!io.read(val)) {
+                                return awaiting_input;
+                            }
+                            hooks.executing(icc, instr);
+                            hooks.received(icc);
+                            ++icc.ticks_;
+                            store(icc, instr, 0, val, hooks);
+                            icc.program_counter_ += instr.length;
+                            if constexpr (IO::stop_on_io) {
+                                return received_input;
+                            }
+                            continue;
+                        }
+                    case outp_op: {
+                            if (!io.can_write()) {
+                                return awaiting_output;
+                            }
+                            hooks.executing(icc, instr);
+                            hooks.sent(icc);
+                            auto val = load(icc, instr, 0);
+                            ++icc.ticks_;
+                            icc.program_counter_ += instr.length;
+                            icc.output_ = val;
+                            io.write(val);
+                            if constexpr (IO::stop_on_io) {
+                                return generated_output;
+                            }
+                            continue;
+                        }
+                    case jmp_if_true_op:
+                        ++icc.ticks_;
+                        if (load(icc, instr, 0)) {
+                            icc.program_counter_ = load(icc, instr, 1);
+                        } else {
+                            icc.program_counter_ += instr.length;
+                        }
+                        continue;
+                    case jmp_if_false_op:
+                        ++icc.ticks_;
+                        if (!load(icc, instr, 0)) {
+                            icc.program_counter_ = load(icc, instr, 1);
+                        } else {
+                            icc.program_counter_ += instr.length;
+                        }
+                        continue;
+                    case less_than_op:
+                        store(icc, instr, 2, (load(icc, instr, 0) < load(icc, instr, 1)) ? 1 : 0, hooks);
+                        break;
+                    case equals_op:
+                        store(icc, instr, 2, (load(icc, instr, 0) == load(icc, instr, 1)) ? 1 : 0, hooks);
+                        break;
+                    case set_rel_base_op:
+                        icc.rel_base_ += load(icc, instr, 0);
+                        break;
+                    case jump_op:
+                        ++icc.ticks_;
+                        icc.program_counter_ = load(icc, instr, 1);
+                        continue;
+                    case skip_op:
+                        break;
+                    case const_store_op:
+                        store(icc, instr, 2, instr.args[0], hooks);
+                        break;
+                    case fused_branch_op: {
+                            auto val = arith(instr.base_op, load(icc, instr, 0), load(icc, instr, 1));
+                            auto addr = store(icc, instr, 2, val, hooks);
+                            ++icc.ticks_;
+                            auto pc = icc.program_counter_;
+                            if (addr >= pc && addr < pc + instr.length) {
+                                // the jump was just overwritten, so run it from a fresh decode
+                                icc.program_counter_ += k_arith_length;
+                                continue;
+                            }
+                            hooks.branching(icc, instr);
+                            ++icc.ticks_;
+                            if ((val != 0) == instr.branch_if) {
+                                icc.program_counter_ = load_target(icc, instr);
+                            } else {
+                                icc.program_counter_ += instr.length;
+                            }
+                            continue;
+                        }
+                    default:
+                        ++icc.ticks_;
+                        return terminated;
+                }
+                ++icc.ticks_;
+                icc.program_counter_ += instr.length;
+            }
         }
 
-        static int64_t eval_param(const computer& icc, const parameter& p) {
-            if (p.mode == immediate) {
-                return p.val;
+        // input and output through callbacks, running to termination.
+        struct callback_io {
+            static constexpr bool stop_on_io = false;
+            const input_fn& inp;
+            const output_fn& out;
+
+            bool read(int64_t& val) {
+                val = inp();
+                return true;
             }
-            return eval_param_as_ref(icc, p);
-        }
 
-        static void do_add_op(computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
+            bool can_write() const {
+                return true;
+            }
 
-            eval_param_as_ref(icc, args[2]) = eval_param(icc, args[0]) + eval_param(icc, args[1]);
-        }
+            void write(int64_t val) {
+                out(val);
+            }
+        };
 
-        static void do_mult_op(computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
+        // at most one input value, stopping after each input or output.
+        struct event_io {
+            static constexpr bool stop_on_io = true;
+            std::optional<int64_t> inp;
 
-            eval_param_as_ref(icc, args[2]) = eval_param(icc, args[0]) * eval_param(icc, args[1]);
-        }
+            bool read(int64_t& val) {
+                if (!inp) {
+                    return false;
+                }
+                val = *inp;
+                inp = {};
+                return true;
+            }
 
-        static void do_inp_op(computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
+            bool can_write() const {
+                return true;
+            }
 
-            eval_param_as_ref(icc, args[0]) = inp();
-        }
+            void write(int64_t) {
+            }
+        };
 
-        static void do_outp_op(computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
+        // reading from and writing to channels, stopping when either would block.
+        struct channel_io {
+            static constexpr bool stop_on_io = false;
+            intcode_channel& inp;
+            intcode_channel& out;
 
-            auto output_val = eval_param(icc, args[0]);
-            icc.output_ = output_val;
-            out(output_val);
-        }
+            bool read(int64_t& val) {
+                if (inp.empty()) {
+                    return false;
+                }
+                val = inp.pop();
+                return true;
+            }
 
-        static void do_jmp_if_true_op( computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
+            bool can_write() const {
+                return !out.full();
+            }
 
-            if (eval_param(icc, args[0])) {
-                icc.program_counter_ = eval_param(icc, args[1]);
+            void write(int64_t val) {
+                out.push(val);
             }
-        }
+        };
 
-        static void do_jmp_if_false_op( computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
+        struct no_hooks {
+            void executing(const computer&, const instruction&) {
+            }
 
-            if (!eval_param(icc, args[0])) {
-                icc.program_counter_ = eval_param(icc, args[1]);
+            void branching(const computer&, const instruction&) {
             }
-        }
 
-        static void do_less_than_op( computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
+            void wrote(int64_t) {
+            }
 
-            eval_param_as_ref(icc, args[2]) = 
-                eval_param(icc, args[0]) < eval_param(icc, args[1]) ? 1 : 0;
-        }
+            void received(computer&) {
+            }
 
-        static void do_equals_op( computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
+            void sent(computer&) {
+            }
+        };
 
-            eval_param_as_ref(icc, args[2]) = 
-                eval_param(icc, args[0]) == eval_param(icc, args[1]) ? 1 : 0;
-        }
+        // the profiling engine, recording into a profile.
+        struct profile_hooks {
+            intcode_profile& profile;
 
-        static void do_set_rel_base_op(
-                computer& icc, const std::vector<parameter>& args,
-                const input_fn& inp, const output_fn& out) {
-            icc.rel_base_ += eval_param(icc, args[0]);
-        }
+            // a superinstruction is recorded as the instruction it replaced, and
+            // a fused one's jump separately, once it is known to run.
+            void executing(const computer& icc, const instruction& instr) {
+                auto op = (instr.op >= jump_op) ? instr.base_op : instr.op;
+                profile.record_instruction(icc.program_counter_, op, icc.rel_base_, icc.ticks_);
+            }
 
-        static int64_t current_value(const computer& icc) {
-            return icc.value(icc.program_counter_);
-        }
+            void branching(const computer& icc, const instruction& instr) {
+                auto op = instr.branch_if ? jmp_if_true_op : jmp_if_false_op;
+                profile.record_instruction(icc.program_counter_ + k_arith_length, op, icc.rel_base_, icc.ticks_);
+            }
+
+            void wrote(int64_t addr) {
+                profile.record_write(addr);
+            }
+
+            void received(computer& icc) {
+                profile.record_input(icc.ticks_ - icc.io_ticks_);
+                icc.io_ticks_ = icc.ticks_;
+            }
 
-        static int64_t current_addr(const computer& icc) {
-            return icc.program_counter_;
+            void sent(computer& icc) {
+                profile.record_output(icc.ticks_ - icc.io_ticks_);
+                icc.io_ticks_ = icc.ticks_;
+            }
+        };
+
+        // runs the profiling engine if a profile is recording on this thread. The
+        // two are separate instantiations, so the usual engine pays nothing for it.
+        template<typename IO>
+        static icc_event run(computer& icc, IO& io) {
+            if (auto* profile = intcode_profile::active(); profile) {
+                profile_hooks hooks{ *profile };
+                return execute(icc, io, hooks);
+            }
+            no_hooks hooks;
+            return execute(icc, io, hooks);
         }
     };
 }
 
 namespace {
 
-    using impl = aoc::impl;
-    using computer = aoc::intcode_computer;
-
-    const std::unordered_map<impl::op_code, impl::op_def> k_op_code_table = {
-        {impl::add_op, {impl::add_op, 3, impl::do_add_op}},
-        {impl::mult_op, {impl::mult_op, 3, impl::do_mult_op}},
-        {impl::inp_op, {impl::add_op, 1, impl::do_inp_op}},
-        {impl::outp_op, {impl::mult_op, 1, impl::do_outp_op}},
-        {impl::jmp_if_true_op, {impl::jmp_if_true_op, 2, impl::do_jmp_if_true_op}},
-        {impl::jmp_if_false_op, {impl::jmp_if_false_op, 2, impl::do_jmp_if_false_op}},
-        {impl::less_than_op, {impl::less_than_op, 3, impl::do_less_than_op}},
-        {impl::equals_op, {impl::equals_op, 3, impl::do_equals_op}},
-        {impl::set_rel_base_op, {impl::set_rel_base_op, 1, impl::do_set_rel_base_op}}
-    };
-
-    impl::param_mode char_to_param_mode(char ch) {
-        return static_cast<impl::param_mode>(ch - '0');
+    void check_address(int64_t addr) {
+        if (addr < 0) {
+            throw std::runtime_error("bad memory access");
+        }
     }
+}
 
-    std::optional<impl::instruction> parse_next_instruction(computer& icc)  {
+aoc::intcode_memory::intcode_memory(const std::vector<int64_t>& image) {
+    assign(image);
+}
 
-        auto val = impl::current_value(icc);
-        if (val == static_cast<int>(impl::terminate_op)) {
-            return {};
-        }
+void aoc::intcode_memory::assign(const std::vector<int64_t>& image) {
+    pages_.clear();
+    far_pages_.clear();
+    pages_.resize((image.size() + k_page_size - 1) / k_page_size);
+    for (size_t index = 0; index < pages_.size(); ++index) {
+        auto first = image.begin() + index * k_page_size;
+        auto last = image.begin() + std::min(image.size(), (index + 1) * k_page_size);
+        pages_[index] = std::make_shared<page>();
+        std::copy(first, last, pages_[index]->begin());
+    }
+}
 
-        auto str = std::to_string(val);
-        int n = static_cast<int>(str.length());
-        std::string mode_str;
-        impl::op_code op = impl::terminate_op;
-        if (val < 10) {
-            op = static_cast<impl::op_code>(val);
-        } else {
-            auto op_str = str.substr(n - 2, 2);
-            mode_str = str.substr(0, n - 2);
-            r::reverse(mode_str);
-            op = static_cast<impl::op_code>(std::stoi(op_str));
+const int64_t* aoc::intcode_memory::find(int64_t addr) const {
+    check_address(addr);
+    auto index = addr / k_page_size;
+    const page* pg = nullptr;
+    if (index < k_max_table_pages) {
+        if (index < static_cast<int64_t>(pages_.size())) {
+            pg = pages_[index].get();
         }
+    } else if (auto iter = far_pages_.find(index); iter != far_pages_.end()) {
+        pg = iter->second.get();
+    }
+    return pg ? &(*pg)[addr % k_page_size] : nullptr;
+}
 
-        std::vector<impl::parameter> params;
-        for (int i = 0; i < k_op_code_table.at(op).num_args; ++i) {
-            params.emplace_back(
-                icc.value(aoc::impl::current_addr(icc) + i + 1),
-                char_to_param_mode((i < mode_str.size()) ? mode_str.at(i) : '0')
-            );
+// the slow path of a write: allocates the page if it does not exist yet and
+// otherwise copies it unless no other memory still shares it.
+int64_t& aoc::intcode_memory::writable(int64_t addr) {
+    check_address(addr);
+    auto index = addr / k_page_size;
+    page_ptr* entry = nullptr;
+    if (index < k_max_table_pages) {
+        if (index >= static_cast<int64_t>(pages_.size())) {
+            pages_.resize(index + 1);
         }
-
-        return impl::instruction{ op, params };
+        entry = &pages_[index];
+    } else {
+        entry = &far_pages_[index];
     }
-
-    std::unordered_map<int64_t, int64_t> to_memory_table(const std::vector<int64_t>& code) {
-        return rv::enumerate(code) | rv::transform(
-                [](const auto& addr_val)->std::unordered_map<int64_t, int64_t>::value_type {
-                    auto [address, val] = addr_val;
-                    return { address, val };
-                }
-            ) | r::to<std::unordered_map<int64_t, int64_t>>();
+    if (!*entry) {
+        *entry = std::make_shared<page>();
+    } else if (entry->use_count() > 1) {
+        *entry = std::make_shared<page>(**entry);
     }
+    return (**entry)[addr % k_page_size];
 }
 
-bool aoc::intcode_computer::run_one_instruction(
-        const input_fn& inp, const output_fn& out) {
+/*------------------------------------------------------------------------------------------------*/
 
-    ticks_++;
-    auto instr = parse_next_instruction(*this);
-    if (!instr) {
-        return false;
+aoc::intcode_computer::instruction_cache::instruction_cache(size_t sz) :
+    instrs_(std::make_shared<std::vector<decoded_instruction>>(sz, decoded_instruction{})) {
+}
+
+aoc::intcode_computer::decoded_instruction& aoc::intcode_computer::instruction_cache::writable(
+        size_t addr) {
+    if (instrs_.use_count() > 1) {
+        instrs_ = std::make_shared<std::vector<decoded_instruction>>(*instrs_);
+    }
+    if (addr >= instrs_->size()) {
+        instrs_->resize(addr + 1, decoded_instruction{});
     }
+    return (*instrs_)[addr];
+}
 
-    const auto& op = k_op_code_table.at(instr->op);
-    auto old_prog_counter = program_counter_;
-    op.fn(*this, instr->parameters, inp, out);
-    if (old_prog_counter == program_counter_) {
-        program_counter_ += op.num_args + 1;
+void aoc::intcode_computer::instruction_cache::reset(size_t sz) {
+    if (instrs_.use_count() > 1) {
+        instrs_ = std::make_shared<std::vector<decoded_instruction>>();
     }
+    instrs_->assign(sz, decoded_instruction{});
+}
+
+/*------------------------------------------------------------------------------------------------*/
 
-    return true;
+// only decoded entries whose words include addr are touched, so writes to data
+// never copy a shared cache.
+void aoc::intcode_computer::invalidate(int64_t addr) {
+    auto last = std::min(addr, static_cast<int64_t>(icache_.size()) - 1);
+    for (auto a = std::max<int64_t>(addr - k_max_instruction_length + 1, 0); a <= last; ++a) {
+        if (icache_[a].op && a + icache_[a].length > addr) {
+            icache_.writable(a).op = 0;
+        }
+    }
 }
 
 aoc::intcode_computer::intcode_computer(const std::vector<int64_t>& memory) :
-    memory_( to_memory_table(memory) ),
+    memory_( memory ),
+    icache_( memory.size() ),
     program_counter_(0),
     rel_base_(0),
-    ticks_(0) {
+    ticks_(0),
+    io_ticks_(0) {
 }
 
 void aoc::intcode_computer::reset(const std::vector<int64_t>& memory) {
-    memory_ = to_memory_table(memory);
+    memory_.assign(memory);
+    icache_.reset(memory.size());
     program_counter_ = 0;
     output_ = {};
     rel_base_ = 0;
     ticks_ = 0;
+    io_ticks_ = 0;
+}
+
+aoc::intcode_computer aoc::intcode_computer::fork() const {
+    return *this;
+}
+
+aoc::intcode_snapshot aoc::intcode_computer::snapshot() const {
+    return intcode_snapshot(*this);
+}
+
+void aoc::intcode_computer::restore(const intcode_snapshot& snap) {
+    *this = snap.state_;
+}
+
+void aoc::intcode_computer::predecode(const std::vector<int64_t>& addresses) {
+    for (auto addr : addresses) {
+        if (addr < 0 || (static_cast<uint64_t>(addr) < icache_.size() && icache_[addr].op)) {
+            continue;
+        }
+        try {
+            impl::decode_into_cache(*this, addr);
+        } catch (const std::runtime_error&) {
+            // data rather than code; the entry is left undecoded.
+        }
+    }
 }
 
 int64_t aoc::intcode_computer::output() const {
@@ -257,20 +551,19 @@ int aoc::intcode_computer::ticks() const {
     return ticks_;
 }
 
+// memory that has never been written reads as zero without being allocated.
 const int64_t& aoc::intcode_computer::value(int64_t i) const {
-    if (i < 0) {
-        throw std::runtime_error( "bad memory access" );
-    }
-    if (!memory_.contains(i)) {
-        memory_[i] = 0; // memory_ is mutable so this is possible...
-    }
-    return memory_.at(i);
+    static const int64_t k_zero = 0;
+    auto* val = memory_.find(i);
+    return val ? *val : k_zero;
 }
 
+// the caller may write through the reference, so any cached decoding of the
+// instructions overlapping address i is dropped.
 int64_t& aoc::intcode_computer::value(int64_t i) {
-    return const_cast<int64_t&>(
-        const_cast<const aoc::intcode_computer*>(this)->value(i)
-    );
+    check_address(i);
+    invalidate(i);
+    return memory_.at(i);
 }
 
 void aoc::intcode_computer::run(input_buffer& inp) {
@@ -293,38 +586,22 @@ void aoc::intcode_computer::run() {
 }
 
 void aoc::intcode_computer::run(const input_fn& inp, const output_fn& out) {
-    bool not_done = true;
-    while (not_done) {
-        not_done = run_one_instruction(inp, out);
-    }
+    impl::callback_io io{ inp, out };
+    impl::run(*this, io);
 }
 
 aoc::icc_event aoc::intcode_computer::run_until_event(std::optional<int64_t> inp) {
-    std::optional<icc_event> event = {};
-    while (!event) {
+    impl::event_io io{ inp };
+    return impl::run(*this, io);
+}
 
-        auto next_instruction = parse_next_instruction(*this);
-        if (next_instruction && next_instruction->op == impl::inp_op && !inp) {
-            return awaiting_input;
-        }
+aoc::icc_event aoc::intcode_computer::run_until_blocked(intcode_channel& inp, intcode_channel& out) {
+    impl::channel_io io{ inp, out };
+    return impl::run(*this, io);
+}
 
-        bool not_done = run_one_instruction(
-            [&]() {
-                if (!inp) {
-                    throw std::runtime_error( "expected input" );
-                }
-                event = received_input;
-                return *inp; 
-            },
-            [&](int64_t out) {
-                event = generated_output;
-            }
-        );
-        if (not_done == false) {
-            event = terminated;
-        }
-    }
-    return *event;
+aoc::intcode_snapshot::intcode_snapshot(const intcode_computer& icc) :
+    state_(icc) {
 }
 
 /*------------------------------------------------------------------------------------------------*/
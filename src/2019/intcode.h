@@ -1,9 +1,13 @@
 #pragma once
 
+#include "../util/self_test.h"
+#include <cstdint>
 #include <vector>
 #include <unordered_map>
 #include <optional>
 #include <functional>
+#include <array>
+#include <memory>
 
 namespace aoc {
 
@@ -25,25 +29,132 @@ namespace aoc {
         terminated,
         awaiting_input,
         received_input,
-        generated_output
+        generated_output,
+        awaiting_output
     };
 
+    // intcode memory: fixed-size pages allocated the first time they are written,
+    // found through a flat page table near the program image and a hash table at
+    // extreme addresses. Untouched memory reads as zero.
+    //
+    // pages are shared between copies and copied on write: a memory writes into a
+    // page in place only while it holds the sole reference to it. Copying a memory
+    // is therefore a copy of page pointers rather than of page contents, and it
+    // leaves the original untouched, so a const memory can be copied from several
+    // threads at once.
+
+    class intcode_memory {
+    public:
+        static constexpr int64_t k_page_size = 1024;
+
+        intcode_memory(const std::vector<int64_t>& image = {});
+        void assign(const std::vector<int64_t>& image);
+
+        int64_t read(int64_t addr) const {
+            auto index = static_cast<uint64_t>(addr) / k_page_size;
+            if (index < pages_.size() && pages_[index]) {
+                return (*pages_[index])[addr % k_page_size];
+            }
+            auto* val = find(addr);
+            return val ? *val : 0;
+        }
+
+        int64_t& at(int64_t addr) {
+            auto index = static_cast<uint64_t>(addr) / k_page_size;
+            if (index < pages_.size() && pages_[index].use_count() == 1) {
+                return (*pages_[index])[addr % k_page_size];
+            }
+            return writable(addr);
+        }
+
+        const int64_t* find(int64_t addr) const;
+
+    private:
+        static constexpr int64_t k_max_table_pages = 1 << 14;
+
+        using page = std::array<int64_t, k_page_size>;
+        using page_ptr = std::shared_ptr<page>;
+
+        std::vector<page_ptr> pages_;
+        std::unordered_map<int64_t, page_ptr> far_pages_;
+
+        int64_t& writable(int64_t addr);
+    };
+
+    class intcode_snapshot;
+    class intcode_channel;
+
     class intcode_computer {
         friend class impl;
 
-        mutable std::unordered_map<int64_t, int64_t> memory_;
+        // an instruction decoded once from its opcode word: op is 0 until the
+        // address has been decoded, and any write into the instruction's words
+        // resets it so that self-modifying code is decoded again. base_op is the
+        // opcode a superinstruction replaced, and the target fields are only used
+        // by a fused arithmetic instruction and jump, which covers up to
+        // k_max_instruction_length words.
+        static constexpr int k_max_instruction_length = 7;
+
+        struct decoded_instruction {
+            int64_t args[3];
+            int64_t target;
+            uint8_t op;
+            uint8_t modes[3];
+            uint8_t length;
+            uint8_t base_op;
+            uint8_t target_mode;
+            bool branch_if;
+        };
+
+        // the decoded instructions, shared between copies of a computer until one
+        // of them changes an entry; as with memory pages, a cache is changed in
+        // place only while no other copy refers to it.
+        class instruction_cache {
+            std::shared_ptr<std::vector<decoded_instruction>> instrs_;
+
+        public:
+            instruction_cache(size_t sz = 0);
+
+            size_t size() const {
+                return instrs_->size();
+            }
+
+            const decoded_instruction& operator[](size_t addr) const {
+                return (*instrs_)[addr];
+            }
+
+            decoded_instruction& writable(size_t addr);
+            void reset(size_t sz);
+        };
+
+        intcode_memory memory_;
+        instruction_cache icache_;
         int64_t program_counter_;
         std::optional<int64_t> output_;
         int64_t rel_base_;
         int ticks_;
+        int io_ticks_;      // ticks_ at the last input or output, kept while profiling
 
-        bool run_one_instruction(const input_fn& inp, const output_fn& out);
+        void invalidate(int64_t addr);
 
     public:
 
         intcode_computer(const std::vector<int64_t>& memory);
         void reset(const std::vector<int64_t>& memory);
 
+        // a fork shares memory pages and decoded instructions with the original
+        // until either of them writes, so branching execution costs a copy of the
+        // page table rather than of memory. Plain copies behave the same way.
+        intcode_computer fork() const;
+        intcode_snapshot snapshot() const;
+        void restore(const intcode_snapshot& snap);
+
+        // decodes the instructions at the given addresses ahead of their first
+        // execution, so that copies made afterwards share them instead of each
+        // decoding the program again. Addresses that do not hold a valid
+        // instruction are skipped.
+        void predecode(const std::vector<int64_t>& addresses);
+
         const int64_t& value(int64_t i) const;
         int64_t& value(int64_t i);
         int64_t output() const;
@@ -54,6 +165,22 @@ namespace aoc {
         void run();
         void run(const input_fn& inp, const output_fn& out);
         icc_event run_until_event(std::optional<int64_t> inp = {});
+
+        // runs until the program terminates, inp is empty when it needs input, or
+        // out is full when it has output, returning terminated, awaiting_input or
+        // awaiting_output respectively.
+        icc_event run_until_blocked(intcode_channel& inp, intcode_channel& out);
+    };
+
+    // the complete state of a computer, which can be restored any number of times.
+    class intcode_snapshot {
+        friend class intcode_computer;
+        intcode_computer state_;
+
+        intcode_snapshot(const intcode_computer& icc);
     };
 
-}
\ No newline at end of file
+    // checks of the engine's superinstructions against a plain interpreter; 'test'.
+    const self_test_table& intcode_self_tests();
+
+}
@@ -0,0 +1,238 @@
+#include "intcode_analysis.h"
+#include "intcode_ops.h"
+#include <algorithm>
+#include <array>
+#include <format>
+#include <optional>
+#include <set>
+#include <sstream>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    using namespace aoc::intcode_ops;
+
+    struct instruction {
+        int op;
+        int num_args;
+        std::array<int, 3> modes;
+        std::array<int64_t, 3> args;
+
+        int64_t length() const {
+            return num_args + 1;
+        }
+    };
+
+    std::optional<instruction> decode(const std::vector<int64_t>& program, int64_t addr) {
+        if (addr < 0 || addr >= static_cast<int64_t>(program.size())) {
+            return {};
+        }
+        auto decoded = aoc::intcode_ops::decode(program[addr]);
+        if (!decoded || addr + decoded->num_args >= static_cast<int64_t>(program.size())) {
+            return {};
+        }
+        instruction instr{ decoded->op, decoded->num_args, decoded->modes, {} };
+        for (int i = 0; i < instr.num_args; ++i) {
+            instr.args[i] = program[addr + i + 1];
+        }
+        return instr;
+    }
+
+    // the addresses control may move to after instr, other than through a jump
+    // whose target is read from memory.
+    std::vector<int64_t> next_addresses(const instruction& instr, int64_t addr, bool& indirect) {
+        indirect = false;
+        if (instr.op == terminate_op) {
+            return {};
+        }
+        if (!is_branch(instr.op)) {
+            return { addr + instr.length() };
+        }
+        std::vector<int64_t> next;
+        bool always = instr.modes[0] == immediate &&
+            ((instr.args[0] != 0) == (instr.op == jmp_if_true_op));
+        bool never = instr.modes[0] == immediate && !always;
+        if (!never) {
+            if (instr.modes[1] == immediate) {
+                next.push_back(instr.args[1]);
+            } else {
+                indirect = true;
+            }
+        }
+        if (!always) {
+            next.push_back(addr + instr.length());
+        }
+        return next;
+    }
+
+    // an immediate value pushed onto the relative-base stack by adding 0 or
+    // multiplying by 1.
+    std::optional<int64_t> pushed_constant(const instruction& instr) {
+        if ((instr.op != add_op && instr.op != mult_op) || instr.modes[2] != relative ||
+                instr.modes[0] != immediate || instr.modes[1] != immediate) {
+            return {};
+        }
+        auto identity = (instr.op == add_op) ? 0 : 1;
+        if (instr.args[0] == identity) {
+            return instr.args[1];
+        }
+        if (instr.args[1] == identity) {
+            return instr.args[0];
+        }
+        return {};
+    }
+
+    std::string operand(int mode, int64_t arg) {
+        switch (mode) {
+            case immediate:
+                return std::format("{}", arg);
+            case relative:
+                return (arg < 0) ? std::format("[rb-{}]", -arg) : std::format("[rb+{}]", arg);
+            default:
+                return std::format("[{}]", arg);
+        }
+    }
+
+    std::string to_string(const instruction& instr) {
+        auto arg = [&](int i) {
+            return operand(instr.modes[i], instr.args[i]);
+        };
+        switch (instr.op) {
+            case add_op:
+                return std::format("add  {}, {} -> {}", arg(0), arg(1), arg(2));
+            case mult_op:
+                return std::format("mul  {}, {} -> {}", arg(0), arg(1), arg(2));
+            case less_than_op:
+                return std::format("lt   {}, {} -> {}", arg(0), arg(1), arg(2));
+            case equals_op:
+                return std::format("eq   {}, {} -> {}", arg(0), arg(1), arg(2));
+            case inp_op:
+                return std::format("in   {}", arg(0));
+            case outp_op:
+                return std::format("out  {}", arg(0));
+            case jmp_if_true_op:
+                return std::format("jnz  {}, {}", arg(0), arg(1));
+            case jmp_if_false_op:
+                return std::format("jz   {}, {}", arg(0), arg(1));
+            case set_rel_base_op:
+                return std::format("arb  {}", arg(0));
+            default:
+                return "halt";
+        }
+    }
+
+    // how the execution engine specializes the instruction at addr, matching the
+    // superinstructions chosen when it decodes.
+    std::string superinstruction(const std::vector<int64_t>& program, const instruction& instr, int64_t addr) {
+        if (is_branch(instr.op) && instr.modes[0] == immediate) {
+            return ((instr.args[0] != 0) == (instr.op == jmp_if_true_op)) ? "jump" : "no-op";
+        }
+        if (!is_arith(instr.op) || instr.modes[2] == immediate) {
+            return {};
+        }
+        auto next = decode(program, addr + instr.length());
+        if (next && is_branch(next->op) && next->modes[0] == instr.modes[2] && next->args[0] == instr.args[2]) {
+            return "fused with the next jump";
+        }
+        if (instr.modes[0] == immediate && instr.modes[1] == immediate) {
+            return "constant store";
+        }
+        return {};
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::intcode_cfg aoc::build_intcode_cfg(const std::vector<int64_t>& program) {
+    std::set<int64_t> visited;
+    std::set<int64_t> leaders = { 0 };
+    std::vector<int64_t> stack = { 0 };
+
+    while (!stack.empty()) {
+        auto addr = stack.back();
+        stack.pop_back();
+        if (visited.contains(addr)) {
+            continue;
+        }
+        auto instr = decode(program, addr);
+        if (!instr) {
+            continue;
+        }
+        visited.insert(addr);
+
+        bool indirect = false;
+        auto next = next_addresses(*instr, addr, indirect);
+        bool ends_block = instr->op == terminate_op || is_branch(instr->op);
+        for (auto target : next) {
+            if (ends_block) {
+                leaders.insert(target);
+            }
+            stack.push_back(target);
+        }
+        if (auto constant = pushed_constant(*instr); constant && decode(program, *constant)) {
+            leaders.insert(*constant);
+            stack.push_back(*constant);
+        }
+    }
+
+    intcode_cfg cfg;
+    cfg.instructions.assign(visited.begin(), visited.end());
+    for (size_t i = 0; i < cfg.instructions.size(); ) {
+        intcode_block block{ cfg.instructions[i], 0, {}, false };
+        for (;;) {
+            auto addr = cfg.instructions[i++];
+            auto instr = *decode(program, addr);
+            block.last = addr + instr.length();
+            bool ends_block = instr.op == terminate_op || is_branch(instr.op) ||
+                i == cfg.instructions.size() || cfg.instructions[i] != block.last ||
+                leaders.contains(block.last);
+            if (ends_block) {
+                block.successors = next_addresses(instr, addr, block.indirect);
+                break;
+            }
+        }
+        cfg.blocks.push_back(std::move(block));
+    }
+    return cfg;
+}
+
+std::string aoc::intcode_cfg_listing(const std::vector<int64_t>& program, const intcode_cfg& cfg) {
+    std::stringstream ss;
+    int num_special = 0;
+    int num_indirect = 0;
+    auto instr_iter = cfg.instructions.begin();
+
+    for (const auto& block : cfg.blocks) {
+        ss << std::format("block {:05}..{:05}", block.first, block.last - 1);
+        std::string separator = " -> ";
+        for (auto succ : block.successors) {
+            ss << separator << std::format("{:05}", succ);
+            separator = ", ";
+        }
+        if (block.indirect) {
+            ss << separator << "<indirect>";
+            ++num_indirect;
+        }
+        ss << '\n';
+
+        for (; instr_iter != cfg.instructions.end() && *instr_iter < block.last; ++instr_iter) {
+            auto addr = *instr_iter;
+            auto instr = *decode(program, addr);
+            auto special = superinstruction(program, instr, addr);
+            if (special.empty()) {
+                ss << std::format("    {:05}: {}\n", addr, to_string(instr));
+            } else {
+                ss << std::format("    {:05}: {:<36}; {}\n", addr, to_string(instr), special);
+                ++num_special;
+            }
+        }
+        ss << '\n';
+    }
+
+    ss << std::format(
+        "{} words, {} instructions in {} blocks, {} superinstructions, {} indirect jumps\n",
+        program.size(), cfg.instructions.size(), cfg.blocks.size(), num_special, num_indirect
+    );
+    return ss.str();
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+    struct intcode_block {
+        int64_t first;
+        int64_t last;       // one past the final word of the block
+        std::vector<int64_t> successors;
+        bool indirect;      // ends in a jump whose target is read from memory
+    };
+
+    struct intcode_cfg {
+        std::vector<intcode_block> blocks;
+        std::vector<int64_t> instructions;
+    };
+
+    // recovers the code of a program by following control flow from address 0.
+    // Jumps whose targets are read from memory cannot be followed statically, so
+    // immediate values pushed onto the relative-base stack that point at a valid
+    // instruction, which is how compiled intcode passes return addresses, are
+    // followed as well.
+    intcode_cfg build_intcode_cfg(const std::vector<int64_t>& program);
+
+    // a listing of the blocks of the control flow graph, marking the instructions
+    // the execution engine runs as superinstructions.
+    std::string intcode_cfg_listing(const std::vector<int64_t>& program, const intcode_cfg& cfg);
+
+}
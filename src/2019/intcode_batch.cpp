@@ -0,0 +1,72 @@
+#include "intcode_batch.h"
+#include "intcode_analysis.h"
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // chunks of runs per thread, so that uneven runs still keep every thread busy.
+    constexpr size_t k_chunks_per_thread = 4;
+
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::intcode_batch::intcode_batch(const std::vector<int64_t>& program, thread_pool& pool) :
+        prototype_(program),
+        pool_(pool) {
+    prototype_.predecode(build_intcode_cfg(program).instructions);
+}
+
+std::vector<std::vector<int64_t>> aoc::intcode_batch::run(
+        const std::vector<std::vector<int64_t>>& inputs) {
+    return map(inputs.size(),
+        [&](intcode_computer& icc, size_t i) {
+            std::vector<int64_t> output;
+            input_buffer inp(inputs[i]);
+            icc.run(inp,
+                [&output](int64_t val) {
+                    output.push_back(val);
+                }
+            );
+            return output;
+        }
+    );
+}
+
+void aoc::intcode_batch::for_each(size_t n, const run_fn& fn) {
+    auto num_chunks = std::min(n, static_cast<size_t>(pool_.size()) * k_chunks_per_thread);
+    if (num_chunks == 0) {
+        return;
+    }
+    std::mutex mutex;
+    std::exception_ptr failure;
+    thread_pool::task_group group;
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        pool_.submit(group,
+            [&, chunk]() {
+                auto first = chunk * n / num_chunks;
+                auto last = (chunk + 1) * n / num_chunks;
+                try {
+                    for (auto i = first; i < last; ++i) {
+                        auto icc = prototype_;
+                        fn(icc, i);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                }
+            }
+        );
+    }
+    pool_.wait(group);
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
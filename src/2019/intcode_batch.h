@@ -0,0 +1,60 @@
+#pragma once
+
+#include "intcode.h"
+#include "../util/thread_pool.h"
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace aoc {
+
+    // runs one program many times over, independently, across a thread pool, the
+    // shared one by default.
+    //
+    // every run starts from a copy of a prototype computer whose instruction cache
+    // already holds the code that control flow analysis can find, so the decoded
+    // program and the memory pages are shared by all of the runs rather than
+    // decoded and copied by each of them; a run only copies the pages it writes.
+
+    class intcode_batch {
+    public:
+        using run_fn = std::function<void(intcode_computer&, size_t)>;
+
+        explicit intcode_batch(const std::vector<int64_t>& program,
+            thread_pool& pool = shared_thread_pool());
+
+        // the output of each run of the program given the corresponding input
+        // sequence.
+        std::vector<std::vector<int64_t>> run(const std::vector<std::vector<int64_t>>& inputs);
+
+        // calls fn(icc, i) for every i in [0, n), each with a fresh computer that
+        // has not yet run. Calls are concurrent; the first exception thrown by one
+        // is rethrown once all of them have finished.
+        void for_each(size_t n, const run_fn& fn);
+
+        // the results of fn(icc, i) for every i in [0, n), as for_each.
+        template<typename Fn>
+        auto map(size_t n, Fn fn) {
+            using result = std::invoke_result_t<Fn&, intcode_computer&, size_t>;
+            std::vector<std::optional<result>> results(n);
+            for_each(n,
+                [&](intcode_computer& icc, size_t i) {
+                    results[i] = fn(icc, i);
+                }
+            );
+            std::vector<result> values;
+            values.reserve(n);
+            for (auto& res : results) {
+                values.push_back(std::move(*res));
+            }
+            return values;
+        }
+
+    private:
+        intcode_computer prototype_;
+        thread_pool& pool_;
+    };
+
+}
@@ -0,0 +1,272 @@
+#include "intcode_network.h"
+#include "../util/mpsc_queue.h"
+#include "../util/thread_pool.h"
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // events a machine may run through before its worker moves on to the next one,
+    // so that a machine which never reads input cannot starve the others.
+    constexpr int k_max_events_per_turn = 1024;
+
+    struct inbound_packet {
+        int64_t x;
+        int64_t y;
+    };
+}
+
+struct aoc::intcode_network::worker {
+    std::mutex mutex;
+    std::condition_variable wake;
+
+    // raised whenever a packet is sent to one of the worker's machines, so a
+    // worker that looked at its inboxes before a send does not sleep through it.
+    uint64_t signals = 0;
+};
+
+struct aoc::intcode_network::machine {
+    intcode_computer nic;
+    mpsc_queue<inbound_packet> inbox;
+    std::optional<int64_t> pending_y;
+    std::array<int64_t, 3> output;
+    int output_count;
+
+    // true once the machine has read -1 and produced no output since.
+    bool polled;
+    bool parked;
+    bool terminated;
+    worker* owner;
+
+    machine(const intcode_computer& icc) :
+        nic(icc),
+        output_count(0),
+        polled(false),
+        parked(false),
+        terminated(false),
+        owner(nullptr) {
+    }
+};
+
+aoc::intcode_network::intcode_network(const std::vector<int64_t>& nic, int size) :
+        pending_(size),
+        stopping_(false) {
+    intcode_computer prototype(nic);
+    for (int address = 0; address < size; ++address) {
+        auto& m = *machines_.emplace_back(std::make_unique<machine>(prototype));
+        if (m.nic.run_until_event(address) != received_input) {
+            throw std::runtime_error("network machine did not read its address");
+        }
+    }
+}
+
+aoc::intcode_network::~intcode_network() {
+}
+
+int aoc::intcode_network::size() const {
+    return static_cast<int>(machines_.size());
+}
+
+void aoc::intcode_network::send(const network_packet& p) {
+    if (p.address < 0 || p.address >= size()) {
+        throw std::out_of_range("packet sent outside the network");
+    }
+    auto& m = *machines_[p.address];
+    pending_.fetch_add(1, std::memory_order_acq_rel);
+    m.inbox.push({ p.x, p.y });
+    if (auto* w = m.owner; w) {
+        {
+            std::lock_guard<std::mutex> lock(w->mutex);
+            ++w->signals;
+        }
+        w->wake.notify_one();
+    }
+}
+
+// the caller holds mutex_.
+void aoc::intcode_network::stop() {
+    stopping_ = true;
+    idle_.notify_all();
+    for (auto& w : workers_) {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        w->wake.notify_all();
+    }
+}
+
+void aoc::intcode_network::release_pending() {
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        idle_.notify_all();
+    }
+}
+
+void aoc::intcode_network::park(machine& m) {
+    m.parked = true;
+    release_pending();
+}
+
+void aoc::intcode_network::handle_output(machine& m, const packet_fn& on_external) {
+    m.polled = false;
+    m.output[m.output_count++] = m.nic.output();
+    if (m.output_count < 3) {
+        return;
+    }
+    m.output_count = 0;
+
+    network_packet p{ m.output[0], m.output[1], m.output[2] };
+    if (p.address >= 0 && p.address < size()) {
+        send(p);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!stopping_ && !on_external(p)) {
+        stop();
+    }
+}
+
+// gives one machine a turn, which lasts until it reads -1 from an empty inbox or
+// is parked. Returns false if the machine could do nothing because it is parked
+// with nothing to read or has terminated.
+
+bool aoc::intcode_network::service(machine& m, const packet_fn& on_external) {
+    if (m.terminated) {
+        // packets sent to a terminated machine are never taken, so they are
+        // dropped rather than keeping the network from going quiet.
+        while (m.inbox.pop()) {
+            release_pending();
+        }
+        return false;
+    }
+    if (m.parked && m.inbox.empty()) {
+        return false;
+    }
+    for (int events = 0; events < k_max_events_per_turn; ++events) {
+        auto event = m.nic.run_until_event();
+        if (event == generated_output) {
+            handle_output(m, on_external);
+            continue;
+        }
+        if (event == terminated) {
+            m.terminated = true;
+            release_pending();
+            return true;
+        }
+
+        // the machine is blocked on input.
+        if (m.pending_y) {
+            m.nic.run_until_event(*m.pending_y);
+            m.pending_y = {};
+            continue;
+        }
+        if (auto p = m.inbox.pop(); p) {
+            // a parked machine takes over the packet's count as its own.
+            if (m.parked) {
+                m.parked = false;
+            } else {
+                release_pending();
+            }
+            m.polled = false;
+            m.nic.run_until_event(p->x);
+            m.pending_y = p->y;
+            continue;
+        }
+        if (m.parked) {
+            return false;
+        }
+        if (m.polled && m.output_count == 0) {
+            park(m);
+            return true;
+        }
+        m.nic.run_until_event(-1);
+        m.polled = true;
+        return true;
+    }
+    return true;
+}
+
+void aoc::intcode_network::run_machines(worker& w, size_t first, size_t last, const packet_fn& on_external) {
+    try {
+        while (!stopping_) {
+            uint64_t signals = 0;
+            {
+                std::lock_guard<std::mutex> lock(w.mutex);
+                signals = w.signals;
+            }
+            bool any_work = false;
+            for (auto i = first; i < last && !stopping_; ++i) {
+                any_work = service(*machines_[i], on_external) || any_work;
+            }
+            if (!any_work) {
+                std::unique_lock<std::mutex> lock(w.mutex);
+                w.wake.wait(lock, [&]() { return stopping_ || w.signals != signals; });
+            }
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!failure_) {
+            failure_ = std::current_exception();
+        }
+        stop();
+    }
+}
+
+void aoc::intcode_network::run(const packet_fn& on_external, const idle_fn& on_idle, int num_threads) {
+    // the workers block one another, so they get threads of their own rather than
+    // tasks on a shared pool; inside a pool's task those would add to threads that
+    // are already busy.
+    if (num_threads <= 0) {
+        num_threads = thread_pool::on_worker_thread() ? 1 :
+            std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+    }
+    num_threads = std::max(std::min(num_threads, size()), 1);
+
+    stopping_ = false;
+    auto per_thread = (machines_.size() + num_threads - 1) / num_threads;
+    for (size_t first = 0; first < machines_.size(); first += per_thread) {
+        auto& w = *workers_.emplace_back(std::make_unique<worker>());
+        auto last = std::min(first + per_thread, machines_.size());
+        for (auto i = first; i < last; ++i) {
+            machines_[i]->owner = &w;
+        }
+    }
+
+    thread_pool pool(num_threads);
+    thread_pool::task_group group;
+    for (size_t first = 0, i = 0; first < machines_.size(); first += per_thread, ++i) {
+        auto last = std::min(first + per_thread, machines_.size());
+        auto* w = workers_[i].get();
+        pool.submit(group,
+            [this, w, first, last, &on_external]() {
+                run_machines(*w, first, last, on_external);
+            }
+        );
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopping_) {
+            idle_.wait(lock, [this]() { return stopping_ || pending_ == 0; });
+            if (stopping_) {
+                break;
+            }
+            if (!on_idle() || pending_ == 0) {
+                stop();
+            }
+        }
+    }
+
+    pool.wait(group);
+    for (auto& m : machines_) {
+        m->owner = nullptr;
+    }
+    workers_.clear();
+    if (failure_) {
+        std::rethrow_exception(failure_);
+    }
+}
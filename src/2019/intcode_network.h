@@ -0,0 +1,92 @@
+#pragma once
+
+#include "intcode.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aoc {
+
+    struct network_packet {
+        int64_t address;
+        int64_t x;
+        int64_t y;
+    };
+
+    // machines running the same NIC program, each given its address as its first
+    // input, that send each other packets as (address, x, y) output triples and
+    // read them from lock-free inboxes, reading -1 when their inbox is empty.
+    //
+    // the machines are split across a thread pool. A machine is idle only while
+    // it is blocked on input with an empty inbox, no packet half read or half
+    // written, and no output since it last read -1, so a full poll of its
+    // program has sent nothing. An idle machine is parked: it is not run, and so
+    // not fed -1, until a packet arrives for it. A worker whose machines are all
+    // parked or terminated sleeps until a packet is sent to one of them or the
+    // network stops.
+    //
+    // the network is quiescent when every machine is idle and no packet is in
+    // flight. Both are tracked by a single counter of busy machines plus packets
+    // sent but not yet taken, which a machine taking a packet raises for itself
+    // before it drops for the packet, so it never passes through zero while
+    // there is work. When it reaches zero nothing can happen until a packet is
+    // sent from outside, so the idle handler is run.
+
+    class intcode_network {
+    public:
+        // handlers return false to stop the network. They are never called
+        // concurrently with one another.
+        using packet_fn = std::function<bool(const network_packet&)>;
+        using idle_fn = std::function<bool()>;
+
+        intcode_network(const std::vector<int64_t>& nic, int size);
+        ~intcode_network();
+
+        intcode_network(const intcode_network&) = delete;
+        intcode_network& operator=(const intcode_network&) = delete;
+
+        int size() const;
+
+        // delivers a packet to the machine at p.address, which must be in the
+        // network. The idle handler uses this to restart a quiescent network.
+        void send(const network_packet& p);
+
+        // runs the machines on num_threads threads, or if num_threads is 0 on one
+        // per core, or on one when called from a pool's task such as a day of the
+        // sweep, until a handler returns false. on_external receives the packets
+        // sent to addresses outside the network and on_idle is called whenever the
+        // network is quiescent; if on_idle sends nothing the network stops.
+        void run(const packet_fn& on_external, const idle_fn& on_idle, int num_threads = 0);
+
+    private:
+        struct machine;
+        struct worker;
+
+        std::vector<std::unique_ptr<machine>> machines_;
+        std::vector<std::unique_ptr<worker>> workers_;
+
+        // busy machines plus packets in flight.
+        std::atomic<int64_t> pending_;
+        std::atomic<bool> stopping_;
+        std::mutex mutex_;
+        std::condition_variable idle_;
+        std::exception_ptr failure_;
+
+        void run_machines(worker& w, size_t first, size_t last, const packet_fn& on_external);
+        bool service(machine& m, const packet_fn& on_external);
+        void handle_output(machine& m, const packet_fn& on_external);
+        void park(machine& m);
+        void release_pending();
+        void stop();
+    };
+
+    // times a ring of intcode machines passing tokens, on the network scheduler
+    // with 1, 2, 4, ... threads; 'bench network'.
+    void benchmark_intcode_network(int size, int hops, int reps);
+
+}
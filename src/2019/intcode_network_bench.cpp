@@ -0,0 +1,81 @@
+#include "intcode_network.h"
+#include "../util/bench.h"
+#include <algorithm>
+#include <print>
+#include <thread>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // a NIC program for a ring of size machines: each machine sends a token with
+    // x = 0 and y = hops to its successor, forwards every token it receives with x
+    // incremented and y decremented, and reports a token whose y has reached 0 to
+    // address size, just outside the ring.
+
+    std::vector<int64_t> synthetic_nic(int size, int hops) {
+        constexpr int64_t id = 63, next = 64, t = 65, x = 66, y = 67;
+        constexpr int64_t start = 17, loop = 23, done = 54;
+        return {
+            3, id,
+            1001, id, 1, next,
+            1008, next, size, t,
+            1006, t, start,
+            1101, 0, 0, next,
+            4, next, 104, 0, 104, hops,                 // start:
+            3, x,                                       // loop:
+            1008, x, -1, t,
+            1005, t, loop,
+            3, y,
+            1006, y, done,
+            1001, x, 1, x,
+            1001, y, -1, y,
+            4, next, 4, x, 4, y,
+            1105, 1, loop,
+            104, size, 4, x, 4, y,                      // done:
+            1105, 1, loop,
+            0, 0, 0, 0, 0
+        };
+    }
+
+    // runs the ring until every token has been reported, returning the number of
+    // tokens that arrived having made all of their hops.
+    int run_synthetic_network(const std::vector<int64_t>& nic, int size, int hops, int threads) {
+        aoc::intcode_network network(nic, size);
+        int reports = 0;
+        int complete = 0;
+        network.run(
+            [&](const aoc::network_packet& p) {
+                ++reports;
+                complete += (p.x == hops) ? 1 : 0;
+                return reports < size;
+            },
+            []() {
+                return false;
+            },
+            threads
+        );
+        return complete;
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void aoc::benchmark_intcode_network(int size, int hops, int reps) {
+    auto nic = synthetic_nic(size, hops);
+    int max_threads = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+
+    std::println("{:>8} {:>8} {:>12} {:>8} {:>10}", "machines", "threads", "median ms", "speedup", "complete");
+    double baseline_ms = 0.0;
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        auto [ms, complete] = time_median(reps,
+            [&]() {
+                return run_synthetic_network(nic, size, hops, threads);
+            }
+        );
+        if (baseline_ms == 0.0) {
+            baseline_ms = ms;
+        }
+        std::println("{:>8} {:>8} {:>12.3f} {:>7.2f}x {:>10}", size, threads, ms, baseline_ms / ms, complete);
+    }
+}
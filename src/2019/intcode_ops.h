@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace aoc {
+
+    // the instruction set of intcode as the execution engine, its profiler and the
+    // static analysis all read it: the opcodes, the parameter modes and how an
+    // opcode word splits into them. Internal to the intcode sources.
+
+    namespace intcode_ops {
+
+        enum op_code {
+            terminate_op = 99,
+            add_op = 1,
+            mult_op = 2,
+            inp_op = 3,
+            outp_op = 4,
+            jmp_if_true_op = 5,
+            jmp_if_false_op = 6,
+            less_than_op = 7,
+            equals_op = 8,
+            set_rel_base_op = 9,
+
+            // superinstructions, which only exist in the engine's instruction cache
+            jump_op = 100,
+            skip_op,
+            const_store_op,
+            fused_branch_op
+        };
+
+        enum param_mode {
+            position = 0,
+            immediate,
+            relative
+        };
+
+        // the words covered by an arithmetic instruction or comparison, and by one
+        // fused with the conditional jump after it.
+        constexpr int k_arith_length = 4;
+        constexpr int k_fused_length = 7;
+
+        constexpr bool is_valid_opcode(int64_t op) {
+            return op == terminate_op || (op >= add_op && op <= set_rel_base_op);
+        }
+
+        constexpr int num_args(int64_t op) {
+            constexpr int k_num_args[] = { 0, 3, 3, 1, 1, 2, 2, 3, 3, 1 };
+            return (op == terminate_op) ? 0 : k_num_args[op];
+        }
+
+        constexpr bool is_arith(int op) {
+            return op == add_op || op == mult_op || op == less_than_op || op == equals_op;
+        }
+
+        constexpr bool is_branch(int op) {
+            return op == jmp_if_true_op || op == jmp_if_false_op;
+        }
+
+        constexpr int64_t arith(int op, int64_t lhs, int64_t rhs) {
+            switch (op) {
+                case add_op:
+                    return lhs + rhs;
+                case mult_op:
+                    return lhs * rhs;
+                case less_than_op:
+                    return (lhs < rhs) ? 1 : 0;
+                default:
+                    return (lhs == rhs) ? 1 : 0;
+            }
+        }
+
+        struct opcode_word {
+            int op;
+            int num_args;
+            std::array<int, 3> modes;   // position for parameters the opcode lacks
+        };
+
+        // splits an opcode word into its opcode and the modes of the parameters
+        // that opcode takes, or nothing if the opcode or one of those modes is
+        // not valid.
+        constexpr std::optional<opcode_word> decode(int64_t word) {
+            auto op = static_cast<int>(word % 100);
+            if (word < 0 || !is_valid_opcode(op)) {
+                return {};
+            }
+            opcode_word decoded{ op, num_args(op), {} };
+            auto modes = word / 100;
+            for (int i = 0; i < decoded.num_args; ++i) {
+                decoded.modes[i] = static_cast<int>(modes % 10);
+                if (decoded.modes[i] > relative) {
+                    return {};
+                }
+                modes /= 10;
+            }
+            return decoded;
+        }
+    }
+
+}
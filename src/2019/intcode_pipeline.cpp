@@ -0,0 +1,128 @@
+#include "intcode_pipeline.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::intcode_channel::intcode_channel(intcode_scheduler& scheduler, size_t capacity) :
+    buffer_(capacity),
+    head_(0),
+    size_(0),
+    scheduler_(&scheduler) {
+    if (capacity == 0) {
+        throw std::invalid_argument("intcode channel capacity must be positive");
+    }
+}
+
+void aoc::intcode_channel::push(int64_t val) {
+    if (full()) {
+        throw std::overflow_error("intcode channel is full");
+    }
+    buffer_[(head_ + size_) % buffer_.size()] = val;
+    ++size_;
+    if (reader_) {
+        scheduler_->wake(std::exchange(reader_, {}));
+    }
+}
+
+int64_t aoc::intcode_channel::pop() {
+    if (empty()) {
+        throw std::underflow_error("intcode channel is empty");
+    }
+    auto val = buffer_[head_];
+    head_ = (head_ + 1) % buffer_.size();
+    --size_;
+    if (writer_) {
+        scheduler_->wake(std::exchange(writer_, {}));
+    }
+    return val;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::intcode_process::intcode_process(std::coroutine_handle<promise_type> h) :
+    handle_(h) {
+}
+
+aoc::intcode_process::intcode_process(intcode_process&& proc) noexcept :
+    handle_(std::exchange(proc.handle_, {})) {
+}
+
+aoc::intcode_process& aoc::intcode_process::operator=(intcode_process&& proc) noexcept {
+    if (this != &proc) {
+        if (handle_) {
+            handle_.destroy();
+        }
+        handle_ = std::exchange(proc.handle_, {});
+    }
+    return *this;
+}
+
+aoc::intcode_process::~intcode_process() {
+    if (handle_) {
+        handle_.destroy();
+    }
+}
+
+std::coroutine_handle<> aoc::intcode_process::handle() const {
+    return handle_;
+}
+
+bool aoc::intcode_process::done() const {
+    return handle_.done();
+}
+
+void aoc::intcode_process::rethrow_if_failed() const {
+    if (handle_.promise().exception) {
+        std::rethrow_exception(handle_.promise().exception);
+    }
+}
+
+aoc::intcode_process aoc::run_process(
+        intcode_computer& icc, intcode_channel& inp, intcode_channel& out) {
+    for (;;) {
+        switch (icc.run_until_blocked(inp, out)) {
+            case awaiting_input:
+                co_await inp.readable();
+                break;
+            case awaiting_output:
+                co_await out.writable();
+                break;
+            default:
+                co_return;
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+void aoc::intcode_scheduler::wake(std::coroutine_handle<> h) {
+    ready_.push_back(h);
+}
+
+aoc::intcode_channel& aoc::intcode_scheduler::make_channel(size_t capacity) {
+    return channels_.emplace_back(*this, capacity);
+}
+
+void aoc::intcode_scheduler::spawn(intcode_computer& icc, intcode_channel& inp, intcode_channel& out) {
+    processes_.push_back(run_process(icc, inp, out));
+    ready_.push_back(processes_.back().handle());
+}
+
+bool aoc::intcode_scheduler::run() {
+    while (!ready_.empty()) {
+        auto h = ready_.front();
+        ready_.pop_front();
+        h.resume();
+    }
+    for (const auto& proc : processes_) {
+        proc.rethrow_if_failed();
+    }
+    return std::ranges::all_of(
+        processes_,
+        [](const auto& proc) {
+            return proc.done();
+        }
+    );
+}
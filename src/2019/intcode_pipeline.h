@@ -0,0 +1,159 @@
+#pragma once
+
+#include "intcode.h"
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <vector>
+
+namespace aoc {
+
+    class intcode_scheduler;
+
+    // a bounded first-in first-out queue of values connecting intcode machines run
+    // by a scheduler. A machine reading from an empty channel or writing to a full
+    // one suspends until the machine on the other end has made room or progress.
+    // Each channel has at most one reading and one writing machine.
+
+    class intcode_channel {
+        friend class intcode_scheduler;
+
+        std::vector<int64_t> buffer_;
+        size_t head_;
+        size_t size_;
+        intcode_scheduler* scheduler_;
+        std::coroutine_handle<> reader_;
+        std::coroutine_handle<> writer_;
+
+        struct read_awaiter {
+            intcode_channel& chan;
+
+            bool await_ready() const {
+                return !chan.empty();
+            }
+
+            void await_suspend(std::coroutine_handle<> h) {
+                chan.reader_ = h;
+            }
+
+            void await_resume() {
+            }
+        };
+
+        struct write_awaiter {
+            intcode_channel& chan;
+
+            bool await_ready() const {
+                return !chan.full();
+            }
+
+            void await_suspend(std::coroutine_handle<> h) {
+                chan.writer_ = h;
+            }
+
+            void await_resume() {
+            }
+        };
+
+    public:
+
+        intcode_channel(intcode_scheduler& scheduler, size_t capacity);
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        bool full() const {
+            return size_ == buffer_.size();
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        void push(int64_t val);
+        int64_t pop();
+
+        read_awaiter readable() {
+            return { *this };
+        }
+
+        write_awaiter writable() {
+            return { *this };
+        }
+    };
+
+    // a machine running as a coroutine: it runs until its input channel is empty
+    // or its output channel is full and then waits for the scheduler to resume it.
+
+    class intcode_process {
+    public:
+
+        struct promise_type {
+            std::exception_ptr exception;
+
+            intcode_process get_return_object() {
+                return intcode_process(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() {
+            }
+
+            void unhandled_exception() {
+                exception = std::current_exception();
+            }
+        };
+
+        intcode_process(intcode_process&& proc) noexcept;
+        intcode_process& operator=(intcode_process&& proc) noexcept;
+        ~intcode_process();
+
+        std::coroutine_handle<> handle() const;
+        bool done() const;
+        void rethrow_if_failed() const;
+
+    private:
+        std::coroutine_handle<promise_type> handle_;
+
+        explicit intcode_process(std::coroutine_handle<promise_type> h);
+    };
+
+    intcode_process run_process(intcode_computer& icc, intcode_channel& inp, intcode_channel& out);
+
+    // runs machines connected by channels in round-robin order on the calling
+    // thread, resuming a machine only once a channel it is waiting on is ready.
+
+    class intcode_scheduler {
+        friend class intcode_channel;
+
+        std::deque<intcode_channel> channels_;
+        std::vector<intcode_process> processes_;
+        std::deque<std::coroutine_handle<>> ready_;
+
+        void wake(std::coroutine_handle<> h);
+
+    public:
+        static constexpr size_t k_default_capacity = 64;
+
+        intcode_scheduler() = default;
+        intcode_scheduler(const intcode_scheduler&) = delete;
+        intcode_scheduler& operator=(const intcode_scheduler&) = delete;
+
+        intcode_channel& make_channel(size_t capacity = k_default_capacity);
+        void spawn(intcode_computer& icc, intcode_channel& inp, intcode_channel& out);
+
+        // returns true if every machine terminated and false if the machines that
+        // have not terminated are all blocked on their channels.
+        bool run();
+    };
+
+}
@@ -0,0 +1,143 @@
+#include "intcode_profile.h"
+#include "intcode_ops.h"
+#include <algorithm>
+#include <format>
+#include <numeric>
+#include <sstream>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    using namespace aoc::intcode_ops;
+
+    thread_local aoc::intcode_profile* t_active_profile = nullptr;
+
+    // the length of the bar drawn for the hottest address.
+    constexpr int k_histogram_width = 40;
+
+    std::string op_name(int op) {
+        switch (op) {
+            case add_op: return "add";
+            case mult_op: return "mul";
+            case inp_op: return "in";
+            case outp_op: return "out";
+            case jmp_if_true_op: return "jnz";
+            case jmp_if_false_op: return "jz";
+            case less_than_op: return "lt";
+            case equals_op: return "eq";
+            case set_rel_base_op: return "arb";
+            case terminate_op: return "halt";
+            default: return std::format("op{}", op);
+        }
+    }
+
+    double percent(uint64_t count, uint64_t total) {
+        return (total > 0) ? 100.0 * static_cast<double>(count) / static_cast<double>(total) : 0.0;
+    }
+
+    double mean(uint64_t total, uint64_t count) {
+        return (count > 0) ? static_cast<double>(total) / static_cast<double>(count) : 0.0;
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::intcode_profile::scope::scope(intcode_profile& profile) :
+        prev_(t_active_profile) {
+    t_active_profile = &profile;
+}
+
+aoc::intcode_profile::scope::~scope() {
+    t_active_profile = prev_;
+}
+
+aoc::intcode_profile* aoc::intcode_profile::active() {
+    return t_active_profile;
+}
+
+aoc::intcode_profile::intcode_profile(size_t trace_capacity) :
+    op_counts_{},
+    instructions_(0),
+    high_water_(-1),
+    trace_(trace_capacity),
+    traced_(0) {
+}
+
+uint64_t aoc::intcode_profile::instructions() const {
+    return instructions_;
+}
+
+uint64_t aoc::intcode_profile::op_count(int op) const {
+    return (op >= 0 && op < static_cast<int>(op_counts_.size())) ? op_counts_[op] : 0;
+}
+
+uint64_t aoc::intcode_profile::pc_count(int64_t pc) const {
+    return (pc >= 0 && pc < static_cast<int64_t>(pc_counts_.size())) ? pc_counts_[pc] : 0;
+}
+
+int64_t aoc::intcode_profile::high_water() const {
+    return high_water_;
+}
+
+std::vector<aoc::intcode_trace_entry> aoc::intcode_profile::trace() const {
+    if (traced_ <= trace_.size()) {
+        return { trace_.begin(), trace_.begin() + traced_ };
+    }
+    auto oldest = trace_.begin() + traced_ % trace_.size();
+    std::vector<intcode_trace_entry> entries(oldest, trace_.end());
+    entries.insert(entries.end(), trace_.begin(), oldest);
+    return entries;
+}
+
+std::string aoc::intcode_profile::report(size_t num_pcs, size_t num_traced) const {
+    std::stringstream ss;
+    ss << std::format("{} instructions, highest address written {}\n", instructions_, high_water_);
+    ss << std::format(
+        "{} inputs, {:.1f} ticks since the previous input or output on average, {} at most\n",
+        inputs_.count, mean(inputs_.total, inputs_.count), inputs_.max
+    );
+    ss << std::format(
+        "{} outputs, {:.1f} ticks since the previous input or output on average, {} at most\n",
+        outputs_.count, mean(outputs_.total, outputs_.count), outputs_.max
+    );
+
+    ss << "\nopcodes:\n";
+    std::vector<int> ops;
+    for (int op = 0; op < static_cast<int>(op_counts_.size()); ++op) {
+        if (op_counts_[op] > 0) {
+            ops.push_back(op);
+        }
+    }
+    std::ranges::sort(ops, [&](int lhs, int rhs) { return op_counts_[lhs] > op_counts_[rhs]; });
+    for (auto op : ops) {
+        ss << std::format("    {:<6} {:>12} {:>6.2f}%\n",
+            op_name(op), op_counts_[op], percent(op_counts_[op], instructions_));
+    }
+
+    std::vector<size_t> pcs(pc_counts_.size());
+    std::iota(pcs.begin(), pcs.end(), 0);
+    std::erase_if(pcs, [&](size_t pc) { return pc_counts_[pc] == 0; });
+    auto hottest = [&](size_t lhs, size_t rhs) { return pc_counts_[lhs] > pc_counts_[rhs]; };
+    num_pcs = std::min(num_pcs, pcs.size());
+    std::ranges::partial_sort(pcs, pcs.begin() + num_pcs, hottest);
+
+    ss << "\nhot addresses:\n";
+    for (size_t i = 0; i < num_pcs; ++i) {
+        auto pc = pcs[i];
+        auto bar = static_cast<int>(k_histogram_width * pc_counts_[pc] / pc_counts_[pcs.front()]);
+        ss << std::format("    {:05}: {:<6} {:>12} {:>6.2f}% {}\n", pc, op_name(pc_ops_[pc]),
+            pc_counts_[pc], percent(pc_counts_[pc], instructions_), std::string(std::max(bar, 1), '#'));
+    }
+
+    auto entries = trace();
+    if (!entries.empty()) {
+        num_traced = std::min(num_traced, entries.size());
+        ss << std::format("\nlast {} instructions:\n", num_traced);
+        for (auto iter = entries.end() - num_traced; iter != entries.end(); ++iter) {
+            ss << std::format("    tick {:>10}: {:05} {:<6} rb={}\n",
+                iter->ticks, iter->pc, op_name(iter->op), iter->rel_base);
+        }
+    }
+    return ss.str();
+}
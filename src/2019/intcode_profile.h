@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+    struct intcode_trace_entry {
+        int64_t pc;
+        int64_t rel_base;
+        int ticks;
+        int op;
+    };
+
+    // execution statistics recorded by the profiling build of the intcode engine:
+    // counts per opcode and per address, the ticks computed between one input or
+    // output and the next, the highest address written and, if the profile has a
+    // trace capacity, a ring buffer of the most recently executed instructions.
+    //
+    // superinstructions are counted as the instructions they replace, so the
+    // counts are those of running the program one instruction at a time: a fused
+    // arithmetic instruction and jump counts once for each, at their own
+    // addresses.
+    //
+    // the profiling engine runs instead of the usual one for every computer run on
+    // a thread while a scope is open there. A profile is not thread-safe, so work
+    // that a computer hands to other threads, such as an intcode_batch, is not
+    // recorded.
+
+    class intcode_profile {
+    public:
+        class scope {
+            intcode_profile* prev_;
+        public:
+            explicit scope(intcode_profile& profile);
+            ~scope();
+
+            scope(const scope&) = delete;
+            scope& operator=(const scope&) = delete;
+        };
+
+        // the profile recording on this thread, if any.
+        static intcode_profile* active();
+
+        explicit intcode_profile(size_t trace_capacity = 0);
+
+        void record_instruction(int64_t pc, int op, int64_t rel_base, int ticks) {
+            ++op_counts_[static_cast<uint8_t>(op)];
+            ++instructions_;
+            auto index = static_cast<size_t>(pc);
+            if (index >= pc_counts_.size()) {
+                pc_counts_.resize(index + 1, 0);
+                pc_ops_.resize(index + 1, 0);
+            }
+            ++pc_counts_[index];
+            pc_ops_[index] = static_cast<uint8_t>(op);
+            if (!trace_.empty()) {
+                trace_[traced_++ % trace_.size()] = { pc, rel_base, ticks, op };
+            }
+        }
+
+        void record_write(int64_t addr) {
+            high_water_ = std::max(high_water_, addr);
+        }
+
+        void record_input(int latency) {
+            inputs_.add(latency);
+        }
+
+        void record_output(int latency) {
+            outputs_.add(latency);
+        }
+
+        uint64_t instructions() const;
+        uint64_t op_count(int op) const;
+        uint64_t pc_count(int64_t pc) const;
+        int64_t high_water() const;
+
+        // the traced instructions, oldest first.
+        std::vector<intcode_trace_entry> trace() const;
+
+        // a summary followed by a histogram of the num_pcs hottest addresses and
+        // the end of the trace.
+        std::string report(size_t num_pcs = 20, size_t num_traced = 32) const;
+
+    private:
+        struct latency {
+            uint64_t count = 0;
+            uint64_t total = 0;
+            int max = 0;
+
+            void add(int ticks) {
+                ++count;
+                total += ticks;
+                max = std::max(max, ticks);
+            }
+        };
+
+        std::array<uint64_t, 256> op_counts_;
+        std::vector<uint64_t> pc_counts_;
+        std::vector<uint8_t> pc_ops_;
+        uint64_t instructions_;
+        latency inputs_;
+        latency outputs_;
+        int64_t high_water_;
+        std::vector<intcode_trace_entry> trace_;
+        uint64_t traced_;
+    };
+
+}
@@ -0,0 +1,109 @@
+#include "intcode.h"
+#include "intcode_ops.h"
+#include "intcode_profile.h"
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // instruction counts per opcode and per address from running an intcode
+    // program one plain instruction at a time, with the same input each time.
+    struct intcode_counts {
+        std::map<int, uint64_t> ops;
+        std::map<int64_t, uint64_t> pcs;
+    };
+
+    intcode_counts count_intcode(std::vector<int64_t> memory, int64_t input) {
+        namespace ic = aoc::intcode_ops;
+        intcode_counts counts;
+        int64_t pc = 0;
+        int64_t rel_base = 0;
+        auto cell = [&](int64_t addr) -> int64_t& {
+            if (addr >= static_cast<int64_t>(memory.size())) {
+                memory.resize(addr + 1, 0);
+            }
+            return memory.at(addr);
+        };
+        for (;;) {
+            auto decoded = ic::decode(cell(pc));
+            if (!decoded) {
+                throw std::runtime_error("bad instruction");
+            }
+            ++counts.ops[decoded->op];
+            ++counts.pcs[pc];
+            auto param = [&](int i) -> int64_t& {
+                auto& arg = cell(pc + i + 1);
+                switch (decoded->modes[i]) {
+                    case ic::immediate: return arg;
+                    case ic::relative: return cell(rel_base + arg);
+                    default: return cell(arg);
+                }
+            };
+            auto next = pc + decoded->num_args + 1;
+            switch (decoded->op) {
+                case ic::inp_op: param(0) = input; break;
+                case ic::outp_op: break;
+                case ic::jmp_if_true_op: next = (param(0) != 0) ? param(1) : next; break;
+                case ic::jmp_if_false_op: next = (param(0) == 0) ? param(1) : next; break;
+                case ic::set_rel_base_op: rel_base += param(0); break;
+                case ic::terminate_op: return counts;
+                default: param(2) = ic::arith(decoded->op, param(0), param(1)); break;
+            }
+            pc = next;
+        }
+    }
+
+    // the profile of the engine, which runs superinstructions, must count the
+    // instructions a plain run executes. The programs cover a folded constant
+    // store, jumps on immediates, fused compares and jumps taken and not, and a
+    // fused add that overwrites its own jump.
+    bool intcode_profile_counts_plain_instructions() {
+        const std::vector<std::vector<int64_t>> programs = {
+            { 1101,0,0,100, 1001,100,1,100, 1007,100,10,101, 1005,101,4, 4,100, 99 },
+            { 1101,0,6,4, 1005,4,9, 99 },
+            {
+                3,21,1008,21,8,20,1005,20,22,107,8,21,20,1006,20,31,1106,0,36,98,0,0,
+                1002,21,125,20,4,20,1105,1,46,104,999,1105,1,46,1101,1000,1,20,4,20,
+                1105,1,46,98,99
+            }
+        };
+        for (const auto& program : programs) {
+            for (int64_t input : { 5, 8, 11 }) {
+                auto expected = count_intcode(program, input);
+                aoc::intcode_computer icc(program);
+                aoc::intcode_profile profile;
+                {
+                    aoc::intcode_profile::scope scope(profile);
+                    icc.run([&]() { return input; }, [](int64_t) {});
+                }
+                if (profile.instructions() != static_cast<uint64_t>(icc.ticks())) {
+                    return false;
+                }
+                for (int op = 0; op < 256; ++op) {
+                    auto iter = expected.ops.find(op);
+                    if (profile.op_count(op) != ((iter != expected.ops.end()) ? iter->second : 0)) {
+                        return false;
+                    }
+                }
+                for (auto [pc, count] : expected.pcs) {
+                    if (profile.pc_count(pc) != count) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+const aoc::self_test_table& aoc::intcode_self_tests() {
+    static const self_test_table tests = {
+        { "intcode profile counts plain instructions", intcode_profile_counts_plain_instructions }
+    };
+    return tests;
+}
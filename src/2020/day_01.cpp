@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -50,13 +49,18 @@ namespace {
     }
 }
 
-void aoc::y2020::day_01(const std::string& title) {
-
-    auto nums = aoc::file_to_string_vector(aoc::input_path(2020, 1)) | rv::transform(
-        [](auto&& str) {return std::stoi(str); }
-    ) | r::to<std::vector<int>>();
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}", do_part_1(nums) );
-    std::println("  part 2: {}", do_part_2(nums) );
+aoc::solver_ptr aoc::y2020::day_01() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 1)) | rv::transform(
+                [](auto&& str) {return std::stoi(str); }
+            ) | r::to<std::vector<int>>();
+        },
+        [](const auto& nums) {
+            return do_part_1(nums);
+        },
+        [](const auto& nums) {
+            return do_part_2(nums);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -57,12 +56,18 @@ namespace {
     }
 }
 
-void aoc::y2020::day_02(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 2)) | rv::transform(
-        parse_pwd_policy
-    ) | r::to<std::vector<password_policy>>();
-
-    std::println("--- Day 2: {} ---", title);
-    std::println("  part 1: {}", count_valid( input, is_valid_part1 ));
-    std::println("  part 2: {}", count_valid( input, is_valid_part2 ));
+aoc::solver_ptr aoc::y2020::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 2)) | rv::transform(
+                parse_pwd_policy
+            ) | r::to<std::vector<password_policy>>();
+        },
+        [](const auto& input) {
+            return count_valid( input, is_valid_part1 );
+        },
+        [](const auto& input) {
+            return count_valid( input, is_valid_part2 );
+        }
+    );
 }
\ No newline at end of file
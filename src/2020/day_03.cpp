@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -54,22 +53,25 @@ namespace {
     }
 }
 
-void aoc::y2020::day_03(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 3));
-
-    std::println("--- Day 3: {} ---", title);
-    std::println("  part 1: {}", count_trees(input, {3,1}));
-
-    std::array<loc, 5> slopes = {{ {1,1},{3,1},{5,1},{7,1},{1,2} }};
-    std::println("  part 2: {}",
-        r::fold_left(
-            slopes | rv::transform(
-                [&input](const loc& slope)->int64_t {
-                    return count_trees(input, slope);
-                }
-            ),
-            1,
-            std::multiplies<int64_t>()
-        )
+aoc::solver_ptr aoc::y2020::day_03() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 3));
+        },
+        [](const auto& input) {
+            return count_trees(input, {3,1});
+        },
+        [](const auto& input) {
+            std::array<loc, 5> slopes = {{ {1,1},{3,1},{5,1},{7,1},{1,2} }};
+            return r::fold_left(
+                slopes | rv::transform(
+                    [&input](const loc& slope)->int64_t {
+                        return count_trees(input, slope);
+                    }
+                ),
+                1,
+                std::multiplies<int64_t>()
+            );
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <map>
 #include <set>
@@ -132,30 +131,32 @@ namespace {
     }
 }
 
-void aoc::y2020::day_04(const std::string& title) {
-    auto input = flatten(
-            aoc::file_to_string_vector(aoc::input_path(2020, 4))
-        ) | rv::transform(
-            parse_passport
-        ) | r::to<std::vector<passport>>();
-
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}", 
-        r::fold_left(
-            input | rv::transform([](auto&& passport) {
-                return has_necessary_fields(passport) ? 1 : 0; }
-            ),
-            0,
-            std::plus<>()
-        )
-    );
-    std::println("  part 2: {}",
-        r::fold_left(
-            input | rv::transform([](auto&& passport) {
-                return has_valid_fields(passport) ? 1 : 0; }
-            ),
-            0,
-            std::plus<>()
-        )
+aoc::solver_ptr aoc::y2020::day_04() {
+    return aoc::make_solver(
+        []() {
+            return flatten(
+                    aoc::file_to_string_vector(aoc::input_path(2020, 4))
+                ) | rv::transform(
+                    parse_passport
+                ) | r::to<std::vector<passport>>();
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform([](auto&& passport) {
+                    return has_necessary_fields(passport) ? 1 : 0; }
+                ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform([](auto&& passport) {
+                    return has_valid_fields(passport) ? 1 : 0; }
+                ),
+                0,
+                std::plus<>()
+            );
+        }
     );
 }
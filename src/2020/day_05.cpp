@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -59,10 +58,16 @@ namespace {
     }
 }
 
-void aoc::y2020::day_05(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 5));
-
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}", r::max(input | rv::transform( seat_id)) );
-    std::println("  part 2: {}", find_seat(input));
+aoc::solver_ptr aoc::y2020::day_05() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 5));
+        },
+        [](const auto& input) {
+            return r::max(input | rv::transform( seat_id));
+        },
+        [](const auto& input) {
+            return find_seat(input);
+        }
+    );
 }
\ No newline at end of file
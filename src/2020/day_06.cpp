@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -47,24 +46,26 @@ namespace {
 
 }
 
-void aoc::y2020::day_06(const std::string& title) {
-    auto input = aoc::group_strings_separated_by_blank_lines(
-        aoc::file_to_string_vector( aoc::input_path(2020, 6) )
-    );
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}", 
-        r::fold_left(
-            input | rv::transform(count_anyone_answered_yes),
-            0,
-            std::plus<>()
-        )
-    );
-    std::println("  part 2: {}",
-        r::fold_left(
-            input | rv::transform(count_everyone_answered_yes),
-            0,
-            std::plus<>()
-        )
+aoc::solver_ptr aoc::y2020::day_06() {
+    return aoc::make_solver(
+        []() {
+            return aoc::group_strings_separated_by_blank_lines(
+                aoc::file_to_string_vector( aoc::input_path(2020, 6) )
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(count_anyone_answered_yes),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(count_everyone_answered_yes),
+                0,
+                std::plus<>()
+            );
+        }
     );
 }
\ No newline at end of file
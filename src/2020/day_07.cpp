@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -117,12 +116,18 @@ namespace {
     }
 }
 
-void aoc::y2020::day_07(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 7));
-    auto rules = input | rv::transform(parse_rule) | r::to<std::vector<rule>>();
-    auto graph = build_graph(rules);
-
-    std::println("--- Day 7: {} ---", title);
-    std::println("  part 1: {}", do_part1(graph));
-    std::println("  part 2: {}", count_contained_bags(graph, "shiny gold"));
+aoc::solver_ptr aoc::y2020::day_07() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2020, 7));
+            auto rules = input | rv::transform(parse_rule) | r::to<std::vector<rule>>();
+            return build_graph(rules);
+        },
+        [](const auto& graph) {
+            return do_part1(graph);
+        },
+        [](const auto& graph) {
+            return count_contained_bags(graph, "shiny gold");
+        }
+    );
 }
\ No newline at end of file
@@ -1,11 +1,10 @@
 #include "../util/util.h"
+#include "../util/input.h"
+#include "../util/register_vm.h"
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
-#include <unordered_map>
-#include <unordered_set>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -13,73 +12,48 @@ namespace rv = std::ranges::views;
 /*------------------------------------------------------------------------------------------------*/
 
 namespace {
-    enum op_code {
-        nop,
-        acc,
-        jmp
-    };
-
-    struct instruction {
-        op_code op;
-        int arg;
-    };
-
-    struct program_state {
-        int instr_counter;
-        int accumulator;
-    };
 
-    instruction str_to_instr(const std::string& str) {
-        auto parts = aoc::split(str, ' ');
-        static const std::unordered_map<std::string, op_code> str_to_op = {
-            {"nop" , nop},
-            {"acc" , acc},
-            {"jmp" , jmp}
-        };
-        return {
-            str_to_op.at(parts.front()),
-            std::stoi(parts.back())
-        };
+    // the accumulator is register 0.
+    const aoc::vm_dialect& handheld_dialect() {
+        static const aoc::vm_dialect dialect({
+            {"nop", aoc::vm_op::nop, aoc::vm_none(), aoc::vm_none(), aoc::vm_none()},
+            {"acc", aoc::vm_op::add, aoc::vm_fixed(0), aoc::vm_fixed(0), aoc::vm_written(0)},
+            {"jmp", aoc::vm_op::jmp, aoc::vm_none(), aoc::vm_written(0), aoc::vm_none()}
+        });
+        return dialect;
     }
 
-    program_state perform_instr(const instruction& instr, const program_state& state) {
-        auto new_state = state;
-        switch (instr.op) {
-            case nop:
-                new_state.instr_counter++;
-                break;
-            case acc:
-                new_state.accumulator += instr.arg;
-                new_state.instr_counter++;
-                break;
-            case jmp:
-                new_state.instr_counter += instr.arg;
-                break;
+    // stops the program before it runs any instruction a second time.
+    struct loop_handler : aoc::vm_handler {
+        std::vector<bool> visited;
+
+        bool before(int64_t ip, const aoc::vm_registers& regs) {
+            if (visited[ip]) {
+                return false;
+            }
+            visited[ip] = true;
+            return true;
         }
-        return new_state;
-    }
+    };
     
-    std::tuple<int,bool> run_until_loop( const std::vector<instruction>& code) {
-        int n = static_cast<int>(code.size());
-        std::unordered_set<int> line_set;
-        program_state state = { 0,0 };
-        while (state.instr_counter < n && !line_set.contains(state.instr_counter)) {
-            line_set.insert(state.instr_counter);
-            const auto& instr = code.at(state.instr_counter);
-            state = perform_instr(instr, state);
-        }
+    std::tuple<int,bool> run_until_loop(const std::vector<aoc::vm_statement>& code) {
+        aoc::vm_machine machine(aoc::vm_assemble(handheld_dialect(), code));
+        loop_handler handler{ {}, std::vector<bool>(code.size(), false) };
+        auto status = machine.run(handler);
         return {
-            state.accumulator,
-            state.instr_counter == n
+            static_cast<int>(machine[0]),
+            status == aoc::vm_status::halted && machine.ip() == static_cast<int64_t>(code.size())
         };
     }
 
-    int run_without_loop(const std::vector<instruction>& code) {
+    int run_without_loop(const std::vector<aoc::vm_statement>& code) {
         int n = static_cast<int>(code.size());
+        auto nop = handheld_dialect().code("nop");
+        auto jmp = handheld_dialect().code("jmp");
         for (int i = 0; i < n; ++i) {
-            if (code[i].op == nop || code[i].op == jmp) {
+            if (code[i].code == nop || code[i].code == jmp) {
                 auto altered_code = code;
-                altered_code[i].op = (altered_code[i].op == nop) ? jmp : nop;
+                altered_code[i].code = (altered_code[i].code == nop) ? jmp : nop;
                 auto [a, success] = run_until_loop(altered_code);
                 if (success) {
                     return a;
@@ -90,11 +64,19 @@ namespace {
     }
 }
 
-void aoc::y2020::day_08(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 8));
-    auto code = input | rv::transform(str_to_instr) | r::to<std::vector<instruction>>();
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}", std::get<0>(run_until_loop(code)));
-    std::println("  part 2: {}", run_without_loop(code));
+aoc::solver_ptr aoc::y2020::day_08() {
+    return aoc::make_solver(
+        []() {
+            aoc::mapped_file input(aoc::input_path(2020, 8));
+            return input.lines() | rv::transform(
+                [](auto&& str) { return handheld_dialect().parse(str); }
+            ) | r::to<std::vector>();
+        },
+        [](const auto& code) {
+            return std::get<0>(run_until_loop(code));
+        },
+        [](const auto& code) {
+            return run_without_loop(code);
+        }
+    );
 }
\ No newline at end of file
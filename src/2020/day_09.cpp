@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -69,14 +68,19 @@ namespace {
     }
 }
 
-void aoc::y2020::day_09(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 9)) |
-        rv::transform([](auto&& str) {return aoc::string_to_int64(str); }) |
-        r::to<std::vector<int64_t>>();
-
-    std::println("--- Day 9: {} ---", title);
-
-    int64_t invalid;
-    std::println("  part 1: {}", invalid = find_first_invalid_number(input, 25));
-    std::println("  part 2: {}", find_encryption_weakness(input, invalid));
+aoc::solver_ptr aoc::y2020::day_09() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 9)) |
+                rv::transform([](auto&& str) {return aoc::string_to_int64(str); }) |
+                r::to<std::vector<int64_t>>();
+        },
+        [](const auto& input) {
+            return find_first_invalid_number(input, 25);
+        },
+        [](const auto& input) {
+            auto invalid = find_first_invalid_number(input, 25);
+            return find_encryption_weakness(input, invalid);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -62,11 +61,17 @@ namespace {
     }
 }
 
-void aoc::y2020::day_10(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 10)) |
-        rv::transform([](auto&& str) {return std::stoi(str); }) | r::to<std::vector<int>>();
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1: {}", do_part_1(input) );
-    std::println("  part 2: {}", do_part_2(input) );
+aoc::solver_ptr aoc::y2020::day_10() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 10)) |
+                rv::transform([](auto&& str) {return std::stoi(str); }) | r::to<std::vector<int>>();
+        },
+        [](const auto& input) {
+            return do_part_1(input);
+        },
+        [](const auto& input) {
+            return do_part_2(input);
+        }
+    );
 }
\ No newline at end of file
@@ -176,15 +176,16 @@ namespace {
     }
 }
 
-void aoc::y2020::day_11(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 11));
-
-    std::println("--- Day 11: {} ---", title);
-    
-    std::println("  part 1: {}", 
-        count_occupied_at_equilibrium(input, immediate_occupied_neigbors, 4) 
-    );
-    std::println("  part 2: {}",
-        count_occupied_at_equilibrium(input, occupied_neigbors_line_of_sight, 5)
+aoc::solver_ptr aoc::y2020::day_11() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 11));
+        },
+        [](const auto& input) {
+            return count_occupied_at_equilibrium(input, immediate_occupied_neigbors, 4);
+        },
+        [](const auto& input) {
+            return count_occupied_at_equilibrium(input, occupied_neigbors_line_of_sight, 5);
+        }
     );
 }
\ No newline at end of file
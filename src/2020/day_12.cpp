@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -153,11 +152,17 @@ namespace {
     }
 }
 
-void aoc::y2020::day_12(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 12)) |
-        rv::transform(parse_nav_instruction) | r::to<std::vector<nav_instruction>>();
-
-    std::println("--- Day 12: {} ---", title);
-    std::println("  part 1: {}", follow_nav_instructions(input));
-    std::println("  part 2: {}", follow_waypoint_nav_instructions(input));
+aoc::solver_ptr aoc::y2020::day_12() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 12)) |
+                rv::transform(parse_nav_instruction) | r::to<std::vector<nav_instruction>>();
+        },
+        [](const auto& input) {
+            return follow_nav_instructions(input);
+        },
+        [](const auto& input) {
+            return follow_waypoint_nav_instructions(input);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <format>
@@ -63,15 +62,18 @@ namespace {
     }
 }
 
-void aoc::y2020::day_13(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 13));
-
-    std::println("--- Day 13: {} ---", title);
-    std::println("  part 1: {}", do_part_1(input));
-
-    //TODO: do this with the chinese remainder theorem, or whatever.
-    // i just solved this one with mathematica...
-    std::println("  part 2:\n\n{}",
-        generate_mathematica(input.back())
+aoc::solver_ptr aoc::y2020::day_13() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 13));
+        },
+        [](const auto& input) {
+            return do_part_1(input);
+        },
+        [](const auto& input) {
+            //TODO: do this with the chinese remainder theorem, or whatever.
+            // i just solved this one with mathematica...
+            return generate_mathematica(input.back());
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -132,11 +131,17 @@ void masked_address_assignment(state& state, const command& cmd) {
     }
 }
 
-void aoc::y2020::day_14(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 14)) |
-        rv::transform(parse_command) | r::to<std::vector<command>>();
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}", run_program_and_sum_memory(input, masked_value_assignment));
-    std::println("  part 2: {}", run_program_and_sum_memory(input, masked_address_assignment));
+aoc::solver_ptr aoc::y2020::day_14() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 14)) |
+                rv::transform(parse_command) | r::to<std::vector<command>>();
+        },
+        [](const auto& input) {
+            return run_program_and_sum_memory(input, masked_value_assignment);
+        },
+        [](const auto& input) {
+            return run_program_and_sum_memory(input, masked_address_assignment);
+        }
+    );
 }
\ No newline at end of file
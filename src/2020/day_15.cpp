@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <deque>
@@ -62,12 +61,18 @@ namespace {
     }
 }
 
-void aoc::y2020::day_15(const std::string& title) {
-    auto starting_numbers = aoc::extract_numbers(
-        aoc::file_to_string(aoc::input_path(2020, 15))
+aoc::solver_ptr aoc::y2020::day_15() {
+    return aoc::make_solver(
+        []() {
+            return aoc::extract_numbers(
+                aoc::file_to_string(aoc::input_path(2020, 15))
+            );
+        },
+        [](const auto& starting_numbers) {
+            return nth_number_spoken(starting_numbers, 2020);
+        },
+        [](const auto& starting_numbers) {
+            return nth_number_spoken(starting_numbers, 30000000);
+        }
     );
-
-    std::println("--- Day 15: {} ---", title);
-    std::println("  part 1: {}", nth_number_spoken(starting_numbers, 2020));
-    std::println("  part 2: {}", nth_number_spoken(starting_numbers, 30000000));
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -166,22 +165,29 @@ namespace {
     }
 }
 
-void aoc::y2020::day_16(const std::string& title) {
-    auto [rules, my_ticket, tickets] = parse(
-        aoc::file_to_string_vector(aoc::input_path(2020, 16))
+aoc::solver_ptr aoc::y2020::day_16() {
+    return aoc::make_solver(
+        []() {
+            return parse(
+                aoc::file_to_string_vector(aoc::input_path(2020, 16))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [rules, my_ticket, tickets] = inp;
+            return r::fold_left(
+                tickets | rv::transform( 
+                    [&rules](const ticket& ticket)->int{
+                        auto invalid = not_valid_value(ticket, rules);
+                        return (invalid) ? *invalid : 0;
+                    }
+                ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& inp) {
+            const auto& [rules, my_ticket, tickets] = inp;
+            return do_part_2(rules, my_ticket, tickets);
+        }
     );
-    std::println("--- Day 16: {} ---", title);
-    std::println("  part 1: {}", 
-        r::fold_left(
-            tickets | rv::transform( 
-                [&rules](const ticket& ticket)->int{
-                    auto invalid = not_valid_value(ticket, rules);
-                    return (invalid) ? *invalid : 0;
-                }
-            ),
-            0,
-            std::plus<>()
-        )
-    ); 
-    std::println("  part 2: {}", do_part_2(rules, my_ticket, tickets));
 }
\ No newline at end of file
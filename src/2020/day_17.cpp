@@ -1,13 +1,11 @@
 #include "../util/util.h"
 #include "../util/concat.h"
+#include "../util/vec4.h"
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
-#include <unordered_set>
 #include <unordered_map>
-#include <boost/functional/hash.hpp>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -15,38 +13,8 @@ namespace rv = std::ranges::views;
 /*------------------------------------------------------------------------------------------------*/
 
 namespace {
-    struct vec4 {
-        int w;
-        int x;
-        int y;
-        int z;
-
-        bool operator==(const vec4 rhs) const {
-            return w == rhs.w && x == rhs.x && y == rhs.y && z == rhs.z;
-        }
-    };
-
-    vec4 operator+(const vec4& lhs, const vec4& rhs) {
-        return {
-            lhs.w + rhs.w,
-            lhs.x + rhs.x,
-            lhs.y + rhs.y,
-            lhs.z + rhs.z
-        };
-    }
-
-    struct hash_vec4 {
-        size_t operator()(const vec4& v) const {
-            size_t seed = 0;
-            boost::hash_combine(seed, v.w);
-            boost::hash_combine(seed, v.x);
-            boost::hash_combine(seed, v.y);
-            boost::hash_combine(seed, v.z);
-            return seed;
-        }
-    };
-
-    using vec4_set = std::unordered_set<vec4, hash_vec4>;
+    using vec4 = aoc::vec4<int>;
+    using vec4_set = aoc::vec4_set<int>;
 
     std::vector<vec4> basic_neighborhood(int dimensions) {
         auto fourth_dimension = (dimensions == 4) ? rv::iota(-1, 2) : rv::iota(0, 1);
@@ -133,12 +101,18 @@ namespace {
     }
 }
 
-void aoc::y2020::day_17(const std::string& title) {
-    auto input = parse_input(
-        aoc::file_to_string_vector(aoc::input_path(2020, 17))
+aoc::solver_ptr aoc::y2020::day_17() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(aoc::input_path(2020, 17))
+            );
+        },
+        [](const auto& input) {
+            return alive_after_six_generations(input, 3);
+        },
+        [](const auto& input) {
+            return alive_after_six_generations(input, 4);
+        }
     );
-
-    std::println("--- Day 17: {} ---", title);
-    std::println("  part 1: {}", alive_after_six_generations(input, 3) );
-    std::println("  part 2: {}", alive_after_six_generations(input, 4) );
 }
\ No newline at end of file
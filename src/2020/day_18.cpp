@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <memory>
@@ -253,31 +252,32 @@ namespace {
     }
 }
 
-void aoc::y2020::day_18(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 18));
-
-    std::println("--- Day 18: {} ---", title);
-    std::println("  part 1: {}", 
-        r::fold_left(
-            input | rv::transform(
-                [](auto&& str)->int64_t {
-                    return parse_no_precedence_expr(str)->eval();
-                }
-            ),
-            0ll,
-            std::plus<int64_t>()
-        )
-    );
-    
-    std::println("  part 2: {}",
-        r::fold_left(
-            input | rv::transform(
-                [](auto&& str)->int64_t {
-                    return parse_reversed_precedence_expr(str)->eval();
-                }
-            ),
-            0ll,
-            std::plus<int64_t>()
-        )
+aoc::solver_ptr aoc::y2020::day_18() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 18));
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(
+                    [](auto&& str)->int64_t {
+                        return parse_no_precedence_expr(str)->eval();
+                    }
+                ),
+                0ll,
+                std::plus<int64_t>()
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(
+                    [](auto&& str)->int64_t {
+                        return parse_reversed_precedence_expr(str)->eval();
+                    }
+                ),
+                0ll,
+                std::plus<int64_t>()
+            );
+        }
     );
 }
\ No newline at end of file
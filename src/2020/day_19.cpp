@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -182,14 +181,20 @@ namespace {
     }
 }
 
-void aoc::y2020::day_19(const std::string& title) {
-    
-    auto [rules, messages] = parse_input(
-        aoc::file_to_string_vector(aoc::input_path(2020, 19))
+aoc::solver_ptr aoc::y2020::day_19() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(aoc::input_path(2020, 19))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [rules, messages] = inp;
+            return count_valid_messages( rules, messages );
+        },
+        [](const auto& inp) {
+            const auto& [rules, messages] = inp;
+            return count_valid_messages( new_rules(rules), messages );
+        }
     );
-    
-    std::println("--- Day 19: {} ---", title);
-    std::println("  part 1: {}", count_valid_messages( rules, messages ));
-    std::println("  part 2: {}", count_valid_messages( new_rules(rules), messages ));
-    
 }
\ No newline at end of file
@@ -3,7 +3,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -418,16 +417,21 @@ namespace {
     }
 }
 
-void aoc::y2020::day_20(const std::string& title) {
-    auto tiles = parse_tiles(
-        aoc::file_to_string_vector(aoc::input_path(2020, 20))
-    );
-    
-    std::println("--- Day 20: {} ---", title);
-    std::println("  part 1: {}", r::fold_left(
-        find_corners(tiles) | rv::transform([](auto ct) {return ct.id;}), 1, std::multiplies<int64_t>())
+aoc::solver_ptr aoc::y2020::day_20() {
+    return aoc::make_solver(
+        []() {
+            return parse_tiles(
+                aoc::file_to_string_vector(aoc::input_path(2020, 20))
+            );
+        },
+        [](const auto& tiles) {
+            return r::fold_left(
+                find_corners(tiles) | rv::transform([](auto ct) {return ct.id;}), 1, std::multiplies<int64_t>()
+            );
+        },
+        [](const auto& tiles) {
+            auto image = build_image(tiles);
+            return water_roughness(image);
+        }
     );
-    auto image = build_image(tiles);
-    std::println("  part 2: {}", water_roughness(image));
-    
 }
\ No newline at end of file
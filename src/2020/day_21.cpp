@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -160,14 +159,22 @@ namespace {
     }
 }
 
-void aoc::y2020::day_21(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 21)) |
-        rv::transform(parse_food) | r::to<std::vector<food>>();
-
-    map allergen_to_ingred;
-    auto ingreds = find_ingreds_without_allergens(input, allergen_to_ingred);
-
-    std::println("--- Day 21: {} ---", title);
-    std::println("  part 1: {}", count_ingred_usage(input, ingreds));
-    std::println("  part 2: {}", dangerous_ingredient_list(allergen_to_ingred));
+aoc::solver_ptr aoc::y2020::day_21() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2020, 21)) |
+                rv::transform(parse_food) | r::to<std::vector<food>>();
+            map allergen_to_ingred;
+            auto ingreds = find_ingreds_without_allergens(input, allergen_to_ingred);
+            return std::tuple{ std::move(input), std::move(allergen_to_ingred), std::move(ingreds) };
+        },
+        [](const auto& inp) {
+            const auto& [input, allergen_to_ingred, ingreds] = inp;
+            return count_ingred_usage(input, ingreds);
+        },
+        [](const auto& inp) {
+            const auto& [input, allergen_to_ingred, ingreds] = inp;
+            return dangerous_ingredient_list(allergen_to_ingred);
+        }
+    );
 }
\ No newline at end of file
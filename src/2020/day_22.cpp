@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <deque>
@@ -136,12 +135,20 @@ namespace {
     }
 }
 
-void aoc::y2020::day_22(const std::string& title) {
-    auto [player_1, player_2] = parse(
-        aoc::file_to_string_vector(aoc::input_path(2020, 22))
+aoc::solver_ptr aoc::y2020::day_22() {
+    return aoc::make_solver(
+        []() {
+            return parse(
+                aoc::file_to_string_vector(aoc::input_path(2020, 22))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [player_1, player_2] = inp;
+            return score_deck(play_combat(player_1, player_2));
+        },
+        [](const auto& inp) {
+            const auto& [player_1, player_2] = inp;
+            return score_deck(play_recursive_combat(player_1, player_2));
+        }
     );
-
-    std::println("--- Day 22: {} ---", title);
-    std::println("  part 1: {}", score_deck(play_combat(player_1, player_2)));
-    std::println("  part 2: {}", score_deck(play_recursive_combat(player_1, player_2)));
 }
\ No newline at end of file
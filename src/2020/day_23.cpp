@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -182,11 +181,17 @@ namespace {
     }
 }
 
-void aoc::y2020::day_23(const std::string& title) {
-    auto input = aoc::file_to_string(aoc::input_path(2020, 23));
-    cup_circle cups(string_to_ints(input) );
-
-    std::println("--- Day 23: {} ---", title);
-    std::println("  part 1: {}", cup_game(cups, 100));
-    std::println("  part 2: {}", do_part_2(input));
+aoc::solver_ptr aoc::y2020::day_23() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string(aoc::input_path(2020, 23));
+        },
+        [](const auto& input) {
+            cup_circle cups(string_to_ints(input));
+            return cup_game(cups, 100);
+        },
+        [](const auto& input) {
+            return do_part_2(input);
+        }
+    );
 }
\ No newline at end of file
@@ -1,12 +1,10 @@
 #include "../util/util.h"
+#include "../util/vec2.h"
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
-#include <unordered_set>
-#include <boost/functional/hash.hpp>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -14,31 +12,8 @@ namespace rv = std::ranges::views;
 /*------------------------------------------------------------------------------------------------*/
 
 namespace {
-    struct vec2 {
-        int x;
-        int y;
-
-        bool operator==(vec2 rhs) const {
-            return x == rhs.x && y == rhs.y;
-        }
-    };
-
-    vec2 operator+(const vec2& lhs, const vec2& rhs) {
-        return {
-            lhs.x + rhs.x,
-            lhs.y + rhs.y
-        };
-    }
-
-    struct hash_vec2 {
-        size_t operator()(const vec2& pt) const {
-            size_t seed = 0;
-            boost::hash_combine(seed, pt.x);
-            boost::hash_combine(seed, pt.y);
-            return seed;
-        }
-    };
-    using vec2_set = std::unordered_set<vec2, hash_vec2>;
+    using vec2 = aoc::vec2<int>;
+    using vec2_set = aoc::vec2_set<int>;
 
     enum direction {
         east, ne, nw, west, sw, se
@@ -156,13 +131,18 @@ namespace {
     }
 }
 
-void aoc::y2020::day_24(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 24)) |
-        rv::transform(parse_directions) | r::to<std::vector<std::vector<direction>>>();
-
-    auto initial_tiles = flip_tiles(input);
-
-    std::println("--- Day 24: {} ---", title);
-    std::println("  part 1: {}", initial_tiles.size());
-    std::println("  part 2: {}", do_n_generations(initial_tiles, 100));
+aoc::solver_ptr aoc::y2020::day_24() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2020, 24)) |
+                rv::transform(parse_directions) | r::to<std::vector<std::vector<direction>>>();
+            return flip_tiles(input);
+        },
+        [](const auto& initial_tiles) {
+            return initial_tiles.size();
+        },
+        [](const auto& initial_tiles) {
+            return do_n_generations(initial_tiles, 100);
+        }
+    );
 }
\ No newline at end of file
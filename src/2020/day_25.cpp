@@ -2,7 +2,6 @@
 #include "y2020.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -42,11 +41,17 @@ namespace {
     }
 }
 
-void aoc::y2020::day_25(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2020, 25)) |
-        rv::transform(aoc::string_to_int64) | r::to<std::vector<int64_t>>();
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}", find_encryption_key( input[0] , input[1] ));
-    std::println("  part 2: {}", "<xmas freebie>");
+aoc::solver_ptr aoc::y2020::day_25() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2020, 25)) |
+                rv::transform(aoc::string_to_int64) | r::to<std::vector<int64_t>>();
+        },
+        [](const auto& input) {
+            return find_encryption_key( input[0] , input[1] );
+        },
+        [](const auto&) {
+            return "<xmas freebie>";
+        }
+    );
 }
\ No newline at end of file
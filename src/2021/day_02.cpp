@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -29,8 +28,8 @@ namespace {
         static const std::unordered_map<std::string, point> tbl = {
             {"forward", {1,0}}, {"down", {0,1}}, {"up", {0,-1}}
         };
-        const auto& [dir, amnt] = aoc::split_to_tuple<2>(inp, ' ');
-        return std::stoi(amnt) * tbl.at(dir);
+        const auto& [dir, amnt] = aoc::split_to_tuple<std::string, int>(inp, ' ');
+        return amnt * tbl.at(dir);
     }
 
     int do_part_1(const std::vector<std::string>& input) {
@@ -52,8 +51,7 @@ namespace {
     }
     
     sub_state update_sub_state(const sub_state& ss, const std::string& inp) {
-        const auto& [dir, amnt_str] = aoc::split_to_tuple<2>(inp, ' ');
-        int amnt = std::stoi(amnt_str);
+        const auto& [dir, amnt] = aoc::split_to_tuple<std::string, int>(inp, ' ');
         std::unordered_map<std::string, sub_state> tbl = {
             {"forward", {{amnt, ss.aim * amnt}, 0}}, 
             {"down", {{0, 0}, amnt}}, 
@@ -72,10 +70,16 @@ namespace {
     }
 }
 
-void aoc::y2021::day_02(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 2));
-
-    std::println("--- Day 2: {} ---", title);
-    std::println("  part 1: {}", do_part_1(input) );
-    std::println("  part 2: {}", do_part_2(input));
+aoc::solver_ptr aoc::y2021::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2021, 2));
+        },
+        [](const auto& input) {
+            return do_part_1(input);
+        },
+        [](const auto& input) {
+            return do_part_2(input);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <sstream>
@@ -72,16 +71,18 @@ namespace {
     }
 }
 
-void aoc::y2021::day_03(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 3));
-    
-    std::println("--- Day 3: {} ---", title);
-
-    auto [most, least] = common_digits_numbers(input);
-    std::println("  part 1: {}", most * least);
-
-    std::println("  part 2: {}", 
-        find_rating(input, true) * find_rating(input, false)
+aoc::solver_ptr aoc::y2021::day_03() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2021, 3));
+        },
+        [](const auto& input) {
+            auto [most, least] = common_digits_numbers(input);
+            return most * least;
+        },
+        [](const auto& input) {
+            return find_rating(input, true) * find_rating(input, false);
+        }
     );
 }
 
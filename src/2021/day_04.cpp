@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <regex>
 
@@ -201,15 +200,21 @@ namespace {
     }
 }
 
-void aoc::y2021::day_04(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 4));
-    auto [bingo_numbers, boards] = parse_game_data(input);
-
-    std::println("--- Day 4: {} ---", title);
-
-    auto [first_winning_board, first_winning_number] = find_first_winner(bingo_numbers, boards);
-    std::println("  part 1: {}", first_winning_board.score(first_winning_number));
-
-    auto [winning_board, final_number] = find_last_winner(bingo_numbers, boards);
-    std::println("  part 2: {}", winning_board.score(final_number));
+aoc::solver_ptr aoc::y2021::day_04() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2021, 4));
+            return parse_game_data(input);
+        },
+        [](const auto& inp) {
+            const auto& [bingo_numbers, boards] = inp;
+            auto [first_winning_board, first_winning_number] = find_first_winner(bingo_numbers, boards);
+            return first_winning_board.score(first_winning_number);
+        },
+        [](const auto& inp) {
+            const auto& [bingo_numbers, boards] = inp;
+            auto [winning_board, final_number] = find_last_winner(bingo_numbers, boards);
+            return winning_board.score(final_number);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <regex>
@@ -85,15 +84,23 @@ namespace {
     }
 }
 
-void aoc::y2021::day_05(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 5));
-    auto lines = parse_input(input);
-    auto [wd, hgt] = get_dimensions(lines);
-
-    auto board_part_1 = init_board(wd, hgt);
-    auto board_part_2 = board_part_1;
-
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}", draw_lines(board_part_1, lines, true));
-    std::println("  part 2: {}", draw_lines(board_part_2, lines, false));
+aoc::solver_ptr aoc::y2021::day_05() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2021, 5));
+            auto lines = parse_input(input);
+            auto [wd, hgt] = get_dimensions(lines);
+            auto board_part_1 = init_board(wd, hgt);
+            auto board_part_2 = board_part_1;
+            return std::tuple{ std::move(lines), std::move(board_part_1), std::move(board_part_2) };
+        },
+        [](auto inp) {
+            auto& [lines, board_part_1, board_part_2] = inp;
+            return draw_lines(board_part_1, lines, true);
+        },
+        [](auto inp) {
+            auto& [lines, board_part_1, board_part_2] = inp;
+            return draw_lines(board_part_2, lines, false);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -47,12 +46,18 @@ namespace {
 
 }
 
-void aoc::y2021::day_06(const std::string& title) {
-    school_o_fish s(
-        aoc::extract_numbers(aoc::file_to_string(aoc::input_path(2021, 6)))
+aoc::solver_ptr aoc::y2021::day_06() {
+    return aoc::make_solver(
+        []() {
+            return school_o_fish(
+                aoc::extract_numbers(aoc::file_to_string(aoc::input_path(2021, 6)))
+            );
+        },
+        [](auto s) {
+            return s.simulate_n_days(80);
+        },
+        [](auto s) {
+            return s.simulate_n_days(256);
+        }
     );
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}", s.simulate_n_days(80));
-    std::println("  part 2: {}", s.simulate_n_days(256 - 80));
 }
\ No newline at end of file
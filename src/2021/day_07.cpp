@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -50,14 +49,19 @@ namespace {
     }
 }
 
-void aoc::y2021::day_07(const std::string& title) {
-    auto positions = aoc::extract_numbers(aoc::file_to_string(aoc::input_path(2021, 7)));
-
-    // this one is actually just the median but whatever i wrote the find_minima routine for the other one
-    auto [minima_1, loc_1] = find_minima(positions, [](int n) {return n; });
-    auto [minima_2, loc_2] = find_minima(positions, [](int n) {return (n * (n + 1)) / 2; });
-
-    std::println("--- Day 7: {} ---", title);
-    std::println("  part 1: {}", minima_1);
-    std::println("  part 2: {}", minima_2);
+aoc::solver_ptr aoc::y2021::day_07() {
+    return aoc::make_solver(
+        []() {
+            return aoc::extract_numbers(aoc::file_to_string(aoc::input_path(2021, 7)));
+        },
+        [](const auto& positions) {
+            // this one is actually just the median but whatever i wrote the find_minima routine for the other one
+            auto [minima, loc] = find_minima(positions, [](int n) {return n; });
+            return minima;
+        },
+        [](const auto& positions) {
+            auto [minima, loc] = find_minima(positions, [](int n) {return (n * (n + 1)) / 2; });
+            return minima;
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -175,19 +174,24 @@ namespace {
     }
 }
 
-void aoc::y2021::day_08(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 8));
-    auto display_data = parse_input(input);
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}", puzzle_part_1(display_data));
-
-    // Just use brute force ... there is a cleverer way to come up
-    // with but C++ is fast enough to just brute force this.
-    int sum = 0;
-    for (const auto& dd : display_data) {
-        auto display_value = crack_code(dd);
-        sum += display_value;
-    }
-    std::println("  part 2: {}", sum);
+aoc::solver_ptr aoc::y2021::day_08() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2021, 8));
+            return parse_input(input);
+        },
+        [](const auto& display_data) {
+            return puzzle_part_1(display_data);
+        },
+        [](const auto& display_data) {
+            // Just use brute force ... there is a cleverer way to come up
+            // with but C++ is fast enough to just brute force this.
+            int sum = 0;
+            for (const auto& dd : display_data) {
+                auto display_value = crack_code(dd);
+                sum += display_value;
+            }
+            return sum;
+        }
+    );
 }
\ No newline at end of file
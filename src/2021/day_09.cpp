@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -140,12 +139,21 @@ namespace {
     }
 }
 
-void aoc::y2021::day_09(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 9));
-    auto grid = strings_to_2D_array_of_digits(input);
-    auto minima = find_minima(grid);
-
-    std::println("--- Day 9: {} ---", title);
-    std::println("  part 1: {}", score_puzzle_1(grid, minima));
-    std::println("  part 2: {}", puzzle_2(grid, minima));
+aoc::solver_ptr aoc::y2021::day_09() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2021, 9));
+            auto grid = strings_to_2D_array_of_digits(input);
+            auto minima = find_minima(grid);
+            return std::tuple{ std::move(grid), std::move(minima) };
+        },
+        [](const auto& inp) {
+            const auto& [grid, minima] = inp;
+            return score_puzzle_1(grid, minima);
+        },
+        [](const auto& inp) {
+            const auto& [grid, minima] = inp;
+            return puzzle_2(grid, minima);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -148,10 +147,16 @@ namespace {
     }
 }
 
-void aoc::y2021::day_10(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 10));
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1: {}", do_part_1(input));
-    std::println("  part 2: {}", do_part_2(input));
+aoc::solver_ptr aoc::y2021::day_10() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2021, 10));
+        },
+        [](const auto& input) {
+            return do_part_1(input);
+        },
+        [](const auto& input) {
+            return do_part_2(input);
+        }
+    );
 }
\ No newline at end of file
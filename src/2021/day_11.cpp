@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -149,13 +148,22 @@ namespace {
     }
 }
 
-void aoc::y2021::day_11(const std::string& title) {
-    auto part_1_cells = aoc::strings_to_2D_array_of_digits(
-        aoc::file_to_string_vector(aoc::input_path(2021, 11))
+aoc::solver_ptr aoc::y2021::day_11() {
+    return aoc::make_solver(
+        []() {
+            auto part_1_cells = aoc::strings_to_2D_array_of_digits(
+                aoc::file_to_string_vector(aoc::input_path(2021, 11))
+            );
+            auto part_2_cells = part_1_cells;
+            return std::tuple{ std::move(part_1_cells), std::move(part_2_cells) };
+        },
+        [](auto inp) {
+            auto& [part_1_cells, part_2_cells] = inp;
+            return simulate(part_1_cells, 100);
+        },
+        [](auto inp) {
+            auto& [part_1_cells, part_2_cells] = inp;
+            return simulate_until_synchonization(part_2_cells);
+        }
     );
-    auto part_2_cells = part_1_cells;
-
-    std::println("--- Day 11: {} ---", title);
-    std::println("  part 1: {}", simulate(part_1_cells, 100));
-    std::println("  part 2: {}", simulate_until_synchonization(part_2_cells));
 }
\ No newline at end of file
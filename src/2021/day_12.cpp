@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -240,13 +239,18 @@ namespace {
     };
 }
 
-void aoc::y2021::day_12(const std::string& title) {
-    graph g(aoc::file_to_string_vector(aoc::input_path(2021, 12)));
-
-    std::println("--- Day 12: {} ---", title);
-    traversal<part1_visited_set> t1(g);
-    std::println("  part 1: {}", t1.all_paths().size());
-
-    traversal<part2_visited_set> t2(g);
-    std::println("  part 2: {}", t2.all_paths().size());
+aoc::solver_ptr aoc::y2021::day_12() {
+    return aoc::make_solver(
+        []() {
+            return graph(aoc::file_to_string_vector(aoc::input_path(2021, 12)));
+        },
+        [](const auto& g) {
+            traversal<part1_visited_set> t1(g);
+            return t1.all_paths().size();
+        },
+        [](const auto& g) {
+            traversal<part2_visited_set> t2(g);
+            return t2.all_paths().size();
+        }
+    );
 }
\ No newline at end of file
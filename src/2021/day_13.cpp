@@ -2,10 +2,8 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
-#include <iostream>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -204,25 +202,35 @@ namespace {
         return sum;
     }
 
-    void display_grid(const grid_t& ary) {
-        for (const auto& row : ary) {
-            for (int value : row) {
-                std::cout << ((value == 0) ? ' ' : '#');
-            }
-            std::cout << "\n";
-        }
+    std::string grid_to_string(const grid_t& ary) {
+        return ary | rv::transform(
+                [](const auto& row) {
+                    return row | rv::transform(
+                            [](int value) {
+                                return (value == 0) ? ' ' : '#';
+                            }
+                        ) | r::to<std::string>();
+                }
+            ) | rv::join_with('\n') | r::to<std::string>();
     }
 }
 
-void aoc::y2021::day_13(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 13));
-    auto [grid, folds] = parse_folding_instructions(input);
-
-    std::println("--- Day 13: {} ---", title);
-    std::println("  part 1: {}", count_dots(perform_fold(grid, folds[0])));
-    std::println("  part 2: \n");
-    for (const auto& f : folds) {
-        grid = perform_fold(grid, f);
-    }
-    display_grid(grid);
+aoc::solver_ptr aoc::y2021::day_13() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2021, 13));
+            return parse_folding_instructions(input);
+        },
+        [](const auto& inp) {
+            const auto& [grid, folds] = inp;
+            return count_dots(perform_fold(grid, folds[0]));
+        },
+        [](const auto& inp) {
+            auto [grid, folds] = inp;
+            for (const auto& f : folds) {
+                grid = perform_fold(grid, f);
+            }
+            return grid_to_string(grid);
+        }
+    );
 }
\ No newline at end of file
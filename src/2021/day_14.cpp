@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -138,12 +137,20 @@ namespace {
     }
 }
 
-void aoc::y2021::day_14(const std::string& title) {
-    auto [seed, rules] = parse_day_14_input(
-        aoc::file_to_string_vector(aoc::input_path(2021, 14))
+aoc::solver_ptr aoc::y2021::day_14() {
+    return aoc::make_solver(
+        []() {
+            return parse_day_14_input(
+                aoc::file_to_string_vector(aoc::input_path(2021, 14))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [seed, rules] = inp;
+            return do_day_14_part(seed, rules, 10);
+        },
+        [](const auto& inp) {
+            const auto& [seed, rules] = inp;
+            return do_day_14_part(seed, rules, 40);
+        }
     );
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}", do_day_14_part(seed, rules, 10));
-    std::println("  part 2: {}", do_day_14_part(seed, rules, 40));
 }
\ No newline at end of file
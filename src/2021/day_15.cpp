@@ -1,8 +1,8 @@
 #include "../util/util.h"
+#include "../util/graph_search.h"
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -47,152 +47,41 @@ namespace {
     }
 
     using grid_loc_t = std::tuple<int, int>;
-    struct dijkstra_info_t {
-        int dist;
-        grid_loc_t prev;
-        std::vector<grid_loc_t> adj_locs;
-
-        dijkstra_info_t() :
-            dist(std::numeric_limits<int>::max()),
-            prev({ -1,-1 })
-        {}
-    };
     using grid_t = std::vector<std::vector<int>>;
-    using dijkstra_state_t = std::vector<std::vector< dijkstra_info_t>>;
-
-    /*
-       dijkstra's algorithm requires a queue from which you can pop the minimum priority item efficiently,
-       and also change the priority of items in the queue efficiently. Implement with a multimap as the
-       actual prioirty queue but also keeping in sync a hash table mapping locations to multimap items to
-       facillitate efficiently changing priorities by being able to delete items i.e. change priotities
-       by deleting and re-inserting with a new priority.
-    */
-
-    class priority_queue_of_locs {
-    private:
-        using priority_map_t = std::multimap<int, grid_loc_t>;
-
-        struct tuple_hash_t {
-            std::size_t operator()(const grid_loc_t& k) const {
-                return std::hash<int>{}(std::get<0>(k) ^ std::get<1>(k));
-            }
-        };
-        using loc_to_map_t = std::unordered_map<grid_loc_t, priority_map_t::iterator, tuple_hash_t>;
-
-        priority_map_t priority_map_;
-        loc_to_map_t loc_to_map_;
-
-    public:
-
-        void insert(const grid_loc_t& loc, int priority) {
-            auto iter = priority_map_.insert({ priority, loc });
-            loc_to_map_[loc] = iter;
-        }
-
-        void remove(const grid_loc_t& loc) {
-            priority_map_.erase(loc_to_map_[loc]);
-            loc_to_map_.erase(loc);
-        }
-
-        void change_priority(const grid_loc_t& loc, int new_priority) {
-            remove(loc);
-            insert(loc, new_priority);
-        }
 
-        grid_loc_t pop() {
-            auto loc = priority_map_.begin()->second;
-            remove(loc);
-            return loc;
-        }
-
-        bool contains(const grid_loc_t& loc) const {
-            return loc_to_map_.find(loc) != loc_to_map_.end();
-        }
-
-        bool empty() const {
-            return loc_to_map_.empty();
+    struct tuple_hash_t {
+        std::size_t operator()(const grid_loc_t& k) const {
+            return std::hash<int>{}(std::get<0>(k) ^ std::get<1>(k));
         }
     };
 
-    std::vector<grid_loc_t> shortest_path_from_dijkstra_state(const std::vector<std::vector<dijkstra_info_t>>& dijkstra_state) {
-        std::vector<grid_loc_t> path;
-        auto [wd, hgt] = get_wd_and_hgt(dijkstra_state);
-        grid_loc_t loc = { wd - 1, hgt - 1 };
-        while (loc != grid_loc_t{ 0,0 }) {
-            path.push_back(loc);
-            auto [x, y] = loc;
-            loc = dijkstra_state[y][x].prev;
-        }
-        //path.push_back({ 0,0 });
-        std::reverse(path.begin(), path.end());
-        return path;
-    }
-
-    priority_queue_of_locs initialize_priority_queue(const dijkstra_state_t& state) {
-        priority_queue_of_locs unvisited;
-        auto [wd, hgt] = get_wd_and_hgt(state);
-        for (int y = 0; y < hgt; ++y) {
-            for (int x = 0; x < wd; ++x) {
-                unvisited.insert({ x,y }, state[y][x].dist);
-            }
-        }
-        return unvisited;
-    }
-
-    dijkstra_state_t initialize_dijkstra_state(const grid_t& grid) {
-        auto [wd, hgt] = get_wd_and_hgt(grid);
-        auto dijkstra_state = make_2d_array<dijkstra_info_t>(wd, hgt);
-        dijkstra_state[0][0].dist = grid[0][0];
-
-        // just store the cell adjacencies in the dijkstra state as a speed
-        // optimization. Otherwise would need to call get_4cell in the
-        // inner loop of the algorithm...
-        for (int y = 0; y < hgt; ++y) {
-            for (int x = 0; x < wd; ++x) {
-                dijkstra_state[y][x].adj_locs = get_4cell_neighbor_locs(grid, x, y);
-            }
-        }
-
-        return dijkstra_state;
-    }
-
-    std::vector<grid_loc_t> dijkstra_shortest_path(const grid_t& grid) {
+    // entering a cell costs its risk level, so the weight of the shortest path
+    // from the top left to the bottom right is the distance the search finds.
+    template<template<typename, typename> typename Queue>
+    int get_weight_of_shortest_path(const grid_t& grid) {
         auto [wd, hgt] = get_wd_and_hgt(grid);
-        auto dijkstra_state = initialize_dijkstra_state(grid);
-        auto unvisited = initialize_priority_queue(dijkstra_state);
-
-        while (!unvisited.empty()) {
-            auto u = unvisited.pop();
-            auto [u_x, u_y] = u;
-            auto dist_u = dijkstra_state[u_y][u_x].dist;
-
-            for (const auto& neighbor : dijkstra_state[u_y][u_x].adj_locs) {
-                if (!unvisited.contains(neighbor)) {
-                    continue;
+        grid_loc_t target = { wd - 1, hgt - 1 };
+        auto result = aoc::dijkstra_search<aoc::search_tracking::distances, Queue>(
+            grid_loc_t{ 0, 0 },
+            [&](const grid_loc_t& u) {
+                auto [x, y] = u;
+                return get_4cell_neighbor_locs(grid, x, y) | rv::transform(
+                    [&](const grid_loc_t& v) {
+                        auto [v_x, v_y] = v;
+                        return std::tuple<grid_loc_t, int>{ v, grid[v_y][v_x] };
+                    }
+                );
+            },
+            [&](const grid_loc_t& loc) {
+                return loc == target;
+            },
+            aoc::indexed_by<grid_loc_t, tuple_hash_t>(static_cast<size_t>(wd) * hgt,
+                [wd](const grid_loc_t& loc) {
+                    return static_cast<size_t>(std::get<1>(loc)) * wd + std::get<0>(loc);
                 }
-                auto [v_x, v_y] = neighbor;
-                auto candidate_dist = dist_u + grid[v_y][v_x];
-                if (candidate_dist < dijkstra_state[v_y][v_x].dist) {
-                    dijkstra_state[v_y][v_x].dist = candidate_dist;
-                    dijkstra_state[v_y][v_x].prev = u;
-                    unvisited.change_priority(neighbor, candidate_dist);
-                }
-            }
-        }
-
-        return shortest_path_from_dijkstra_state(dijkstra_state);
-    }
-
-    int get_path_weight(const grid_t& grid, const std::vector<grid_loc_t>& path) {
-        int sum = 0;
-        for (const auto& [x, y] : path) {
-            sum += grid[y][x];
-        }
-        return sum;
-    }
-
-    int get_weight_of_shortest_path(const grid_t& grid) {
-        return get_path_weight(grid, dijkstra_shortest_path(grid));
+            )
+        );
+        return *result.goal_distance();
     }
 
     grid_t enlarge_grid(const grid_t& grid)
@@ -234,12 +123,28 @@ namespace {
     }
 }
 
-void aoc::y2021::day_15(const std::string& title) {
-    auto grid = aoc::strings_to_2D_array_of_digits(
-        aoc::file_to_string_vector(aoc::input_path(2021, 15))
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2021::day_15_with_queue() {
+    return aoc::make_solver(
+        []() {
+            return aoc::strings_to_2D_array_of_digits(
+                aoc::file_to_string_vector(aoc::input_path(2021, 15))
+            );
+        },
+        [](const auto& grid) {
+            return get_weight_of_shortest_path<Queue>(grid);
+        },
+        [](const auto& grid) {
+            return get_weight_of_shortest_path<Queue>(enlarge_grid(grid));
+        }
     );
+}
+
+template aoc::solver_ptr aoc::y2021::day_15_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2021::day_15_with_queue<aoc::indexed_4ary_heap>();
+template aoc::solver_ptr aoc::y2021::day_15_with_queue<aoc::radix_heap>();
 
-    std::println("--- Day 15: {} ---", title);
-    std::println("  part 1: {}", get_weight_of_shortest_path(grid));
-    std::println("  part 2: {}", get_weight_of_shortest_path(enlarge_grid(grid)));
+// edge weights are single digits, so the monotone radix heap applies.
+aoc::solver_ptr aoc::y2021::day_15() {
+    return day_15_with_queue<aoc::radix_heap>();
 }
\ No newline at end of file
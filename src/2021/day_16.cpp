@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <numeric>
@@ -253,13 +252,18 @@ namespace {
     }
 }
 
-void aoc::y2021::day_16(const std::string& title) {
-
-    auto bytes = hex_string_to_binary(file_to_string(aoc::input_path(2021, 16)));
-    bit_iterator iter = bytes.begin();
-    auto packet = parse_packet(iter);
-
-    std::println("--- Day 16: {} ---", title);
-    std::println("  part 1: {}", sum_of_version_numbers(packet));
-    std::println("  part 2: {}", evaluate_packet(packet));
+aoc::solver_ptr aoc::y2021::day_16() {
+    return aoc::make_solver(
+        []() {
+            auto bytes = hex_string_to_binary(file_to_string(aoc::input_path(2021, 16)));
+            bit_iterator iter = bytes.begin();
+            return parse_packet(iter);
+        },
+        [](const auto& packet) {
+            return sum_of_version_numbers(packet);
+        },
+        [](const auto& packet) {
+            return evaluate_packet(packet);
+        }
+    );
 }
\ No newline at end of file
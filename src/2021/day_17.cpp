@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -83,15 +82,21 @@ namespace {
     }
 }
 
-void aoc::y2021::day_17(const std::string& title) {
-    auto target = rectangle{
-        aoc::extract_numbers(
-            aoc::file_to_string(aoc::input_path(2021, 17)),
-            true
-        )
-    };
-
-    std::println("--- Day 17: {} ---", title);
-    std::println("  part 1: {}", find_highest_hit(target));
-    std::println("  part 2: {}", find_all_hits(target));
+aoc::solver_ptr aoc::y2021::day_17() {
+    return aoc::make_solver(
+        []() {
+            return rectangle{
+                aoc::extract_numbers(
+                    aoc::file_to_string(aoc::input_path(2021, 17)),
+                    true
+                )
+            };
+        },
+        [](const auto& target) {
+            return find_highest_hit(target);
+        },
+        [](const auto& target) {
+            return find_all_hits(target);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <variant>
@@ -361,7 +360,7 @@ namespace {
     }
 
     uint64_t find_largest_sum(const std::vector<snail_num>& snums) {
-        static auto find_largest_with_ith = [&snums](int i) {
+        auto find_largest_with_ith = [&snums](int i) {
             uint64_t largest = 0;
             for (int j = 0; j < snums.size(); ++j) {
                 if (i == j) {
@@ -381,10 +380,16 @@ namespace {
     }
 }
 
-void aoc::y2021::day_18(const std::string& title) {
-    auto snums = to_snums(aoc::file_to_string_vector(aoc::input_path(2021, 18)));
-
-    std::println("--- Day 18: {} ---", title);
-    std::println("  part 1: {}", magnitude(sum_of_snums(snums)));
-    std::println("  part 2: {}", find_largest_sum(snums));
+aoc::solver_ptr aoc::y2021::day_18() {
+    return aoc::make_solver(
+        []() {
+            return to_snums(aoc::file_to_string_vector(aoc::input_path(2021, 18)));
+        },
+        [](const auto& snums) {
+            return magnitude(sum_of_snums(snums));
+        },
+        [](const auto& snums) {
+            return find_largest_sum(snums);
+        }
+    );
 }
\ No newline at end of file
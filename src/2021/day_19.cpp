@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <iterator>
@@ -203,13 +202,22 @@ namespace {
     }
 }
 
-void aoc::y2021::day_19(const std::string& title) {
-    auto all_scanner_data = parse_scanner_data(
-        aoc::file_to_string_vector(aoc::input_path(2021, 19))
+aoc::solver_ptr aoc::y2021::day_19() {
+    return aoc::make_solver(
+        []() {
+            auto all_scanner_data = parse_scanner_data(
+                aoc::file_to_string_vector(aoc::input_path(2021, 19))
+            );
+            auto [beacons, scanners] = find_beacons_and_scanners(all_scanner_data);
+            return std::tuple{ std::move(beacons), std::move(scanners) };
+        },
+        [](const auto& inp) {
+            const auto& [beacons, scanners] = inp;
+            return beacons.size();
+        },
+        [](const auto& inp) {
+            const auto& [beacons, scanners] = inp;
+            return farthest_apart_scanner_distance(scanners);
+        }
     );
-    auto [beacons, scanners] = find_beacons_and_scanners(all_scanner_data);
-
-    std::println("--- Day 19: {} ---", title);
-    std::println("  part 1: {}", beacons.size());
-    std::println("  part 2: {}", farthest_apart_scanner_distance(scanners));
 }
\ No newline at end of file
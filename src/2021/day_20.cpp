@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <bitset>
 #include <numeric>
@@ -150,13 +149,22 @@ namespace {
     }
 }
 
-void aoc::y2021::day_20(const std::string& title) {
-    auto [dictionary_str, image] = parse_day20_input(
-        aoc::file_to_string_vector(aoc::input_path(2021, 20))
+aoc::solver_ptr aoc::y2021::day_20() {
+    return aoc::make_solver(
+        []() {
+            auto [dictionary_str, image] = parse_day20_input(
+                aoc::file_to_string_vector(aoc::input_path(2021, 20))
+            );
+            std::bitset<512> dictionary(dictionary_str);
+            return std::tuple{ std::move(image), std::move(dictionary) };
+        },
+        [](const auto& inp) {
+            const auto& [image, dictionary] = inp;
+            return do_part_1(dictionary, image);
+        },
+        [](const auto& inp) {
+            const auto& [image, dictionary] = inp;
+            return do_part_2(dictionary, image);
+        }
     );
-    std::bitset<512> dictionary(dictionary_str);
-
-    std::println("--- Day 20: {} ---", title);
-    std::println("  part 1: {}", do_part_1(dictionary, image));
-    std::println("  part 2: {}", do_part_2(dictionary, image));
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <boost/multi_array.hpp>
 
@@ -208,16 +207,22 @@ namespace {
     }
 }
 
-void aoc::y2021::day_21(const std::string& title) {
-    auto [player_1, player_2] = parse_input(
-        aoc::file_to_string(aoc::input_path(2021, 21))
+aoc::solver_ptr aoc::y2021::day_21() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string(aoc::input_path(2021, 21))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [player_1, player_2] = inp;
+            auto [rolls, score] = play_deterministic_dirac(player_1, player_2, 1000, 100);
+            return rolls * score;
+        },
+        [](const auto& inp) {
+            const auto& [player_1, player_2] = inp;
+            auto [p1_wins, p2_wins] = play_dirac(player_1, player_2);
+            return std::max(p1_wins, p2_wins);
+        }
     );
-
-    std::println("--- Day 21: {} ---", title);
-
-    auto [rolls, score] = play_deterministic_dirac(player_1, player_2, 1000, 100);
-    std::println("  part 1: {}", rolls * score);
-
-    auto [p1_wins, p2_wins] = play_dirac(player_1, player_2);
-    std::println("  part 2: {}", std::max(p1_wins, p2_wins));
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <set>
 #include <regex>
@@ -142,12 +141,18 @@ namespace {
     }
 }
 
-void aoc::y2021::day_22(const std::string& title) {
-    auto cubes = parse_cube_ops(
-        aoc::file_to_string_vector(aoc::input_path(2021, 22))
+aoc::solver_ptr aoc::y2021::day_22() {
+    return aoc::make_solver(
+        []() {
+            return parse_cube_ops(
+                aoc::file_to_string_vector(aoc::input_path(2021, 22))
+            );
+        },
+        [](const auto& cubes) {
+            return do_part_1(cubes);
+        },
+        [](const auto& cubes) {
+            return do_cube_ops(cubes);
+        }
     );
-
-    std::println("--- Day 22: {} ---", title);
-    std::println("  part 1: {}", do_part_1(cubes));
-    std::println("  part 2: {}", do_cube_ops(cubes));
 }
\ No newline at end of file
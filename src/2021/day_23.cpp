@@ -551,11 +551,12 @@ namespace {
         std::println("");
     }
 
+    template<template<typename, typename> typename Queue>
     int dijkstra_shortest_path(const burrow_graph& g, const burrow_state& start) {
 
         std::unordered_map<burrow_state, int, state_hash> dist;
         std::unordered_map<burrow_state, burrow_state, state_hash> prev;
-        aoc::priority_queue<burrow_state, state_hash> queue;
+        aoc::priority_queue<burrow_state, state_hash, Queue> queue;
         queue.insert(start, 0);
         dist[start] = 0;
         int least = std::numeric_limits<int>::max();
@@ -588,17 +589,34 @@ namespace {
 
 }
 
-void aoc::y2021::day_23(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 23));
-    auto burrow = make_borrow_graph(false);
-    auto start = burrow_state(input);
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2021::day_23_with_queue() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2021, 23));
+            auto burrow = make_borrow_graph(false);
+            auto start = burrow_state(input);
+            auto supersized_burrow = make_borrow_graph(true);
+            input.insert(input.begin() + 3, "  #D#B#A#C#");
+            input.insert(input.begin() + 3, "  #D#C#B#A#");
+            auto supersized_start = burrow_state(input);
+            return std::tuple{ std::move(burrow), std::move(start), std::move(supersized_burrow), std::move(supersized_start) };
+        },
+        [](const auto& inp) {
+            const auto& [burrow, start, supersized_burrow, supersized_start] = inp;
+            return dijkstra_shortest_path<Queue>(burrow, start);
+        },
+        [](const auto& inp) {
+            const auto& [burrow, start, supersized_burrow, supersized_start] = inp;
+            return dijkstra_shortest_path<Queue>(supersized_burrow, supersized_start);
+        }
+    );
+}
 
-    auto supersized_burrow = make_borrow_graph(true);
-    input.insert(input.begin() + 3, "  #D#B#A#C#");
-    input.insert(input.begin() + 3, "  #D#C#B#A#");
-    auto supersized_start = burrow_state(input);
+template aoc::solver_ptr aoc::y2021::day_23_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2021::day_23_with_queue<aoc::indexed_4ary_heap>();
+template aoc::solver_ptr aoc::y2021::day_23_with_queue<aoc::radix_heap>();
 
-    std::println("--- Day 23: {} ---", title);
-    std::println("  part 1: {}", dijkstra_shortest_path(burrow, start));
-    std::println("  part 2: {}", dijkstra_shortest_path(supersized_burrow, supersized_start));
+aoc::solver_ptr aoc::y2021::day_23() {
+    return day_23_with_queue<aoc::radix_heap>();
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
 #include "../util/util.h"
+#include "../util/input.h"
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <variant>
@@ -54,7 +54,7 @@ namespace {
         return { std::stoi(str) };
     }
 
-    command str_to_command(const std::string& line) {
+    command str_to_command(std::string_view line) {
         auto parts = aoc::split(line, ' ');
         if (parts.size() == 2) {
             return {
@@ -665,22 +665,26 @@ namespace {
 
 }
 
-void aoc::y2021::day_24(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 24));
-    auto commands = input | rv::transform(str_to_command) | r::to<std::vector<command>>();
-
-    int function_sz = static_cast<int>(commands.size()) / 14;
-    auto func_cmds = commands | rv::chunk(function_sz) | r::to<std::vector<std::vector<command>>>();
-    auto functions = rv::enumerate(func_cmds) | rv::transform(
-            [](auto&& i_cmds) {
-                const auto& [i, cmds] = i_cmds;
-                return alu_function(cmds, i);
-            }
-        ) | r::to<std::vector<alu_function>>();
-    auto subroutines = split_funcs_into_subroutines(functions);
-
-    std::println("--- Day 24: {} ---", title);
-    std::println("  part 1: {}", highest_model_number(subroutines));
-    std::println("  part 2: {}", lowest_model_number(subroutines));
-    
+aoc::solver_ptr aoc::y2021::day_24() {
+    return aoc::make_solver(
+        []() {
+            aoc::mapped_file input(aoc::input_path(2021, 24));
+            auto commands = input.lines() | rv::transform(str_to_command) | r::to<std::vector<command>>();
+            int function_sz = static_cast<int>(commands.size()) / 14;
+            auto func_cmds = commands | rv::chunk(function_sz) | r::to<std::vector<std::vector<command>>>();
+            auto functions = rv::enumerate(func_cmds) | rv::transform(
+                    [](auto&& i_cmds) {
+                        const auto& [i, cmds] = i_cmds;
+                        return alu_function(cmds, i);
+                    }
+                ) | r::to<std::vector<alu_function>>();
+            return split_funcs_into_subroutines(functions);
+        },
+        [](const auto& subroutines) {
+            return highest_model_number(subroutines);
+        },
+        [](const auto& subroutines) {
+            return lowest_model_number(subroutines);
+        }
+    );
 }
\ No newline at end of file
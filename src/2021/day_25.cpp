@@ -2,7 +2,6 @@
 #include "y2021.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <tuple>
@@ -116,10 +115,16 @@ namespace {
     }
 }
 
-void aoc::y2021::day_25(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2021, 25));
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}", move_cucumbers(input));
-    std::println("  part 2: {}", "<xmas freebie>");
+aoc::solver_ptr aoc::y2021::day_25() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2021, 25));
+        },
+        [](const auto& input) {
+            return move_cucumbers(input);
+        },
+        [](const auto&) {
+            return "<xmas freebie>";
+        }
+    );
 }
\ No newline at end of file
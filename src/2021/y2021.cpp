@@ -1,47 +1,32 @@
 #include "y2021.h"
-#include <vector>
-#include <functional>
-#include <print>
 
-void aoc::y2021::do_advent_of_code(int day) {
-    const static auto advent_of_code_2021 = std::vector<std::function<void()>>{
-        []() { day_01( "Sonar Sweep" ); },
-        []() { day_02( "Dive!" );  },
-        []() { day_03( "Binary Diagnostic" );  },
-        []() { day_04( "Giant Squid" ); },
-        []() { day_05( "Hydrothermal Venture" );  },
-        []() { day_06( "Lanternfish" );  },
-        []() { day_07( "The Treachery of Whales" ); },
-        []() { day_08( "Seven Segment Search");  },
-        []() { day_09( "Smoke Basin");  },
-        []() { day_10( "Syntax Scoring"); },
-        []() { day_11( "Dumbo Octopus");  },
-        []() { day_12( "Passage Pathing");  },
-        []() { day_13( "Transparent Origami");  },
-        []() { day_14( "Extended Polymerization");  },
-        []() { day_15( "Chiton");  },
-        []() { day_16( "Packet Decoder"); },
-        []() { day_17( "Trick Shot"); },
-        []() { day_18( "Snailfish"); },
-        []() { day_19( "Beacon Scanner"); },
-        []() { day_20( "Trench Map"); },
-        []() { day_21( "Dirac Dice"); },
-        []() { day_22( "Reactor Reboot"); },
-        []() { day_23( "Amphipod"); },
-        []() { day_24( "Arithmetic Logic Unit"); },
-        []() { day_25( "Sea Cucumber"); }
+const aoc::day_table& aoc::y2021::days() {
+    const static auto advent_of_code_2021 = aoc::day_table{
+        { "Sonar Sweep", day_01 },
+        { "Dive!", day_02 },
+        { "Binary Diagnostic", day_03 },
+        { "Giant Squid", day_04 },
+        { "Hydrothermal Venture", day_05 },
+        { "Lanternfish", day_06 },
+        { "The Treachery of Whales", day_07 },
+        { "Seven Segment Search", day_08 },
+        { "Smoke Basin", day_09 },
+        { "Syntax Scoring", day_10 },
+        { "Dumbo Octopus", day_11 },
+        { "Passage Pathing", day_12 },
+        { "Transparent Origami", day_13 },
+        { "Extended Polymerization", day_14 },
+        { "Chiton", day_15 },
+        { "Packet Decoder", day_16 },
+        { "Trick Shot", day_17 },
+        { "Snailfish", day_18 },
+        { "Beacon Scanner", day_19 },
+        { "Trench Map", day_20 },
+        { "Dirac Dice", day_21 },
+        { "Reactor Reboot", day_22 },
+        { "Amphipod", day_23 },
+        { "Arithmetic Logic Unit", day_24 },
+        { "Sea Cucumber", day_25 }
     };
-
-    auto index = day - 1;
-    if (index < 0) {
-        std::print("invalid day: {0}\n", day);
-        return;
-    }
-
-    if (index < advent_of_code_2021.size()) {
-        advent_of_code_2021[index]();
-    }
-    else {
-        std::print("Day {0} is not complete.\n", day);
-    }
+    return advent_of_code_2021;
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -75,35 +74,37 @@ namespace {
     }
 }
 
-void aoc::y2022::day_02(const std::string& title) {
-    auto input = aoc::file_to_string_vector(aoc::input_path(2022, 2));
-    
-    auto total_score_part1 = r::fold_left(
-        input |
-            rv::transform(
-                [](const auto& inp_line)->int {
-                    auto [p1_shape, p2_shape] = parse_input_line_1(inp_line);
-                    return score_match(p1_shape, p2_shape);
-                }
-            ),
-        0,
-        std::plus<>()
+aoc::solver_ptr aoc::y2022::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2022, 2));
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input |
+                    rv::transform(
+                        [](const auto& inp_line)->int {
+                            auto [p1_shape, p2_shape] = parse_input_line_1(inp_line);
+                            return score_match(p1_shape, p2_shape);
+                        }
+                    ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input |
+                    rv::transform(
+                        [](const auto& inp_line)->int {
+                            auto [desired_outcome, p2_shape] = parse_input_line_2(inp_line);
+                            auto p1_shape = shape_to_yield_outcome(p2_shape, desired_outcome);
+                            return score_match(p1_shape, p2_shape);
+                        }
+                    ),
+                0,
+                std::plus<>()
+            );
+        }
     );
-
-    auto total_score_part2 = r::fold_left(
-        input |
-            rv::transform(
-                [](const auto& inp_line)->int {
-                    auto [desired_outcome, p2_shape] = parse_input_line_2(inp_line);
-                    auto p1_shape = shape_to_yield_outcome(p2_shape, desired_outcome);
-                    return score_match(p1_shape, p2_shape);
-                }
-            ),
-        0,
-        std::plus<>()
-    );
-
-    std::println( "--- Day 2: {} ---", title );
-    std::println( "  part 1: {}" , total_score_part1 );
-    std::println( "  part 2: {}" , total_score_part2 );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -56,31 +55,34 @@ namespace {
     }
 }
 
-void aoc::y2022::day_03(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 3));
-    auto part_1 = r::fold_left(
-        input | rv::transform(
-            [](const auto& inp_line)->int {
-                return priority_from_letter(shared_item_letter(inp_line));
-            }
-        ),
-        0,
-        std::plus<>()
-    );
-    
-    auto part_2 = r::fold_left(
-        input |
-            rv::chunk(3) |
-            rv::transform(
-                [](auto triple) {
-                    return priority_from_letter(shared_letter(triple));
-                }
-            ),
-        0,
-        std::plus<>()
+aoc::solver_ptr aoc::y2022::day_03() {
+    return aoc::make_solver(
+        []() {
+            return file_to_string_vector(input_path(2022, 3));
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(
+                    [](const auto& inp_line)->int {
+                        return priority_from_letter(shared_item_letter(inp_line));
+                    }
+                ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input |
+                    rv::chunk(3) |
+                    rv::transform(
+                        [](auto triple) {
+                            return priority_from_letter(shared_letter(triple));
+                        }
+                    ),
+                0,
+                std::plus<>()
+            );
+        }
     );
-
-    std::println("--- Day 3: {} ---", title);
-    std::println("  part 1: {}", part_1);
-    std::println("  part 2: {}", part_2);
 }
\ No newline at end of file
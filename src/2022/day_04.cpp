@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -54,34 +53,36 @@ namespace {
     }
 }
 
-void aoc::y2022::day_04(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 4));
-
-    int part_1 = r::fold_left(
-        input |
-            rv::transform(
-                [](const std::string& inp_line)->int {
-                    auto [intv1, intv2] = parse_line_of_input(inp_line);
-                    return (is_contained_by(intv1, intv2) || is_contained_by(intv2, intv1)) ? 1 : 0;
-                }
-            ),
-        0,
-        std::plus<>()
+aoc::solver_ptr aoc::y2022::day_04() {
+    return aoc::make_solver(
+        []() {
+            return file_to_string_vector(input_path(2022, 4));
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input |
+                    rv::transform(
+                        [](const std::string& inp_line)->int {
+                            auto [intv1, intv2] = parse_line_of_input(inp_line);
+                            return (is_contained_by(intv1, intv2) || is_contained_by(intv2, intv1)) ? 1 : 0;
+                        }
+                    ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input |
+                    rv::transform(
+                        [](const std::string& inp_line)->int {
+                            auto [intv1, intv2] = parse_line_of_input(inp_line);
+                            return overlaps(intv1,intv2) ? 1 : 0;
+                        }
+                    ),
+                0,
+                std::plus<>()
+            );
+        }
     );
-
-    int part_2 = r::fold_left(
-        input |
-            rv::transform(
-                [](const std::string& inp_line)->int {
-                    auto [intv1, intv2] = parse_line_of_input(inp_line);
-                    return overlaps(intv1,intv2) ? 1 : 0;
-                }
-            ),
-        0,
-        std::plus<>()
-    ); 
-
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}", part_1);
-    std::println("  part 2: {}", part_2);
 }
\ No newline at end of file
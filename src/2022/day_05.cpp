@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -126,11 +125,20 @@ namespace {
     }
 }
 
-void aoc::y2022::day_05( const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 5));
-    auto [stacks, moves] = parse_input(input);
-
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}", do_part_one(stacks, moves));
-    std::println("  part 2: {}", do_part_two(stacks, moves));
+aoc::solver_ptr aoc::y2022::day_05() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 5));
+            auto [stacks, moves] = parse_input(input);
+            return std::tuple{ std::move(stacks), std::move(moves) };
+        },
+        [](const auto& inp) {
+            const auto& [stacks, moves] = inp;
+            return do_part_one(stacks, moves);
+        },
+        [](const auto& inp) {
+            const auto& [stacks, moves] = inp;
+            return do_part_two(stacks, moves);
+        }
+    );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -37,14 +36,16 @@ namespace {
     }
 }
 
-void aoc::y2022::day_06(const std::string& title) {
-    auto input = file_to_string(input_path(2022, 6));
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}", 
-        first_appearance_of_n_unique_letters(input, 4)
-    );
-    std::println("  part 2: {}", 
-        first_appearance_of_n_unique_letters(input, 14)
+aoc::solver_ptr aoc::y2022::day_06() {
+    return aoc::make_solver(
+        []() {
+            return file_to_string(input_path(2022, 6));
+        },
+        [](const auto& input) {
+            return first_appearance_of_n_unique_letters(input, 4);
+        },
+        [](const auto& input) {
+            return first_appearance_of_n_unique_letters(input, 14);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 
 namespace r = std::ranges;
@@ -151,16 +150,18 @@ namespace {
     }
 }
 
-void aoc::y2022::day_07(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 7));
-    auto commands = input | rv::transform(parse_line);
-    auto root_dir = construct_file_system(commands);
-
-    std::println("--- Day 7: {} ---", title);
-    std::println("  part 1: {}", 
-        size_of_directories_at_most_100000(root_dir)
-    );
-    std::println("  part 2: {}", 
-        size_of_directory_to_delete(root_dir)
+aoc::solver_ptr aoc::y2022::day_07() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 7));
+            auto commands = input | rv::transform(parse_line);
+            return construct_file_system(commands);
+        },
+        [](const auto& root_dir) {
+            return size_of_directories_at_most_100000(root_dir);
+        },
+        [](const auto& root_dir) {
+            return size_of_directory_to_delete(root_dir);
+        }
     );
 }
\ No newline at end of file
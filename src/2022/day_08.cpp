@@ -4,7 +4,6 @@
 #include <filesystem>
 #include <functional>
 #include <boost/functional/hash.hpp>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <numeric>
@@ -192,11 +191,17 @@ namespace {
     }
 }
 
-void aoc::y2022::day_08(const std::string& title) {
-    auto input_strings = file_to_string_vector(input_path(2022, 8));
-    auto input = strings_to_2D_array_of_digits(input_strings);
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}", num_visible(input));
-    std::println("  part 2: {}", highest_scenic_score(input));
+aoc::solver_ptr aoc::y2022::day_08() {
+    return aoc::make_solver(
+        []() {
+            auto input_strings = file_to_string_vector(input_path(2022, 8));
+            return strings_to_2D_array_of_digits(input_strings);
+        },
+        [](const auto& input) {
+            return num_visible(input);
+        },
+        [](const auto& input) {
+            return highest_scenic_score(input);
+        }
+    );
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
 #include "../util/util.h"
+#include "../util/input.h"
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/functional/hash.hpp>
@@ -74,7 +74,7 @@ namespace rv = std::ranges::views;
         return new_rope;
     }
 
-    movement parse_line_of_input(const std::string& line) {
+    movement parse_line_of_input(std::string_view line) {
         auto pieces = aoc::split(line, ' ');
         return { pieces[0][0], std::stoi(pieces[1]) };
     }
@@ -93,11 +93,17 @@ namespace rv = std::ranges::views;
     }
 }
 
-void aoc::y2022::day_09(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 9));
-    auto moves = input | rv::transform(parse_line_of_input) | r::to<std::vector<movement>>();
-
-    std::println("--- Day 9: {} ---", title);
-    std::println("  part 1: {}", unique_tail_positions(moves, 2));
-    std::println("  part 2: {}", unique_tail_positions(moves, 10));
+aoc::solver_ptr aoc::y2022::day_09() {
+    return aoc::make_solver(
+        []() {
+            mapped_file input(input_path(2022, 9));
+            return input.lines() | rv::transform(parse_line_of_input) | r::to<std::vector<movement>>();
+        },
+        [](const auto& moves) {
+            return unique_tail_positions(moves, 2);
+        },
+        [](const auto& moves) {
+            return unique_tail_positions(moves, 10);
+        }
+    );
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
 #include "../util/util.h"
+#include "../util/input.h"
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 
 namespace r = std::ranges;
@@ -28,7 +28,7 @@ namespace {
         int end_cycle;
     };
 
-    instruction parse_line_of_input(const std::string& line) {
+    instruction parse_line_of_input(std::string_view line) {
         auto pieces = aoc::split(line, ' ');
         bool is_noop = pieces[0] == "noop";
         auto duration = is_noop ? 1 : 2;
@@ -88,12 +88,17 @@ namespace {
     }
 }
 
-void aoc::y2022::day_10(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 10));
-    auto prog = input | rv::transform(parse_line_of_input) | r::to<std::vector<instruction>>();
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1: {}", sum_of_signal_strengths(prog));
-    std::println("  part 2:");
-    std::println("{}", draw_rasters(prog));
+aoc::solver_ptr aoc::y2022::day_10() {
+    return aoc::make_solver(
+        []() {
+            mapped_file input(input_path(2022, 10));
+            return input.lines() | rv::transform(parse_line_of_input) | r::to<std::vector<instruction>>();
+        },
+        [](const auto& prog) {
+            return sum_of_signal_strengths(prog);
+        },
+        [](const auto& prog) {
+            return draw_rasters(prog);
+        }
+    );
 }
\ No newline at end of file
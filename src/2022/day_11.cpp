@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <deque>
@@ -135,15 +134,17 @@ int64_t level_of_monkey_business(const std::vector<monkey>& input_monkeys,
 
 }
 
-void aoc::y2022::day_11(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 11));
-    auto monkeys = parse_input(input);
-
-    std::println("--- Day 11: {} ---", title);
-    std::println("  part 1: {}", 
-        level_of_monkey_business(monkeys, 20, {})
-    );
-    std::println("  part 2: {}", 
-        level_of_monkey_business(monkeys, 10000, calculate_modulus(monkeys))
+aoc::solver_ptr aoc::y2022::day_11() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 11));
+            return parse_input(input);
+        },
+        [](const auto& monkeys) {
+            return level_of_monkey_business(monkeys, 20, {});
+        },
+        [](const auto& monkeys) {
+            return level_of_monkey_business(monkeys, 10000, calculate_modulus(monkeys));
+        }
     );
 }
\ No newline at end of file
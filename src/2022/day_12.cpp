@@ -1,8 +1,8 @@
 #include "../util/util.h"
+#include "../util/graph_search.h"
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/functional/hash.hpp>
@@ -26,6 +26,15 @@ namespace {
         }
     };
 
+    struct grid_loc_hasher {
+        size_t operator()(const grid_loc& loc) const {
+            size_t seed = 0;
+            boost::hash_combine(seed, loc.col);
+            boost::hash_combine(seed, loc.row);
+            return seed;
+        }
+    };
+
     struct height_map {
         std::vector<grid_loc> src;
         grid_loc end;
@@ -61,18 +70,6 @@ namespace {
         return hm;
     }
 
-    struct grid_loc_hasher {
-        size_t operator()(const grid_loc& loc) const {
-            size_t seed = 0;
-            boost::hash_combine(seed, loc.col);
-            boost::hash_combine(seed, loc.row);
-            return seed;
-        }
-    };
-
-    template<typename T>
-    using loc_map = std::unordered_map<grid_loc, T, grid_loc_hasher>;
-
     template<typename T>
     std::tuple<int, int> dimensions(const grid<T>& g) {
         return {
@@ -81,15 +78,6 @@ namespace {
         };
     }
 
-    template<typename T>
-    grid<T> init_grid(std::tuple<int, int> dim, T val) {
-        auto [wd, hgt] = dim;
-        return grid<T>(
-            hgt,
-            std::vector<T>(wd, val)
-        );
-    }
-
     template<typename T>
     auto all_grid_locs(const grid<T>& g) {
         auto [wd, hgt] = dimensions(g);
@@ -137,50 +125,63 @@ namespace {
             );
     }
 
-    int dijkstra_shortest_path(const height_map& hgt_map) {
+    // a Dijkstra search from all of the sources at once, with every step costing
+    // 1, which the queue benchmark times on each queue.
+    template<template<typename, typename> typename Queue>
+    int shortest_path_len(const height_map& hgt_map) {
         auto [wd, hgt] = dimensions(hgt_map.grid);
-
-        grid<int> dist = init_grid({ wd,hgt }, wd * hgt + 1);
-        for (auto loc : hgt_map.src) {
-            dist[loc.row][loc.col] = 0;
-        }
-
-        aoc::priority_queue<grid_loc, grid_loc_hasher> queue;
-        for (grid_loc loc : all_grid_locs(hgt_map.grid)) {
-            queue.insert(loc, dist[loc.row][loc.col]);
-        }
-
-        while (!queue.empty()) {
-            auto u = queue.extract_min();
-            for (auto v : neighbors(hgt_map.grid, u)) {
-                auto dist_through_u = dist[u.row][u.col] + 1;
-                if (dist_through_u < dist[v.row][v.col]) {
-                    dist[v.row][v.col] = dist_through_u;
-                    queue.change_priority(v, dist_through_u);
+        auto result = aoc::dijkstra_search<aoc::search_tracking::distances, Queue>(
+            hgt_map.src,
+            [&](const grid_loc& loc) {
+                return neighbors(hgt_map.grid, loc) | rv::transform(
+                    [](const grid_loc& v) {
+                        return std::tuple<grid_loc, int>{ v, 1 };
+                    }
+                );
+            },
+            [&](const grid_loc& loc) {
+                return loc == hgt_map.end;
+            },
+            aoc::indexed_by<grid_loc, grid_loc_hasher>(wd * hgt,
+                [wd](const grid_loc& loc) {
+                    return static_cast<size_t>(loc.row * wd + loc.col);
                 }
-            }
-        }
-
-        return dist[hgt_map.end.row][hgt_map.end.col];
+            )
+        );
+        return result.goal_distance().value_or(wd * hgt + 1);
     }
 
 }
 
-void aoc::y2022::day_12(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 12));
-    auto hgt_map = input_to_height_map(input);
-
-    std::println("--- Day 12: {} ---", title);
-    std::println("  part 1: {}", dijkstra_shortest_path(hgt_map));
-    std::println("  part 2: {}", 
-        dijkstra_shortest_path(
-            height_map{
-                .src = all_grid_locs(hgt_map.grid) | rv::filter(
-                        [&hgt_map](auto&& loc) { return hgt_map.grid[loc.row][loc.col] == 0; }
-                    ) | r::to<std::vector<grid_loc>>(),
-                .end = hgt_map.end,
-                .grid = hgt_map.grid
-            }
-        )
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2022::day_12_with_queue() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 12));
+            return input_to_height_map(input);
+        },
+        [](const auto& hgt_map) {
+            return shortest_path_len<Queue>(hgt_map);
+        },
+        [](const auto& hgt_map) {
+            return shortest_path_len<Queue>(
+                height_map{
+                    .src = all_grid_locs(hgt_map.grid) | rv::filter(
+                            [&hgt_map](auto&& loc) { return hgt_map.grid[loc.row][loc.col] == 0; }
+                        ) | r::to<std::vector<grid_loc>>(),
+                    .end = hgt_map.end,
+                    .grid = hgt_map.grid
+                }
+            );
+        }
     );
+}
+
+template aoc::solver_ptr aoc::y2022::day_12_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2022::day_12_with_queue<aoc::indexed_4ary_heap>();
+template aoc::solver_ptr aoc::y2022::day_12_with_queue<aoc::radix_heap>();
+
+// every step costs 1, so the monotone radix heap applies.
+aoc::solver_ptr aoc::y2022::day_12() {
+    return day_12_with_queue<aoc::radix_heap>();
 }
\ No newline at end of file
@@ -3,7 +3,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <variant>
@@ -198,11 +197,20 @@ namespace {
     }
 }
 
-void aoc::y2022::day_13(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 13));
-    auto list_pairs = to_list_pairs(input);
-
-    std::println("--- Day 13: {} ---", title);
-    std::println("  part 1: {}", sum_of_indices_of_well_ordered_pairs(list_pairs));
-    std::println("  part 2: {}", calculate_decoder_key(input));
+aoc::solver_ptr aoc::y2022::day_13() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 13));
+            auto list_pairs = to_list_pairs(input);
+            return std::tuple{ std::move(input), std::move(list_pairs) };
+        },
+        [](const auto& inp) {
+            const auto& [input, list_pairs] = inp;
+            return sum_of_indices_of_well_ordered_pairs(list_pairs);
+        },
+        [](const auto& inp) {
+            const auto& [input, list_pairs] = inp;
+            return calculate_decoder_key(input);
+        }
+    );
 }
\ No newline at end of file
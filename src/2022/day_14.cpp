@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -177,11 +176,17 @@ namespace {
         return drop_sand(g);
     }
 }
-void aoc::y2022::day_14(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 14));
-    auto polylines = to_polylines(input);
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}", do_part_1(polylines));
-    std::println("  part 2: {}", do_part_2(polylines));
+aoc::solver_ptr aoc::y2022::day_14() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 14));
+            return to_polylines(input);
+        },
+        [](const auto& polylines) {
+            return do_part_1(polylines);
+        },
+        [](const auto& polylines) {
+            return do_part_2(polylines);
+        }
+    );
 }
\ No newline at end of file
@@ -3,7 +3,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/functional/hash.hpp>
@@ -294,16 +293,20 @@ namespace {
     }
 }
 
-void aoc::y2022::day_15(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 15));
-    auto [beacons, sensors] = parse_beacons_and_sensors(input);
-
-    std::println("--- Day 15: {} ---", title);
-
-    std::println("  part 1: {}", 
-        count_sensor_zones_in_row(sensors, beacons, 2000000)
-    );
-    std::println("  part 2: {}", 
-        find_distress_beacon_tuning_freq(sensors, beacons, { 0,0,4000000,4000000 })
+aoc::solver_ptr aoc::y2022::day_15() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 15));
+            auto [beacons, sensors] = parse_beacons_and_sensors(input);
+            return std::tuple{ std::move(beacons), std::move(sensors) };
+        },
+        [](const auto& inp) {
+            const auto& [beacons, sensors] = inp;
+            return count_sensor_zones_in_row(sensors, beacons, 2000000);
+        },
+        [](const auto& inp) {
+            const auto& [beacons, sensors] = inp;
+            return find_distress_beacon_tuning_freq(sensors, beacons, { 0,0,4000000,4000000 });
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <stack>
 
@@ -334,18 +333,20 @@ namespace {
 }
 
 
-void aoc::y2022::day_16(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 16));
-    auto g = build_graph(input);
-
-    auto tbl = shortest_path_lengths(g);
-    g = build_weighted_graph(g, tbl);
-
-    std::println("--- Day 16: {} ---", title);
-    std::println("  part 1: {}",
-        do_traversal(g, empty_mask(g), 30)
-    );
-    std::println("  part 2: {}",
-        do_traversal_with_elephant(g, 26)
+aoc::solver_ptr aoc::y2022::day_16() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 16));
+            auto g = build_graph(input);
+            auto tbl = shortest_path_lengths(g);
+            g = build_weighted_graph(g, tbl);
+            return g;
+        },
+        [](const auto& g) {
+            return do_traversal(g, empty_mask(g), 30);
+        },
+        [](const auto& g) {
+            return do_traversal_with_elephant(g, 26);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <boost/functional/hash.hpp>
 #include <unordered_set>
@@ -328,15 +327,18 @@ namespace {
     }
 }
 
-void aoc::y2022::day_17(const std::string& title) {
-    auto input = file_to_string(input_path(2022, 17));
-    input = input | rv::take(input.size() - 1) | r::to<std::string>();
-
-    std::println("--- Day 17: {} ---", title);
-    std::println("  part 1: {}",
-        height_after_n_drops(input, 2022)
-    );
-    std::println("  part 2: {}",
-        calculate_height_of_n_drops_using_cycles(input, 1000000000000)
+aoc::solver_ptr aoc::y2022::day_17() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string(input_path(2022, 17));
+            input = input | rv::take(input.size() - 1) | r::to<std::string>();
+            return input;
+        },
+        [](const auto& input) {
+            return height_after_n_drops(input, 2022);
+        },
+        [](const auto& input) {
+            return calculate_height_of_n_drops_using_cycles(input, 1000000000000);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <stack>
@@ -166,15 +165,17 @@ namespace {
     }
 }
 
-void aoc::y2022::day_18(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 18));
-    auto points = strings_to_points(input);
-
-    std::println("--- Day 18: {} ---", title);
-    std::println("  part 1: {}",
-        surface_area(points)
-    );
-    std::println("  part 2: {}",
-        exterior_surface_area(points)
+aoc::solver_ptr aoc::y2022::day_18() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 18));
+            return strings_to_points(input);
+        },
+        [](const auto& points) {
+            return surface_area(points);
+        },
+        [](const auto& points) {
+            return exterior_surface_area(points);
+        }
     );
 }
\ No newline at end of file
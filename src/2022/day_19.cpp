@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <stack>
 #include <unordered_set>
@@ -235,16 +234,18 @@ namespace {
     }
 }
 
-void aoc::y2022::day_19(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 19));
-    auto blueprints = parse_input(input);
-
-    std::println("--- Day 19: {} ---", title);
-    std::println("  part 1: {}",
-        sum_of_quality_level(blueprints, 24)
-    );
-    std::array<blueprint, 3> ary = { blueprints[0], blueprints[1], blueprints[2] };
-    std::println("  part 2: {}",
-        product_of_max_geodes(ary, 32)
+aoc::solver_ptr aoc::y2022::day_19() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 19));
+            return parse_input(input);
+        },
+        [](const auto& blueprints) {
+            return sum_of_quality_level(blueprints, 24);
+        },
+        [](const auto& blueprints) {
+            std::array<blueprint, 3> ary = { blueprints[0], blueprints[1], blueprints[2] };
+            return product_of_max_geodes(ary, 32);
+        }
     );
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
 #include "../util/util.h"
+#include "../util/input.h"
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <boost/intrusive/circular_list_algorithms.hpp>
 
@@ -114,24 +114,27 @@ namespace {
     }
 }
 
-void aoc::y2022::day_20(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 20));
-
-    auto part1_input = input |
-        rv::transform(
-            [](auto&& str)->int64_t {return std::stoi(str); }
-        ) | r::to<std::vector<int64_t>>();
-
-    auto part2_input = part1_input |
-        rv::transform(
-            [](auto v)->int64_t { return v * 811589153; }
-        ) | r::to<std::vector<int64_t>>();
-
-    std::println("--- Day 20: {} ---", title);
-    std::println("  part 1: {}",
-        mix(part1_input, 1)
-    );
-    std::println("  part 2: {}",
-        mix(part2_input, 10)
+aoc::solver_ptr aoc::y2022::day_20() {
+    return aoc::make_solver(
+        []() {
+            mapped_file input(input_path(2022, 20));
+            auto part1_input = input.lines() |
+                rv::transform(
+                    [](auto&& str)->int64_t {return string_to_int64(str); }
+                ) | r::to<std::vector<int64_t>>();
+            auto part2_input = part1_input |
+                rv::transform(
+                    [](auto v)->int64_t { return v * 811589153; }
+                ) | r::to<std::vector<int64_t>>();
+            return std::tuple{ std::move(part1_input), std::move(part2_input) };
+        },
+        [](const auto& inp) {
+            const auto& [part1_input, part2_input] = inp;
+            return mix(part1_input, 1);
+        },
+        [](const auto& inp) {
+            const auto& [part1_input, part2_input] = inp;
+            return mix(part2_input, 10);
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <variant>
 #include <stack>
@@ -156,20 +155,23 @@ namespace {
     }
 }
 
-void aoc::y2022::day_21(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 21));
-    auto variable_defs = input | rv::transform(str_to_variable_def) |
-        rv::transform(
-            [](const variable_def& def)->var_def_tbl::value_type {
-                return { def.var,  def.expr };
-            }
-        ) | r::to<var_def_tbl>();
-
-    std::println("--- Day 21: {} ---", title);
-    std::println("  part 1: {}",
-        evaluate_variable(variable_defs, "root")
-    );
-    std::println("  part 2: {}",
-        solve_for_unknown(variable_defs, "humn")
+aoc::solver_ptr aoc::y2022::day_21() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 21));
+            auto variable_defs = input | rv::transform(str_to_variable_def) |
+                rv::transform(
+                    [](const variable_def& def)->var_def_tbl::value_type {
+                        return { def.var,  def.expr };
+                    }
+                ) | r::to<var_def_tbl>();
+            return variable_defs;
+        },
+        [](const auto& variable_defs) {
+            return evaluate_variable(variable_defs, "root");
+        },
+        [](const auto& variable_defs) {
+            return solve_for_unknown(variable_defs, "humn");
+        }
     );
 }
\ No newline at end of file
@@ -609,16 +609,20 @@ namespace {
         return 1000 * end_state.loc.y + 4 * end_state.loc.x + end_state.dir;
     }
 }
-void aoc::y2022::day_22(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 22));
-    auto [grid, instructions] = parse_input(input);
-
-    std::println("--- Day 22: {} ---", title);
-    std::println("  part 1: {}",
-        do_part_1(grid, instructions)
-    );
-    cube_grid c_grid(grid);
-    std::println("  part 2: {}",
-        do_part_2(c_grid, instructions)
+aoc::solver_ptr aoc::y2022::day_22() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 22));
+            return parse_input(input);
+        },
+        [](auto inp) {
+            auto& [grid, instructions] = inp;
+            return do_part_1(grid, instructions);
+        },
+        [](auto inp) {
+            auto& [grid, instructions] = inp;
+            cube_grid c_grid(grid);
+            return do_part_2(c_grid, instructions);
+        }
     );
 }
\ No newline at end of file
@@ -1,11 +1,9 @@
 #include "../util/util.h"
+#include "../util/vec2.h"
 #include "y2022.h"
-#include <boost/functional/hash.hpp>
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
-#include <unordered_set>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -15,43 +13,11 @@ namespace rv = std::ranges::views;
 
 namespace {
 
-    struct point {
-        int x;
-        int y;
-
-        bool operator==(const point& p) const {
-            return x == p.x && y == p.y;
-        }
-    };
-
-    point operator+(const point& lhs, const point& rhs) {
-        return  { lhs.x + rhs.x, lhs.y + rhs.y };
-    }
-
-    point operator-(const point& lhs, const point& rhs) {
-        return  { lhs.x - rhs.x, lhs.y - rhs.y };
-    }
-
-    point operator*(int lhs, const point& rhs) {
-        return {
-            lhs * rhs.x,
-            lhs * rhs.y
-        };
-    }
-
-    struct point_hash {
-        size_t operator()(const point& pt) const {
-            size_t seed = 0;
-            boost::hash_combine(seed, pt.x);
-            boost::hash_combine(seed, pt.y);
-            return seed;
-        }
-    };
-
-    using point_set = std::unordered_set<point, point_hash>;
+    using point = aoc::vec2<int>;
+    using point_set = aoc::vec2_set<int>;
 
     template<typename T>
-    using point_map = std::unordered_map<point, T, point_hash>;
+    using point_map = aoc::vec2_map<int, T>;
 
     point_set input_to_elf_locations(const std::vector<std::string>& input) {
         int wd = static_cast<int>(input.front().size());
@@ -244,15 +210,17 @@ namespace {
     }
 }
 
-void aoc::y2022::day_23(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 23));
-    auto set = input_to_elf_locations(input);
-
-    std::println("--- Day 23: {} ---", title);
-    std::println("  part 1: {}",
-        count_empty(run_n_rounds(set, 10))
-    );
-    std::println("  part 2: {}",
-        run_until_no_elf_moves(set)
+aoc::solver_ptr aoc::y2022::day_23() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 23));
+            return input_to_elf_locations(input);
+        },
+        [](const auto& set) {
+            return count_empty(run_n_rounds(set, 10));
+        },
+        [](const auto& set) {
+            return run_until_no_elf_moves(set);
+        }
     );
 }
\ No newline at end of file
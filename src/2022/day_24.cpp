@@ -1,13 +1,12 @@
 #include "../util/util.h"
+#include "../util/graph_search.h"
 #include "y2022.h"
 #include <boost/functional/hash.hpp>
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <numeric>
-#include <queue>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -203,21 +202,14 @@ blizzard_atlas make_blizzard_atlas(const blizzard_set& initial) {
     return atlas;
 }
 
+// time is taken modulo the period of the blizzards, after which states repeat.
 struct state {
     point loc;
     int time;
-    std::vector<point> path;
 
     bool operator==(const state& s) const {
         return loc == s.loc && time == s.time;
     }
-
-    state normalized(int n) const {
-        return {
-            loc,
-            time % n
-        };
-    }
 };
 
 struct state_hash {
@@ -230,8 +222,6 @@ struct state_hash {
     }
 };
 
-using state_set = std::unordered_set<state, state_hash>;
-
 auto directions() {
     return rv::iota(0, 5) | rv::transform([](int i) {return static_cast<direction>(i); });
 }
@@ -263,38 +253,34 @@ auto neighbors_at_place_and_time(const state& s, const blizzard_atlas& atlas) {
             [&](auto&& maybe_pt)->state {
                 return {
                     maybe_pt.value(),
-                    s.time + 1
+                    (s.time + 1) % static_cast<int>(atlas.size())
                 };
             }
         );
 }
 
+// the states are indexed densely by time, row and column.
 int min_time_crossing(const blizzard_atlas& atlas, const point& from,
             const point& to, int start_time) {
     int atlas_sz = static_cast<int>(atlas.size());
     int wd = atlas.front().width();
     int hgt = atlas.front().height();
-    std::queue<state> queue;
-    queue.push({ from, start_time });
-    state_set visited;
-    while (!queue.empty()) {
-        auto state = queue.front();
-        queue.pop();
-
-        if (state.loc == to) {
-            return state.time;
-        }
-
-        if (visited.contains(state.normalized(atlas_sz))) {
-            continue;
-        }
-        visited.insert(state.normalized(atlas_sz));
-
-        for (auto&& new_state : neighbors_at_place_and_time(state, atlas)) {
-            queue.push(new_state);
-        }
-    }
-    return -1;
+    auto result = aoc::breadth_first_search(
+        state{ from, start_time % atlas_sz },
+        [&](const state& s) {
+            return neighbors_at_place_and_time(s, atlas);
+        },
+        [&](const state& s) {
+            return s.loc == to;
+        },
+        aoc::indexed_by<state, state_hash>(static_cast<size_t>(wd) * hgt * atlas_sz,
+            [wd, hgt](const state& s) {
+                return (static_cast<size_t>(s.time) * hgt + s.loc.y) * wd + s.loc.x;
+            }
+        )
+    );
+    auto steps = result.goal_distance();
+    return steps ? start_time + *steps : -1;
 }
 
 int min_time_crossing_back_and_forth(
@@ -309,20 +295,24 @@ int min_time_crossing_back_and_forth(
 }
 
 
-void aoc::y2022::day_24(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 24));
-    auto atlas = make_blizzard_atlas(parse_input(input));
-
-    int wd = atlas.front().width();
-    int hgt = atlas.front().height();
-
-    std::println("--- Day 24: {} ---", title);
-    std::println("  part 1: {}",
-        min_time_crossing(atlas, entrance_loc(), exit_loc(wd, hgt), 0)
-    );
-    std::println("  part 2: {}",
-        min_time_crossing_back_and_forth(
-            atlas, entrance_loc(), exit_loc(wd, hgt), 0
-        )
+aoc::solver_ptr aoc::y2022::day_24() {
+    return aoc::make_solver(
+        []() {
+            auto input = file_to_string_vector(input_path(2022, 24));
+            auto atlas = make_blizzard_atlas(parse_input(input));
+            int wd = atlas.front().width();
+            int hgt = atlas.front().height();
+            return std::tuple{ std::move(atlas), wd, hgt };
+        },
+        [](const auto& inp) {
+            const auto& [atlas, wd, hgt] = inp;
+            return min_time_crossing(atlas, entrance_loc(), exit_loc(wd, hgt), 0);
+        },
+        [](const auto& inp) {
+            const auto& [atlas, wd, hgt] = inp;
+            return min_time_crossing_back_and_forth(
+                atlas, entrance_loc(), exit_loc(wd, hgt), 0
+            );
+        }
     );
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "y2022.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <deque>
 
@@ -130,14 +129,16 @@ namespace {
     }
 }
 
-void aoc::y2022::day_25(const std::string& title) {
-    auto input = file_to_string_vector(input_path(2022, 25));
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}",
-        to_snafu_number(sum_of_snafu_numbers(input))
-    );
-    std::println("  part 2: {}",
-        "xmas freebie"
+aoc::solver_ptr aoc::y2022::day_25() {
+    return aoc::make_solver(
+        []() {
+            return file_to_string_vector(input_path(2022, 25));
+        },
+        [](const auto& input) {
+            return to_snafu_number(sum_of_snafu_numbers(input));
+        },
+        [](const auto&) {
+            return "xmas freebie";
+        }
     );
 }
\ No newline at end of file
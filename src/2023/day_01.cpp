@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -43,29 +42,29 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_01(const std::string& title) {
-
-    auto input = aoc::file_to_string_vector(aoc::input_path(2023, 1));
-
-    std::println("--- Day 1: {0} ---\n", title);
-    std::println("part 1: {0}", 
-        r::fold_left(
-            input |
-            rv::transform(aoc::remove_nonnumeric) |
-            rv::transform(
-                [](auto&& str)->int {
-                    return 10 * (*str.begin() - '0') + (*str.rbegin() - '0');
-                }
-        ), 0, std::plus<>())
-    );
-    std::println("part 2: {0}", 
-        r::fold_left(
-            input |
-            rv::transform(
-                [](auto&& str)->int {
-                    return 10 * left_num(str) + right_num(str);
-                }
-        ), 0, std::plus<>())
+aoc::solver_ptr aoc::y2023::day_01() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2023, 1));
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input |
+                rv::transform(aoc::remove_nonnumeric) |
+                rv::transform(
+                    [](auto&& str)->int {
+                        return 10 * (*str.begin() - '0') + (*str.rbegin() - '0');
+                    }
+            ), 0, std::plus<>());
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input |
+                rv::transform(
+                    [](auto&& str)->int {
+                        return 10 * left_num(str) + right_num(str);
+                    }
+            ), 0, std::plus<>());
+        }
     );
-    
 }
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -71,31 +70,31 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_02(const std::string& title) {
-
-    auto input = aoc::file_to_string_vector(aoc::input_path(2023, 2)) |
-        rv::transform(parse_line) |
-        r::to<std::vector<game_info>>();
-
-    std::println("--- Day 2: {0} ---\n", title);
-    
-    std::println("  part 1: {0}", 
-        r::fold_left(
-            input | rv::filter(is_possible) | rv::transform([](auto&& gi) {return gi.id; }), 
-            0, std::plus<>()
-        )
-    );
-    std::println("  part 2: {0}",
-        r::fold_left(
-            input | rv::transform(
-                [](auto&& gi) {
-                    return r::fold_left(
-                        gi.max_color_count,
-                        1, std::multiplies<>()
-                    );
-                }
-            ),
-            0, std::plus<>()
-        )
+aoc::solver_ptr aoc::y2023::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2023, 2)) |
+                rv::transform(parse_line) |
+                r::to<std::vector<game_info>>();
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::filter(is_possible) | rv::transform([](auto&& gi) {return gi.id; }), 
+                0, std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(
+                    [](auto&& gi) {
+                        return r::fold_left(
+                            gi.max_color_count,
+                            1, std::multiplies<>()
+                        );
+                    }
+                ),
+                0, std::plus<>()
+            );
+        }
     );
 }
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -142,11 +141,16 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_03(const std::string& title) {
-
-    auto input = aoc::file_to_string_vector(aoc::input_path(2023, 3));
-
-    std::println("--- Day 3: {0} ---\n", title);
-    std::println("  part 1: {}", do_part_1(input));
-    std::println("  part 2: {}", do_part_2(input));
+aoc::solver_ptr aoc::y2023::day_03() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2023, 3));
+        },
+        [](const auto& input) {
+            return do_part_1(input);
+        },
+        [](const auto& input) {
+            return do_part_2(input);
+        }
+    );
 }
\ No newline at end of file
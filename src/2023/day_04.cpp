@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -64,13 +63,17 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_04(const std::string& title) {
-
-    auto cards = aoc::file_to_string_vector(aoc::input_path(2023, 4)) |
-        rv::transform(parse_card) | r::to<std::vector<card>>();
-
-    std::println("--- Day 4: {0} ---\n", title);
-
-    std::println("  part 1: {}", do_part_1(cards));
-    std::println("  part 2: {}", do_part_2(cards));
+aoc::solver_ptr aoc::y2023::day_04() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2023, 4)) |
+                rv::transform(parse_card) | r::to<std::vector<card>>();
+        },
+        [](const auto& cards) {
+            return do_part_1(cards);
+        },
+        [](const auto& cards) {
+            return do_part_2(cards);
+        }
+    );
 }
\ No newline at end of file
@@ -155,12 +155,16 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_05(const std::string& title) {
-
-    auto inp = parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 5)));
-    
-    
-    std::println("--- Day 5: {0} ---\n", title);
-    std::println("  part 1: {}", do_part_1(inp.seeds, inp.almanac));
-    std::println("  part 2: {}", do_part_2(inp.seeds, inp.almanac));
+aoc::solver_ptr aoc::y2023::day_05() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 5)));
+        },
+        [](const auto& inp) {
+            return do_part_1(inp.seeds, inp.almanac);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp.seeds, inp.almanac);
+        }
+    );
 }
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -74,13 +73,18 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_06(const std::string& title) {
-
-    auto input = parse_input(
-        aoc::file_to_string_vector( aoc::input_path(2023, 6) )
+aoc::solver_ptr aoc::y2023::day_06() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector( aoc::input_path(2023, 6) )
+            );
+        },
+        [](const auto& input) {
+            return do_part_1(input);
+        },
+        [](const auto& input) {
+            return do_part_2(input);
+        }
     );
-
-    std::println("--- Day 6: {0} ---\n", title);
-    std::println("  part 1: {}", do_part_1(input));
-    std::println("  part 2: {}", do_part_2(input));
 }
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -212,11 +211,16 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_07(const std::string& title) {
-
-    auto inp = parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 7)));
-
-    std::println("--- Day 7: {0} ---\n", title);
-    std::println("  part 1: {}", calc_winnings(inp, false));
-    std::println("  part 2: {}", calc_winnings(inp, true)); 
+aoc::solver_ptr aoc::y2023::day_07() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 7)));
+        },
+        [](const auto& inp) {
+            return calc_winnings(inp, false);
+        },
+        [](const auto& inp) {
+            return calc_winnings(inp, true);
+        }
+    );
 }
\ No newline at end of file
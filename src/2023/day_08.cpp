@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <tuple>
@@ -100,14 +99,20 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_08(const std::string& title) {
-
-    const auto& [instructions, nodes] = parse_input(
-        aoc::file_to_string_vector(aoc::input_path(2023, 8))
+aoc::solver_ptr aoc::y2023::day_08() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(aoc::input_path(2023, 8))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [instructions, nodes] = inp;
+            return do_part1(instructions, nodes);
+        },
+        [](const auto& inp) {
+            const auto& [instructions, nodes] = inp;
+            return do_part2(instructions, nodes);
+        }
     );
-
-    std::println("--- Day 8: {0} ---\n", title);
-    std::println("  part 1: {}", do_part1(instructions, nodes));
-    std::println("  part 2: {}", do_part2(instructions, nodes));
-
 }
\ No newline at end of file
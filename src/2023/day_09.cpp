@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <tuple>
@@ -47,31 +46,31 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_09(const std::string& title) {
-
-    auto input = parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 9)));
-
-    std::println("--- Day 9: {0} ---\n", title);
-    std::println("  part 1: {}",
-        r::fold_left(
-            input | rv::transform(
-                [](auto&& row) {
-                    return find_next_item(row);
-                }
-            ),
-            0, std::plus<>()
-        )
-    );
-
-    std::println("  part 2: {}",
-        r::fold_left(
-            input | rv::transform(
-                [](auto&& row) {
-                    r::reverse(row);
-                    return find_next_item(row);
-                }
-            ),
-            0, std::plus<>()
-        )
+aoc::solver_ptr aoc::y2023::day_09() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 9)));
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(
+                    [](auto&& row) {
+                        return find_next_item(row);
+                    }
+                ),
+                0, std::plus<>()
+            );
+        },
+        [](auto input) {
+            return r::fold_left(
+                input | rv::transform(
+                    [](auto&& row) {
+                        r::reverse(row);
+                        return find_next_item(row);
+                    }
+                ),
+                0, std::plus<>()
+            );
+        }
     );
 }
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -203,12 +202,20 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_10(const std::string& title) {
-
-    const auto input = aoc::file_to_string_vector(aoc::input_path(2023, 10));
-    const auto [start, grid] = parse_input(input);
-
-    std::println("--- Day 10: {0} ---\n", title);
-    std::println("  part 1: {}", do_part_1(grid, start));
-    std::println("  part 2: {}", count_interior(grid, start));
+aoc::solver_ptr aoc::y2023::day_10() {
+    return aoc::make_solver(
+        []() {
+            const auto input = aoc::file_to_string_vector(aoc::input_path(2023, 10));
+            const auto [start, grid] = parse_input(input);
+            return std::tuple{ std::move(start), std::move(grid) };
+        },
+        [](const auto& inp) {
+            const auto& [start, grid] = inp;
+            return do_part_1(grid, start);
+        },
+        [](const auto& inp) {
+            const auto& [start, grid] = inp;
+            return count_interior(grid, start);
+        }
+    );
 }
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -123,17 +122,20 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_11(const std::string& title) {
-
-    const auto& [stars, blank_rows, blank_cols] = parse_input(
-        aoc::file_to_string_vector(aoc::input_path(2023, 11))
-    );
-
-    std::println("--- Day 11: {0} ---\n", title);
-    std::println("  part 1: {}",
-        sum_of_distances(stars, blank_rows, blank_cols, 2)
-    );
-    std::println("  part 2: {}",
-        sum_of_distances(stars, blank_rows, blank_cols, 1000000)
+aoc::solver_ptr aoc::y2023::day_11() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(aoc::input_path(2023, 11))
+            );
+        },
+        [](const auto& inp) {
+            const auto& [stars, blank_rows, blank_cols] = inp;
+            return sum_of_distances(stars, blank_rows, blank_cols, 2);
+        },
+        [](const auto& inp) {
+            const auto& [stars, blank_rows, blank_cols] = inp;
+            return sum_of_distances(stars, blank_rows, blank_cols, 1000000);
+        }
     );
 }
\ No newline at end of file
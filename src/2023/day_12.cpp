@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -129,34 +128,35 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_12(const std::string& title) {
-
-    auto input = parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 12)));
-
-    std::unordered_map<std::string, int64_t> memos;
-
-    std::println("  part 1: {}",
-        r::fold_left(
-            input | rv::transform(
-                [&memos](auto&& rec) {
-                    return count_valid(rec, memos);
-                }
-            ),
-            0,
-            std::plus<>()
-        )
-    );
-    
-    auto part2_input = make_part2_input(input);
-    std::println("  part 2: {}",
-        r::fold_left(
-            part2_input | rv::transform(
-                [&memos](auto&& rec) {
-                    return count_valid(rec, memos);
-                }
-            ),
-            0,
-            std::plus<>()
-        )
+aoc::solver_ptr aoc::y2023::day_12() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 12)));
+        },
+        [](const auto& input) {
+            std::unordered_map<std::string, int64_t> memos;
+            return r::fold_left(
+                input | rv::transform(
+                    [&memos](auto&& rec) {
+                        return count_valid(rec, memos);
+                    }
+                ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            std::unordered_map<std::string, int64_t> memos;
+            auto part2_input = make_part2_input(input);
+            return r::fold_left(
+                part2_input | rv::transform(
+                    [&memos](auto&& rec) {
+                        return count_valid(rec, memos);
+                    }
+                ),
+                0,
+                std::plus<>()
+            );
+        }
     );
 }
\ No newline at end of file
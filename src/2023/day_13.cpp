@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -135,24 +134,22 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_13(const std::string& title) {
-
-    auto input = parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 13)));
-
-    //auto foo = summarize_pattern_with_smudge(input.back());
-
-    std::println("--- Day 13: {0} ---\n", title);
-    std::println("  part 1: {}",
-        r::fold_left(
-            input | rv::transform( summarize_pattern),
-            0, std::plus<>()
-        )
-    );
-    
-    std::println("  part 2: {}",
-        r::fold_left(
-            input | rv::transform(summarize_pattern_with_smudge),
-            0, std::plus<>()
-        )
+aoc::solver_ptr aoc::y2023::day_13() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 13)));
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform( summarize_pattern),
+                0, std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(summarize_pattern_with_smudge),
+                0, std::plus<>()
+            );
+        }
     );
 }
\ No newline at end of file
@@ -241,15 +241,18 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_14(const std::string& title) {
-
-    auto input = aoc::file_to_string_vector(aoc::input_path(2023, 14));
-    std::println("--- Day 14: {0} ---\n", title);
-
-    auto rocks = input;
-    shift_rows_north(rocks);
-    std::println("  part 1: {}", score_rocks(rocks));
-    std::println("  part 2: {}", do_part_2(input, 1000000000));
-    
-
+aoc::solver_ptr aoc::y2023::day_14() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2023, 14));
+        },
+        [](const auto& input) {
+            auto rocks = input;
+            shift_rows_north(rocks);
+            return score_rocks(rocks);
+        },
+        [](const auto& input) {
+            return do_part_2(input, 1000000000);
+        }
+    );
 }
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -109,17 +108,19 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_15(const std::string& title) {
-
-    auto input = parse_input(aoc::file_to_string(aoc::input_path(2023, 15)));
-
-    std::println("--- Day 15: {0} ---\n", title);
-    std::println("  part 1: {}",
-        r::fold_left(
-            input | rv::transform(hash_string),
-            0, std::plus<>()
-        )
+aoc::solver_ptr aoc::y2023::day_15() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string(aoc::input_path(2023, 15)));
+        },
+        [](const auto& input) {
+            return r::fold_left(
+                input | rv::transform(hash_string),
+                0, std::plus<>()
+            );
+        },
+        [](const auto& input) {
+            return do_part_2(input);
+        }
     );
-    std::println("  part 2: {}", do_part_2(input));
-
 }
\ No newline at end of file
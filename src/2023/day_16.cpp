@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -184,24 +183,22 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_16(const std::string& title) {
-
-    auto input = aoc::file_to_string_vector(aoc::input_path(2023, 16));
-
-    std::println("--- Day 16: {0} ---\n", title);
-
-    std::println("  part 1: {}", 
-        simulate_contraption(input, { {-1,0}, east })
-    );
-
-    std::println("  part 2: {}",
-        r::max( 
-            edge_starts(input) |  rv::transform(
-                [&](auto&& start)->int {
-                    return simulate_contraption(input, start);
-                }
-            )
-        )
+aoc::solver_ptr aoc::y2023::day_16() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2023, 16));
+        },
+        [](const auto& input) {
+            return simulate_contraption(input, { {-1,0}, east });
+        },
+        [](const auto& input) {
+            return r::max( 
+                edge_starts(input) |  rv::transform(
+                    [&](auto&& start)->int {
+                        return simulate_contraption(input, start);
+                    }
+                )
+            );
+        }
     );
-    
 }
\ No newline at end of file
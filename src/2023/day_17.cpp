@@ -1,14 +1,10 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
+#include "../util/graph_search.h"
 #include <ranges>
 #include <numeric>
 #include <functional>
 #include <algorithm>
-#include <limits>
-#include <stack>
-#include <unordered_set>
-#include <unordered_map>
 #include <boost/functional/hash.hpp>
 
 namespace r = std::ranges;
@@ -172,65 +168,62 @@ namespace {
         );
     }
 
+    // the states are indexed densely by location, direction and steps taken in
+    // that direction, which never exceed 10.
+    template<template<typename, typename> typename Queue>
     int dijkstra_shortest_path(const grid& g, const loc& start, const loc& end, neighbors_fn neigh_fn) {
         auto [cols, rows] = dimensions(g);
-
-        std::unordered_map<state, int, state_hash> dist;
-        aoc::priority_queue<state, state_hash> queue;
-        state start_state = { start, north, 0 };
-        queue.insert(start_state, 0);
-        dist[start_state] = 0;
-
-        while (!queue.empty()) {
-            auto u = queue.extract_min();
-            for (auto v : neigh_fn(u, cols, rows)) {
-                auto dist_to_u = dist.at(u);
-                auto dist_through_u_to_v = dist_to_u + g[v.pos.row][v.pos.col];
-                auto curr_dist_to_v = dist.contains(v) ? dist.at(v) : std::numeric_limits<int>::max();
-
-                if (dist_through_u_to_v < curr_dist_to_v) {
-                    dist[v] = dist_through_u_to_v;
-                    if (queue.contains(v)) {
-                        queue.change_priority(v, dist_through_u_to_v);
-                    } else {
-                        queue.insert(v, dist_through_u_to_v);
+        auto result = aoc::dijkstra_search<aoc::search_tracking::distances, Queue>(
+            state{ start, north, 0 },
+            [&](const state& u) {
+                return neigh_fn(u, cols, rows) | rv::transform(
+                    [&](const state& v) {
+                        return std::tuple<state, int>{ v, g[v.pos.row][v.pos.col] };
                     }
-                }
-            }
-        }
-
-        return r::min(
-            dist | rv::filter(
-                [end](auto&& key_val)->bool {
-                    const auto& [s, dist] = key_val;
-                    return s.pos == end;
-                }
-            ) | rv::transform(
-                [](auto&& key_val)->int {
-                    const auto& [s, dist] = key_val;
-                    return dist;
+                ) | r::to<std::vector>();
+            },
+            [end](const state& s) {
+                return s.pos == end;
+            },
+            aoc::indexed_by<state, state_hash>(
+                static_cast<size_t>(cols) * rows * 4 * 11,
+                [cols](const state& s) {
+                    auto loc_index = static_cast<size_t>(s.pos.row) * cols + s.pos.col;
+                    return (loc_index * 4 + s.dir) * 11 + s.steps_in_dir;
                 }
             )
         );
+        return result.goal_distance().value_or(-1);
     }
 }
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_17(const std::string& title) {
-
-    auto grid = aoc::strings_to_2D_array_of_digits(
-        aoc::file_to_string_vector(aoc::input_path(2023, 17))
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2023::day_17_with_queue() {
+    return aoc::make_solver(
+        []() {
+            auto grid = aoc::strings_to_2D_array_of_digits(
+                aoc::file_to_string_vector(aoc::input_path(2023, 17))
+            );
+            auto [cols, rows] = dimensions(grid);
+            return std::tuple{ std::move(grid), std::move(cols), std::move(rows) };
+        },
+        [](const auto& inp) {
+            const auto& [grid, cols, rows] = inp;
+            return dijkstra_shortest_path<Queue>(grid, { 0,0 }, { cols-1,rows-1}, part1_neighbors);
+        },
+        [](const auto& inp) {
+            const auto& [grid, cols, rows] = inp;
+            return dijkstra_shortest_path<Queue>(grid, { 0,0 }, { cols - 1,rows - 1 }, part2_neighbors);
+        }
     );
+}
 
-    auto [cols, rows] = dimensions(grid);
-
-    std::println("--- Day 17: {} ---\n", title);
-    std::println("  part 1: {}", 
-        dijkstra_shortest_path(grid, { 0,0 }, { cols-1,rows-1}, part1_neighbors)
-    );
-    std::println("  part 2: {}",
-        dijkstra_shortest_path(grid, { 0,0 }, { cols - 1,rows - 1 }, part2_neighbors)
-    );
+template aoc::solver_ptr aoc::y2023::day_17_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2023::day_17_with_queue<aoc::indexed_4ary_heap>();
+template aoc::solver_ptr aoc::y2023::day_17_with_queue<aoc::radix_heap>();
 
+aoc::solver_ptr aoc::y2023::day_17() {
+    return day_17_with_queue<aoc::radix_heap>();
 }
\ No newline at end of file
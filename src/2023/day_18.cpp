@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <sstream>
@@ -159,26 +158,26 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_18(const std::string& title) {
-
-    auto dig_plan = parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 18)));
-
-    std::println("--- Day 18: {} ---\n", title);
-    std::println("  part 1: {}",
-        bg::area(
-            buffer(
-                make_polygon(dig_plan_to_verts(dig_plan)),
-                0.5
-            )
-        )
-    );
-
-    std::println("  part 2: {}",
-        bg::area(
-            buffer(
-                make_polygon(vertices_for_part2(dig_plan)),
-                0.5
-            )
-        )
+aoc::solver_ptr aoc::y2023::day_18() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 18)));
+        },
+        [](const auto& dig_plan) {
+            return bg::area(
+                buffer(
+                    make_polygon(dig_plan_to_verts(dig_plan)),
+                    0.5
+                )
+            );
+        },
+        [](const auto& dig_plan) {
+            return bg::area(
+                buffer(
+                    make_polygon(vertices_for_part2(dig_plan)),
+                    0.5
+                )
+            );
+        }
     );
 }
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <tuple>
 #include <algorithm>
@@ -267,31 +266,33 @@ namespace {
 /*------------------------------------------------------------------------------------------------*/
 
 
-void aoc::y2023::day_19(const std::string& title) {
-
-    auto [wfs, parts] = parse_input(
-        aoc::file_to_string_vector(aoc::input_path(2023, 19))
-    );
-    auto workflows = make_workflow_table(wfs);
-
-    std::println("--- Day 19: {} ---\n", title);
-    std::println("  part 1: {}",
-        r::fold_left(
-            parts | rv::filter(
-                [&workflows](auto&& p) {
-                    return part_is_accepted(workflows, p);
-                }
-            ) | rv::transform(
-                score_part
-            ),
-            0,
-            std::plus<>()
-        )
-    );
-
-    std::println("  part 2: {}",
-        count_accepted_parts(workflows, "in")
+aoc::solver_ptr aoc::y2023::day_19() {
+    return aoc::make_solver(
+        []() {
+            auto [wfs, parts] = parse_input(
+                aoc::file_to_string_vector(aoc::input_path(2023, 19))
+            );
+            auto workflows = make_workflow_table(wfs);
+            return std::tuple{ std::move(parts), std::move(workflows) };
+        },
+        [](const auto& inp) {
+            const auto& [parts, workflows] = inp;
+            return r::fold_left(
+                parts | rv::filter(
+                    [&workflows](auto&& p) {
+                        return part_is_accepted(workflows, p);
+                    }
+                ) | rv::transform(
+                    score_part
+                ),
+                0,
+                std::plus<>()
+            );
+        },
+        [](const auto& inp) {
+            const auto& [parts, workflows] = inp;
+            return count_accepted_parts(workflows, "in");
+        }
     );
-
 }
     
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -333,20 +332,27 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_20(const std::string& title) {
-
-    auto [verts, edges] = parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 20)));
-    auto graph = build_module_graph(verts, edges);
-
-    std::println("--- Day 20: {0} ---\n", title);
-    std::println("  part 1: {}", do_part_1(graph));
-
-    int64_t xm, nh, dr, tr;
-    xm = find_cycle(graph, "xm");
-    nh = find_cycle(graph, "nh");
-    dr = find_cycle(graph, "dr");
-    tr = find_cycle(graph, "tr");
-
-    std::println("  part 2: {}", std::lcm(xm, std::lcm(nh, std::lcm(dr, tr))));
-
+aoc::solver_ptr aoc::y2023::day_20() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 20)));
+        },
+        [](const auto& inp) {
+            const auto& [verts, edges] = inp;
+            auto graph = build_module_graph(verts, edges);
+            return do_part_1(graph);
+        },
+        [](const auto& inp) {
+            const auto& [verts, edges] = inp;
+            auto graph = build_module_graph(verts, edges);
+
+            int64_t xm, nh, dr, tr;
+            xm = find_cycle(graph, "xm");
+            nh = find_cycle(graph, "nh");
+            dr = find_cycle(graph, "dr");
+            tr = find_cycle(graph, "tr");
+
+            return std::lcm(xm, std::lcm(nh, std::lcm(dr, tr)));
+        }
+    );
 }
\ No newline at end of file
@@ -1,16 +1,13 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
+#include "../util/dense_point.h"
 #include <ranges>
 #include <numeric>
 #include <algorithm>
-#include <unordered_set>
-#include <unordered_map>
 #include <tuple>
 #include <queue>
 #include <map>
 #include <sstream>
-#include <boost/functional/hash.hpp>
 
 
 namespace r = std::ranges;
@@ -18,35 +15,12 @@ namespace rv = std::ranges::views;
 
 namespace {
 
-    struct loc {
-        int col;
-        int row;
-    };
-
-    loc operator+(const loc& lhs, const loc& rhs) {
-        return {
-            lhs.col + rhs.col,
-            lhs.row + rhs.row
-        };
-    }
-
-    bool operator==(const loc& lhs, const loc& rhs) {
-        return lhs.col == rhs.col && lhs.row == rhs.row;
-    }
-
-    struct loc_hash {
-        size_t operator()(const loc& loc) const {
-            size_t seed = 0;
-            boost::hash_combine(seed, loc.col);
-            boost::hash_combine(seed, loc.row);
-            return seed;
-        }
-    };
+    // x is the column and y the row.
+    using loc = aoc::vec2<int>;
 
     template<typename T>
-    using loc_map = std::unordered_map<loc, T, loc_hash>;
+    using loc_map = aoc::dense_point_map<T>;
 
-    using loc_set = std::unordered_set<loc, loc_hash>;
     using grid = std::vector<std::string>;
 
     std::tuple<int, int> dimensions(const grid& g) {
@@ -60,8 +34,8 @@ namespace {
         auto [cols, rows] = dimensions(g);
         for (int row = 0; row < rows; ++row) {
             for (int col = 0; col < cols; ++col) {
-                if (g[col][row] == 'S') {
-                    g[col][row] = '.';
+                if (g[row][col] == 'S') {
+                    g[row][col] = '.';
                     return { col,row };
                 }
             }
@@ -70,7 +44,7 @@ namespace {
     }
 
     bool in_bounds(const loc& v, int rows, int cols) {
-        return v.row >= 0 && v.row < rows && v.col >= 0 && v.col < cols;
+        return v.y >= 0 && v.y < rows && v.x >= 0 && v.x < cols;
     }
 
     std::vector<loc> neighbors(const grid& g, const loc& v) {
@@ -84,7 +58,7 @@ namespace {
             }
         ) | rv::filter(
             [&](auto&& v) {
-                return in_bounds(v, rows, cols) && g[v.col][v.row] == '.';
+                return in_bounds(v, rows, cols) && g[v.y][v.x] == '.';
             }
        ) | r::to< std::vector<loc>>();
     }
@@ -95,7 +69,8 @@ namespace {
     };
 
     loc_map<int> find_distances(const grid& g, const loc& start, std::optional<int> n = {}) {
-        loc_map<int> dist;
+        auto [cols, rows] = dimensions(g);
+        loc_map<int> dist(cols, rows);
         std::queue<state> queue;
         queue.push({ start,0 });
 
@@ -159,15 +134,21 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_21(const std::string& title) {
-
-    auto grid = aoc::file_to_string_vector(aoc::input_path(2023, 21));
-    auto start = find_start(grid);
-
-    auto [cols, rows] = dimensions(grid);
-
-    std::println("--- Day 21: {0} ---\n", title);
-    std::println("  part 1: {}", count_even_steps(find_distances(grid, start, 64)));
-    std::println("  part 2: {}", do_part_2(grid));
+aoc::solver_ptr aoc::y2023::day_21() {
+    return aoc::make_solver(
+        []() {
+            auto grid = aoc::file_to_string_vector(aoc::input_path(2023, 21));
+            auto start = find_start(grid);
+            return std::tuple{ std::move(grid), std::move(start) };
+        },
+        [](const auto& inp) {
+            const auto& [grid, start] = inp;
+            return count_even_steps(find_distances(grid, start, 64));
+        },
+        [](const auto& inp) {
+            const auto& [grid, start] = inp;
+            return do_part_2(grid);
+        }
+    );
 }
 
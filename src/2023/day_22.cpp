@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -190,20 +189,25 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_22(const std::string& title) {
+aoc::solver_ptr aoc::y2023::day_22() {
+    return aoc::make_solver(
+        []() {
+            auto bricks = parse_input(
+                aoc::file_to_string_vector(aoc::input_path(2023, 22))
+            );
 
-    auto bricks = parse_input(
-        aoc::file_to_string_vector(aoc::input_path(2023, 22))
-    );
-
-    r::sort(bricks,
-        [](auto&& lhs, auto&& rhs) {
-            return lhs.min_corner().z < rhs.min_corner().z;
+            r::sort(bricks,
+                [](auto&& lhs, auto&& rhs) {
+                    return lhs.min_corner().z < rhs.min_corner().z;
+                }
+            );
+            return bricks;
+        },
+        [](const auto& bricks) {
+            return do_part_1(bricks);
+        },
+        [](const auto& bricks) {
+            return do_part_2(bricks);
         }
     );
-
-    std::println("--- Day 22: {0} ---\n", title);
-    std::println("  part 1: {}", do_part_1(bricks));
-    std::println("  part 1: {}", do_part_2(bricks));
-    
 }
\ No newline at end of file
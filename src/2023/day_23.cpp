@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -188,6 +187,7 @@ namespace {
         return g;
     }
 
+    template<template<typename, typename> typename Queue>
     int longest_path(const graph& g) {
 
         std::vector<int> dist(g.size());
@@ -205,7 +205,7 @@ namespace {
             loc = -1;
         }
 
-        aoc::priority_queue<int> queue;
+        aoc::priority_queue<int, std::hash<int>, Queue> queue;
         int start = g.front().index;
         queue.insert(start,0);
         dist[0] = 0;
@@ -349,12 +349,29 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_23(const std::string& title) {
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2023::day_23_with_queue() {
+    return aoc::make_solver(
+        []() {
+            auto input = aoc::file_to_string_vector(aoc::input_path(2023, 23));
+            auto digraph = parse_input( input );
+            return std::tuple{ std::move(input), std::move(digraph) };
+        },
+        [](const auto& inp) {
+            const auto& [input, digraph] = inp;
+            return longest_path<Queue>(digraph);
+        },
+        [](const auto& inp) {
+            const auto& [input, digraph] = inp;
+            return longest_path_undirected(part2_graph(input));
+        }
+    );
+}
 
-    auto input = aoc::file_to_string_vector(aoc::input_path(2023, 23));
-    auto digraph = parse_input( input );
+template aoc::solver_ptr aoc::y2023::day_23_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2023::day_23_with_queue<aoc::indexed_4ary_heap>();
 
-    std::println("--- Day 23: {0} ---\n", title);
-    std::println("  part 1: {}", longest_path(digraph));
-    std::println("  part 2: {}", longest_path_undirected(part2_graph(input)));
+// the search negates the edge weights, which rules out the radix heap.
+aoc::solver_ptr aoc::y2023::day_23() {
+    return day_23_with_queue<aoc::indexed_4ary_heap>();
 }
\ No newline at end of file
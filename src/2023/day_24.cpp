@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -199,20 +198,21 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_24(const std::string& title) {
-
-    auto particles = aoc::file_to_string_vector(aoc::input_path(2023, 24)) |
-        rv::transform(str_to_particle) | r::to<std::vector<particle>>();
-
-    std::println("--- Day 24: {0} ---\n", title);
-    std::println("  part 1: {}", 
-        count_2d_intersections( particles, 200000000000000.0, 400000000000000.0)
+aoc::solver_ptr aoc::y2023::day_24() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(aoc::input_path(2023, 24)) |
+                rv::transform(str_to_particle) | r::to<std::vector<particle>>();
+        },
+        [](const auto& particles) {
+            return count_2d_intersections( particles, 200000000000000.0, 400000000000000.0);
+        },
+        [](const auto& particles) {
+            auto vel = find_velocity(particles, 250);
+            auto pt = line_line_intersection(particles[0].pos, particles[0].pos + particles[0].vel + *vel,
+                particles[1].pos, particles[1].pos + particles[1].vel + *vel);
+
+            return pt->x + pt->y + pt->z;
+        }
     );
-
-    auto vel = find_velocity(particles, 250);
-    auto pt = line_line_intersection(particles[0].pos, particles[0].pos + particles[0].vel + *vel,
-        particles[1].pos, particles[1].pos + particles[1].vel + *vel);
-
-    std::println("  part 2: {}", pt->x + pt->y + pt->z);
-
 }
\ No newline at end of file
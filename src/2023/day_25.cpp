@@ -1,6 +1,5 @@
 #include "y2023.h"
 #include "../util/util.h"
-#include <print>
 #include <ranges>
 #include <numeric>
 #include <algorithm>
@@ -251,16 +250,22 @@ namespace {
 
 /*------------------------------------------------------------------------------------------------*/
 
-void aoc::y2023::day_25(const std::string& title) {
-    auto graph = parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 25)));
-
-    std::println("--- Day 25: {0} ---\n", title);
-
-    auto edges = kargers_algorithm(graph, 3);
-    for (auto e : edges) {
-        auto [u, v] = aoc::split_to_tuple<2>(e, '-');
-        graph.remove_edge(u, v);
-    }
-    auto comps = graph.connect_components_size();
-    std::println("  part 1: {}", comps.front() * comps.back());
+aoc::solver_ptr aoc::y2023::day_25() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(aoc::file_to_string_vector(aoc::input_path(2023, 25)));
+        },
+        [](auto graph) {
+            auto edges = kargers_algorithm(graph, 3);
+            for (auto e : edges) {
+                auto [u, v] = aoc::split_to_tuple<2>(e, '-');
+                graph.remove_edge(u, v);
+            }
+            auto comps = graph.connect_components_size();
+            return comps.front() * comps.back();
+        },
+        [](const auto&) {
+            return "xmas freebie";
+        }
+    );
 }
\ No newline at end of file
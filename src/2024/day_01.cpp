@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <algorithm>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -49,19 +48,25 @@ namespace {
     }
 }
 
-void aoc::y2024::day_01(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2024, 1)
-        ) | rv::transform(
-            [](auto&& str) { return aoc::extract_numbers(str); }
-        ) | r::to<std::vector>();
-
-    auto left = inp | rv::transform([](auto&& v) {return v[0]; }) | r::to<std::vector>();
-    auto right = inp | rv::transform([](auto&& v) {return v[1]; }) | r::to<std::vector>();
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}", sum_of_distances(left, right) );
-    std::println("  part 2: {}", similarity(left, right) );
-    
+aoc::solver_ptr aoc::y2024::day_01() {
+    return aoc::make_solver(
+        []() {
+            auto inp = aoc::file_to_string_vector(
+                    aoc::input_path(2024, 1)
+                ) | rv::transform(
+                    [](auto&& str) { return aoc::extract_numbers(str); }
+                ) | r::to<std::vector>();
+            auto left = inp | rv::transform([](auto&& v) {return v[0]; }) | r::to<std::vector>();
+            auto right = inp | rv::transform([](auto&& v) {return v[1]; }) | r::to<std::vector>();
+            return std::tuple{ std::move(left), std::move(right) };
+        },
+        [](const auto& inp) {
+            const auto& [left, right] = inp;
+            return sum_of_distances(left, right);
+        },
+        [](const auto& inp) {
+            const auto& [left, right] = inp;
+            return similarity(left, right);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -55,16 +54,20 @@ namespace {
 
 }
 
-void aoc::y2024::day_02(const std::string& title) {
-
-    auto reports = aoc::file_to_string_vector(
-            aoc::input_path( 2024, 2 )
-        ) | rv::transform(
-            [](auto&& str) { return aoc::extract_numbers(str); }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 2: {} ---", title);
-    std::println("  part 1: {}", r::count_if( reports, is_safe) );
-    std::println("  part 2: {}", r::count_if( reports, is_safe_with_dampener) );
-    
+aoc::solver_ptr aoc::y2024::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path( 2024, 2 )
+                ) | rv::transform(
+                    [](auto&& str) { return aoc::extract_numbers(str); }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& reports) {
+            return r::count_if( reports, is_safe);
+        },
+        [](const auto& reports) {
+            return r::count_if( reports, is_safe_with_dampener);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <regex>
 #include <variant>
@@ -74,19 +73,20 @@ namespace {
     }
 }
 
-void aoc::y2024::day_03(const std::string& title) {
-
-    auto inp = parse_instructions(
-        aoc::file_to_string(
-            aoc::input_path(2024, 3)
-        )
-    );
-
-    std::println("--- Day 3: {} ---", title);
-    std::println("  part 1: {}", 
-        perform_instructions( inp, true) );
-    std::println("  part 2: {}",
-        perform_instructions( inp, false )
+aoc::solver_ptr aoc::y2024::day_03() {
+    return aoc::make_solver(
+        []() {
+            return parse_instructions(
+                aoc::file_to_string(
+                    aoc::input_path(2024, 3)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return perform_instructions( inp, true);
+        },
+        [](const auto& inp) {
+            return perform_instructions( inp, false );
+        }
     );
-    
 }
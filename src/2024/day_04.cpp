@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <algorithm>
 #include <ranges>
 #include <unordered_set>
@@ -87,14 +86,18 @@ namespace {
     }
 }
 
-void aoc::y2024::day_04(const std::string& title) {
-
-    auto grid = aoc::file_to_string_vector(
-            aoc::input_path(2024, 4)
-        ); 
-
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}", count_xmas_strings(grid));
-    std::println("  part 2: {}", count_xmas_crosses(grid) );
-    
+aoc::solver_ptr aoc::y2024::day_04() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2024, 4)
+                );
+        },
+        [](const auto& grid) {
+            return count_xmas_strings(grid);
+        },
+        [](const auto& grid) {
+            return count_xmas_crosses(grid);
+        }
+    );
 }
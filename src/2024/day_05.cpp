@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <tuple>
 #include <stack>
@@ -91,16 +90,22 @@ namespace {
     }
 }
 
-void aoc::y2024::day_05(const std::string& title) {
-
-    auto [rules, updates] = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 5)
-        )
+aoc::solver_ptr aoc::y2024::day_05() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 5)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [rules, updates] = inp;
+            return do_part_1(rules, updates);
+        },
+        [](const auto& inp) {
+            const auto& [rules, updates] = inp;
+            return do_part_2(rules, updates);
+        }
     );
-
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}", do_part_1(rules, updates));
-    std::println("  part 2: {}", do_part_2(rules, updates));
-    
 }
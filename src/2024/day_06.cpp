@@ -1,10 +1,10 @@
 
 #include "../util/util.h"
 #include "../util/vec2.h"
+#include "../util/dense_point.h"
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <execution>
@@ -17,7 +17,7 @@ namespace rv = std::ranges::views;
 
 namespace {
     using point = aoc::vec2<int>;
-    using point_set = aoc::vec2_set<int>;
+    using point_set = aoc::dense_point_set;
     using grid = std::vector<std::string>;
 
     struct state {
@@ -47,7 +47,7 @@ namespace {
     std::tuple<point, bounds, point_set> parse_input(const grid& grid) {
         bounds bnds{ static_cast<int>(grid.front().size()), static_cast<int>(grid.size()) };
         point start;
-        point_set walls;
+        point_set walls(bnds.wd, bnds.hgt);
         for (auto [x, y] : rv::cartesian_product(rv::iota(0, bnds.wd), rv::iota(0, bnds.hgt))) {
             auto pt = point{ x,y };
             auto tile = grid[y][x];
@@ -93,7 +93,7 @@ namespace {
     }
 
     point_set visited_locs(const point& start, const bounds& bounds, const point_set& walls) {
-        point_set visited;
+        point_set visited(bounds.wd, bounds.hgt);
         simulate_guard(start, bounds, walls,
             [&visited](const state& s) {
                 visited.insert(s.loc);
@@ -110,7 +110,7 @@ namespace {
     }
 
     int count_loops(const point& start, const bounds& bounds, const point_set& walls) {
-        auto floors = visited_locs(start, bounds, walls);
+        auto floors = visited_locs(start, bounds, walls) | r::to<std::vector>();
 
         // use parallel count_if...
         return static_cast<int>(
@@ -125,16 +125,22 @@ namespace {
     }
 }
 
-void aoc::y2024::day_06(const std::string& title) {
-
-    auto [start_loc, bounds, walls] = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 6)
-        )
+aoc::solver_ptr aoc::y2024::day_06() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 6)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [start_loc, bounds, walls] = inp;
+            return count_visited_locs(start_loc, bounds, walls);
+        },
+        [](const auto& inp) {
+            const auto& [start_loc, bounds, walls] = inp;
+            return count_loops(start_loc, bounds, walls);
+        }
     );
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}", count_visited_locs(start_loc, bounds, walls));
-    std::println("  part 2: {}", count_loops(start_loc, bounds, walls));
-    
 }
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -128,20 +127,20 @@ namespace {
     }
 }
 
-void aoc::y2024::day_07(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2024, 7)
-        ) | rv::transform(
-            parse_equation
-        ) | r::to<std::vector>();
-    
-    std::println("--- Day 7: {} ---", title);
-    std::println("  part 1: {}",
-        sum_solved_equations(inp, false)
-    );
-    std::println("  part 2: {}", 
-        sum_solved_equations(inp, true)
+aoc::solver_ptr aoc::y2024::day_07() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2024, 7)
+                ) | rv::transform(
+                    parse_equation
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return sum_solved_equations(inp, false);
+        },
+        [](const auto& inp) {
+            return sum_solved_equations(inp, true);
+        }
     );
-    
 }
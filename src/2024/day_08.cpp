@@ -4,7 +4,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -97,20 +96,22 @@ namespace {
     }
 }
 
-void aoc::y2024::day_08(const std::string& title) {
-
-    auto [antennas, bounds] = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 8)
-        )
-    );
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}", 
-        count_antinodes(antennas, bounds, antinodes_from_antennas)
-    );
-    std::println("  part 2: {}",
-        count_antinodes(antennas, bounds, antinodes_with_harmonics)
+aoc::solver_ptr aoc::y2024::day_08() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 8)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [antennas, bounds] = inp;
+            return count_antinodes(antennas, bounds, antinodes_from_antennas);
+        },
+        [](const auto& inp) {
+            const auto& [antennas, bounds] = inp;
+            return count_antinodes(antennas, bounds, antinodes_with_harmonics);
+        }
     );
-    
 }
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <map>
 #include <unordered_set>
@@ -197,17 +196,20 @@ namespace {
     }
 }
 
-void aoc::y2024::day_09(const std::string& title) {
-
-    auto disk_map = parse_input(
-        aoc::file_to_string(
-            aoc::input_path(2024, 9)
-        )
-    ); 
-
-    std::println("--- Day 9: {} ---", title);
-
-    std::println("  part 1: {}", packed_by_block_checksum(disk_map) );
-    std::println("  part 2: {}", packed_by_file_checksum(disk_map));
-    
+aoc::solver_ptr aoc::y2024::day_09() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string(
+                    aoc::input_path(2024, 9)
+                )
+            );
+        },
+        [](const auto& disk_map) {
+            return packed_by_block_checksum(disk_map);
+        },
+        [](const auto& disk_map) {
+            return packed_by_file_checksum(disk_map);
+        }
+    );
 }
@@ -4,7 +4,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <stack>
@@ -105,16 +104,20 @@ namespace {
     }
 }
 
-void aoc::y2024::day_10(const std::string& title) {
-
-    auto inp = aoc::strings_to_2D_array_of_digits(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 10)
-        )
+aoc::solver_ptr aoc::y2024::day_10() {
+    return aoc::make_solver(
+        []() {
+            return aoc::strings_to_2D_array_of_digits(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 10)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return score_all_trailheads(inp, false);
+        },
+        [](const auto& inp) {
+            return score_all_trailheads(inp, true);
+        }
     );
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1: {}", score_all_trailheads(inp, false) );
-    std::println("  part 2: {}", score_all_trailheads(inp, true) );
-    
 }
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -63,16 +62,20 @@ namespace {
     }
 }
 
-void aoc::y2024::day_11(const std::string& title) {
-
-    auto inp = aoc::extract_numbers_int64(
-        aoc::file_to_string(
-            aoc::input_path(2024, 11)
-        )
+aoc::solver_ptr aoc::y2024::day_11() {
+    return aoc::make_solver(
+        []() {
+            return aoc::extract_numbers_int64(
+                aoc::file_to_string(
+                    aoc::input_path(2024, 11)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return count_after_n_blinks(inp, 25);
+        },
+        [](const auto& inp) {
+            return count_after_n_blinks(inp, 75);
+        }
     );
-
-    std::println("--- Day 11: {} ---", title);
-    std::println("  part 1: {}", count_after_n_blinks(inp, 25));
-    std::println("  part 2: {}", count_after_n_blinks(inp, 75));
-    
 }
@@ -4,7 +4,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <stack>
@@ -140,14 +139,18 @@ namespace {
     }
 }
 
-void aoc::y2024::day_12(const std::string& title) {
-
-    auto garden = aoc::file_to_string_vector(
-            aoc::input_path(2024, 12)
-        ); 
-
-    std::println("--- Day 12: {} ---", title);
-    std::println("  part 1: {}", cost_of_fence( garden, perimeter_of_plot ));
-    std::println("  part 2: {}", cost_of_fence( garden, num_sides_per_plot ));
-    
+aoc::solver_ptr aoc::y2024::day_12() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2024, 12)
+                );
+        },
+        [](const auto& garden) {
+            return cost_of_fence( garden, perimeter_of_plot );
+        },
+        [](const auto& garden) {
+            return cost_of_fence( garden, num_sides_per_plot );
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -82,18 +81,22 @@ namespace {
     }
 }
 
-void aoc::y2024::day_13(const std::string& title) {
-
-    auto inp = aoc::group_strings_separated_by_blank_lines(
-            aoc::file_to_string_vector(
-                aoc::input_path(2024, 13)
-            )
-        ) | rv::transform(
-            parse_claw_game
-        ) | r::to<std::vector>();
- 
-    std::println("--- Day 13: {} ---", title);
-    std::println("  part 1: {}", cost_for_all_wins(inp) );
-    std::println("  part 2: {}", cost_for_all_wins(make_part2_input(inp)) );
-    
+aoc::solver_ptr aoc::y2024::day_13() {
+    return aoc::make_solver(
+        []() {
+            return aoc::group_strings_separated_by_blank_lines(
+                    aoc::file_to_string_vector(
+                        aoc::input_path(2024, 13)
+                    )
+                ) | rv::transform(
+                    parse_claw_game
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return cost_for_all_wins(inp);
+        },
+        [](const auto& inp) {
+            return cost_for_all_wins(make_part2_input(inp));
+        }
+    );
 }
@@ -4,7 +4,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <stack>
@@ -124,17 +123,15 @@ namespace {
         return max_sz;
     }
 
-    void display(const bounds& bounds, const std::vector<robot>& robots) {
+    std::string display(const bounds& bounds, const std::vector<robot>& robots) {
         std::vector<std::string> grid(bounds.hgt, std::string(bounds.wd, '.'));
         for (const auto& robot : robots) {
             grid[robot.pos.y][robot.pos.x] = '#';
         }
-        for (const auto& row : grid) {
-            std::println("{}", row);
-        }
+        return grid | rv::join_with('\n') | r::to<std::string>();
     }
 
-    void do_part_2(const bounds& bounds, const std::vector<robot>& inp) {
+    std::string do_part_2(const bounds& bounds, const std::vector<robot>& inp) {
         auto robots = inp;
         int biggest_cc = 0;
         int iteration = 0;
@@ -144,24 +141,26 @@ namespace {
             biggest_cc = biggest_connected_component(bounds, robots);
         } while (biggest_cc < 200);
 
-        std::println("after {} seconds...", iteration);
-        display(bounds, robots);
+        return std::format("after {} seconds...\n{}", iteration, display(bounds, robots));
     }
 }
 
-void aoc::y2024::day_14(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2024, 14)
-        ) | rv::transform(
-            parse_robot
-        ) | r::to<std::vector>();
-
-    bounds dimensions{ 101,103 };
-
-    std::println("--- Day 14: {} ---", title);
-    std::println("  part 1: {}", do_part_1(dimensions, inp) );
-    std::println("  part 2:\n");
-    do_part_2(dimensions, inp);
-    
+aoc::solver_ptr aoc::y2024::day_14() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2024, 14)
+                ) | rv::transform(
+                    parse_robot
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            bounds dimensions{ 101,103 };
+            return do_part_1(dimensions, inp);
+        },
+        [](const auto& inp) {
+            bounds dimensions{ 101,103 };
+            return do_part_2(dimensions, inp);
+        }
+    );
 }
@@ -4,7 +4,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 
@@ -213,26 +212,26 @@ namespace {
     }
 }
 
-void aoc::y2024::day_15(const std::string& title) {
-
-    auto [warehouse, instrs] = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 15)
-        )
-    );
-
-    std::println("--- Day 15: {} ---", title);
-
-    std::println("  part 1: {}", 
-        score(
-            run_instructions(warehouse, instrs)
-        )
-    );
-
-    std::println("  part 2: {}", 
-        score(
-            run_instructions(make_double_wide(warehouse), instrs)
-        )
+aoc::solver_ptr aoc::y2024::day_15() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 15)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [warehouse, instrs] = inp;
+            return score(
+                run_instructions(warehouse, instrs)
+            );
+        },
+        [](const auto& inp) {
+            const auto& [warehouse, instrs] = inp;
+            return score(
+                run_instructions(make_double_wide(warehouse), instrs)
+            );
+        }
     );
-    
 }
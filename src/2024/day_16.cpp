@@ -1,15 +1,14 @@
 
 #include "../util/util.h"
 #include "../util/vec2.h"
+#include "../util/graph_search.h"
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
 #include <boost/functional/hash.hpp>
-#include <queue>
 
 namespace r = std::ranges;
 namespace rv = std::ranges::views;
@@ -62,9 +61,6 @@ namespace {
             return seed;
         }
     };
-    using state_set = std::unordered_set<state, state_hash>;
-    using dist_map = std::unordered_map<state, int, state_hash>;
-    using predecessor_map = std::unordered_map<state, std::vector<state>, state_hash>;
 
     auto directions() {
         return rv::iota(0, 4) | rv::transform(
@@ -127,97 +123,30 @@ namespace {
         ) | r::to<std::vector>();
     }
 
-    std::tuple<dist_map, predecessor_map> dijkstra_shortest_path(const maze& maze) {
-        dist_map dist;
-        predecessor_map pred;
-        aoc::priority_queue<state, state_hash> queue;
-        state start_state = { maze.start, east };
-        queue.insert(start_state, 0);
-        dist[start_state] = 0;
-
-        while (!queue.empty()) {
-            auto u = queue.extract_min();
-            for (auto [v, dist_to_v] : neighboring_states(u, maze)) {
-                auto dist_to_u = dist.at(u);
-                auto dist_through_u_to_v = dist_to_u + dist_to_v;
-                auto curr_dist_to_v = dist.contains(v) ? dist.at(v) : std::numeric_limits<int>::max();
-
-                if (dist_through_u_to_v <= curr_dist_to_v) {
-                    bool new_pred = dist.contains(v) && dist[v] != dist_through_u_to_v;
-                    dist[v] = dist_through_u_to_v;
-                    if (new_pred) {
-                        pred[v].clear();
-                    }
-                    pred[v].push_back(u);
-
-                    if (dist_through_u_to_v == curr_dist_to_v) {
-                        continue;
-                    }
-
-                    if (queue.contains(v)) {
-                        queue.change_priority(v, dist_through_u_to_v);
-                    } else {
-                        queue.insert(v, dist_through_u_to_v);
-                    }
-                }
-            }
-        }
-
-        return { std::move(dist), std::move(pred) };
-    }
-
-    int shortest_path_from_distance_map(const dist_map& dist, const point& end) {
-        return r::min(
-            dist | rv::filter(
-                [&](auto&& pair)->int {
-                    const state& s = pair.first;
-                    return (s.loc ==end);
-                }
-            ) | rv::transform(
-                [](auto&& pair) {
-                    return pair.second;
-                }
-            )
+    // every shortest path from the start to any state at the end, i.e. facing in
+    // any direction.
+    template<template<typename, typename> typename Queue>
+    auto shortest_paths(const maze& maze) {
+        return aoc::dijkstra_search<aoc::search_tracking::all_paths, Queue>(
+            state{ maze.start, east },
+            [&](const state& u) {
+                return neighboring_states(u, maze);
+            },
+            [&](const state& s) {
+                return s.loc == maze.end;
+            },
+            aoc::hashed_states<state, state_hash>{}
         );
     }
 
+    template<template<typename, typename> typename Queue>
     int shortest_path_len(const maze& maze) {
-        auto [dist, _] = dijkstra_shortest_path(maze);
-        return shortest_path_from_distance_map(dist, maze.end);
+        return *shortest_paths<Queue>(maze).goal_distance();
     }
 
+    template<template<typename, typename> typename Queue>
     int locations_on_shortest_paths(const maze& maze) {
-        std::queue<state> queue;
-
-        auto [dist_map, pred_map] = dijkstra_shortest_path(maze);
-        int short_path_len = shortest_path_from_distance_map(dist_map, maze.end);
-        auto intial_states = dist_map | rv::filter(
-            [&](auto&& pair) {
-                return pair.first.loc == maze.end && pair.second == short_path_len;
-            }
-        ) | rv::keys;
-
-        for (auto init : intial_states) {
-            queue.push(init);
-        }
-
-        state_set visited;
-        while (!queue.empty()) {
-            auto curr_state = queue.front();
-            queue.pop();
-
-            if (visited.contains(curr_state)) {
-                continue;
-            }
-            visited.insert(curr_state);
-
-            const auto& preds = pred_map[curr_state];
-            for (auto pred : preds) {
-                queue.push(pred);
-            }
-        }
-
-        auto shortest_path_locs = visited |
+        auto shortest_path_locs = shortest_paths<Queue>(maze).shortest_path_states() |
             rv::transform(
                 [](auto&& s) {
                     return s.loc;
@@ -227,18 +156,33 @@ namespace {
         return static_cast<int>(shortest_path_locs.size());
     }
 
-}
 
-void aoc::y2024::day_16(const std::string& title) {
+}
 
-    auto inp = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 16)
-        )
+template<template<typename, typename> typename Queue>
+aoc::solver_ptr aoc::y2024::day_16_with_queue() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 16)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return shortest_path_len<Queue>(inp);
+        },
+        [](const auto& inp) {
+            return locations_on_shortest_paths<Queue>(inp);
+        }
     );
+}
 
-    std::println("--- Day 16: {} ---", title);
-    std::println("  part 1: {}", shortest_path_len(inp));
-    std::println("  part 2: {}", locations_on_shortest_paths(inp));
-    
+template aoc::solver_ptr aoc::y2024::day_16_with_queue<aoc::multimap_priority_queue>();
+template aoc::solver_ptr aoc::y2024::day_16_with_queue<aoc::indexed_4ary_heap>();
+template aoc::solver_ptr aoc::y2024::day_16_with_queue<aoc::radix_heap>();
+
+// the moves cost 1 or 1001, so the monotone radix heap applies.
+aoc::solver_ptr aoc::y2024::day_16() {
+    return day_16_with_queue<aoc::radix_heap>();
 }
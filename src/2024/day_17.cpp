@@ -1,9 +1,9 @@
 
 #include "../util/util.h"
+#include "../util/register_vm.h"
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -19,8 +19,6 @@ namespace {
     struct computer_state {
         std::array<int64_t, 3> registers;
         std::vector<int> program;
-        std::vector<int> output;
-        int instr_ptr;
     };
 
     computer_state parse_input(const std::vector<std::string>& inp) {
@@ -37,11 +35,30 @@ namespace {
         state.program = vals[4] | rv::transform(
                 [](auto v) {return static_cast<int>(v); }
             ) | r::to<std::vector>();
-        state.instr_ptr = 0;
 
         return state;
     }
 
+    constexpr int a_reg = 0;
+    constexpr int b_reg = 1;
+    constexpr int c_reg = 2;
+
+    // the dialect's codes are the 3-bit opcodes. Combo operands are resolved to
+    // registers or immediates before decoding, and jumps are made relative.
+    const aoc::vm_dialect& chronospatial_dialect() {
+        static const aoc::vm_dialect dialect({
+            {"adv", aoc::vm_op::shr, aoc::vm_fixed(a_reg), aoc::vm_fixed(a_reg), aoc::vm_written(0)},
+            {"bxl", aoc::vm_op::bit_xor, aoc::vm_fixed(b_reg), aoc::vm_fixed(b_reg), aoc::vm_written(0)},
+            {"bst", aoc::vm_op::mod, aoc::vm_fixed(b_reg), aoc::vm_written(0), aoc::vm_const(8)},
+            {"jnz", aoc::vm_op::jnz, aoc::vm_none(), aoc::vm_fixed(a_reg), aoc::vm_written(0)},
+            {"bxc", aoc::vm_op::bit_xor, aoc::vm_fixed(b_reg), aoc::vm_fixed(b_reg), aoc::vm_fixed(c_reg)},
+            {"out", aoc::vm_op::out, aoc::vm_none(), aoc::vm_written(0), aoc::vm_none()},
+            {"bdv", aoc::vm_op::shr, aoc::vm_fixed(b_reg), aoc::vm_fixed(a_reg), aoc::vm_written(0)},
+            {"cdv", aoc::vm_op::shr, aoc::vm_fixed(c_reg), aoc::vm_fixed(a_reg), aoc::vm_written(0)}
+        });
+        return dialect;
+    }
+
     enum op {
         adv = 0,
         bxl,
@@ -53,98 +70,55 @@ namespace {
         cdv
     };
 
-    using op_fn = std::function<void(computer_state&, int64_t)>;
-
-    constexpr int a_reg = 0;
-    constexpr int b_reg = 1;
-    constexpr int c_reg = 2;
-
-    struct op_info {
-        op_fn func;
-        bool literal_operand;
-    };
-
-    void do_adv(computer_state& state, int64_t operand) {
-        auto numer = state.registers[a_reg];
-        auto denom = static_cast<int64_t>(1) << operand;
-        state.registers[a_reg] = numer / denom;
-    }
-
-    void do_bxl(computer_state& state, int64_t operand) {
-        state.registers[b_reg] = state.registers[b_reg] ^ operand;
-    }
-
-    void do_bst(computer_state& state, int64_t operand) {
-        state.registers[b_reg] = operand % 8;
-    }
-
-    void do_jnz(computer_state& state, int64_t operand) {
-        if (state.registers[a_reg] == 0) {
-            return;
+    aoc::vm_operand combo_operand(int operand) {
+        if (operand >= 0 && operand <= 3) {
+            return aoc::vm_imm(operand);
         }
-        state.instr_ptr = operand;
-    }
-
-    void do_bxc(computer_state& state, int64_t operand) {
-        state.registers[b_reg] = state.registers[b_reg] ^ state.registers[c_reg];
-    }
-
-    void do_out(computer_state& state, int64_t operand) {
-        state.output.push_back(operand % 8);
+        if (operand == 7) {
+            throw std::runtime_error("this should not happen");
+        }
+        return aoc::vm_reg(operand - 4);
     }
 
-    void do_bdv(computer_state& state, int64_t operand) {
-        auto numer = state.registers[a_reg];
-        auto denom = static_cast<int64_t>(1) << operand;
-        state.registers[b_reg] = numer / denom;
+    aoc::vm_statement decode_statement(const std::vector<int>& program, int instr_ptr) {
+        auto code = program[instr_ptr];
+        auto operand = program[instr_ptr + 1];
+        switch (code) {
+            case bxl:
+            case bxc:
+                return { code, { aoc::vm_imm(operand) } };
+            case jnz:
+                if (operand % 2 != 0) {
+                    throw std::runtime_error("jump into the middle of an instruction");
+                }
+                return { code, { aoc::vm_imm((operand - instr_ptr) / 2) } };
+            default:
+                return { code, { combo_operand(operand) } };
+        }
     }
 
-    void do_cdv(computer_state& state, int64_t operand) {
-        auto numer = state.registers[a_reg];
-        auto denom = static_cast<int64_t>(1) << operand;
-        state.registers[c_reg] = numer / denom;
-    }
+    struct output_handler : aoc::vm_handler {
+        std::vector<int64_t> values;
 
-    int64_t eval_operand(const computer_state& state, int operand, bool literal_operand) {
-        if (literal_operand) {
-            return operand;
-        }
-        if (operand >= 0 && operand <= 3) {
-            return operand;
-        }
-        if (operand == 7) {
-            throw std::runtime_error("this should not happen");
+        void output(int64_t value) {
+            values.push_back(value % 8);
         }
-        return state.registers[operand - 4];
-    }
+    };
 
     std::string run_computer(const computer_state& inp) {
+        std::vector<aoc::vm_statement> statements;
+        for (int instr_ptr = 0; instr_ptr + 1 < static_cast<int>(inp.program.size()); instr_ptr += 2) {
+            statements.push_back(decode_statement(inp.program, instr_ptr));
+        }
 
-        const static std::unordered_map<op, op_info> op_tbl = {
-            {adv, {do_adv, false}},
-            {bxl, {do_bxl, true}},
-            {bst, {do_bst, false}},
-            {jnz, {do_jnz, true}},
-            {bxc, {do_bxc, true}},
-            {out, {do_out, false}},
-            {bdv, {do_bdv, false}},
-            {cdv, {do_cdv, false}}
-        };
-
-        auto state = inp;
-        while (state.instr_ptr < state.program.size()) {
-            const auto& op_info = op_tbl.at(static_cast<op>(state.program[state.instr_ptr]));
-            auto operand = eval_operand(
-                state, state.program[state.instr_ptr + 1], op_info.literal_operand
-            );
-            auto old_instr_ptr = state.instr_ptr;
-            op_info.func(state, operand);
-            if (old_instr_ptr == state.instr_ptr) {
-                state.instr_ptr += 2;
-            }
+        aoc::vm_machine machine(aoc::vm_assemble(chronospatial_dialect(), statements));
+        for (int reg = a_reg; reg <= c_reg; ++reg) {
+            machine[reg] = inp.registers[reg];
         }
+        output_handler handler;
+        machine.run(handler);
 
-        return state.output | rv::transform(
+        return handler.values | rv::transform(
                 [](auto&& v) { return std::to_string(v); }
             ) | rv::join_with(',') | r::to<std::string>();
     }
@@ -184,16 +158,20 @@ namespace {
 
 }
 
-void aoc::y2024::day_17(const std::string& title) {
-
-    auto inp = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 17)
-        )
+aoc::solver_ptr aoc::y2024::day_17() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 17)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return run_computer(inp);
+        },
+        [](const auto& inp) {
+            return find_magic_number(inp.program);
+        }
     );
-
-    std::println("--- Day 17: {} ---", title);
-    std::println("  part 1: {}", run_computer(inp) );
-    std::println("  part 2: {}", find_magic_number(inp.program) );
-    
 }
@@ -1,13 +1,12 @@
 
 #include "../util/util.h"
 #include "../util/vec2.h"
+#include "../util/graph_search.h"
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
-#include <queue>
 #include <format>
 
 namespace r = std::ranges;
@@ -25,36 +24,33 @@ namespace {
     }
 
     int shortest_path_len(const std::vector<point>& inp, int wd, int hgt) {
-        point_set visited;
         auto walls = inp | r::to<point_set>();
         auto target = point{ wd - 1,hgt - 1 };
-        std::queue<std::tuple<point, int>> queue;
         const static std::array<point, 4> deltas = { {
             {0,-1},{1,0},{0,1},{-1,0}
         } };
 
-        queue.emplace(point{ 0,0 }, 0);
-        while (!queue.empty()) {
-            auto [loc, dist] = queue.front();
-            queue.pop();
+        auto result = aoc::breadth_first_search(
+            point{ 0,0 },
+            [&](const point& loc) {
+                return deltas | rv::transform(
+                    [loc](auto&& d) {
+                        return d + loc;
+                    }
+                ) | rv::filter(
+                    [&](auto&& adj) {
+                        return adj.x >= 0 && adj.y >= 0 && adj.x < wd && adj.y < hgt &&
+                            !walls.contains(adj);
+                    }
+                );
+            },
+            [&](const point& loc) {
+                return loc == target;
+            },
+            aoc::grid_states(wd, hgt)
+        );
 
-            if (loc == target) {
-                return dist;
-            }
-
-            if (visited.contains(loc)) {
-                continue;
-            }
-            visited.insert(loc);
-
-            for (auto adj : deltas | rv::transform([&](auto&& d) {return d + loc; })) {
-                if (walls.contains(adj) || adj.x < 0 || adj.y < 0 || adj.x >= wd || adj.y >= hgt) {
-                    continue;
-                }
-                queue.emplace(adj, dist + 1);
-            }
-        }
-        return -1;
+        return result.goal_distance().value_or(-1);
     }
 
     std::string first_blocking_byte(const std::vector<point>& inp, int wd, int hgt) {
@@ -71,22 +67,24 @@ namespace {
     }
 }
 
-void aoc::y2024::day_18(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2024, 18)
-        ) | rv::transform(
-            parse_point
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 18: {} ---", title);
-    std::println("  part 1: {}",
-        shortest_path_len(
-            inp | rv::take(1024) | r::to<std::vector>(),
-            71,
-            71
-        )
+aoc::solver_ptr aoc::y2024::day_18() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2024, 18)
+                ) | rv::transform(
+                    parse_point
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return shortest_path_len(
+                inp | rv::take(1024) | r::to<std::vector>(),
+                71,
+                71
+            );
+        },
+        [](const auto& inp) {
+            return first_blocking_byte(inp, 71, 71);
+        }
     );
-    std::println("  part 2: {}", first_blocking_byte(inp, 71, 71));
-    
 }
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <unordered_map>
@@ -99,35 +98,35 @@ namespace {
     }
 }
 
-void aoc::y2024::day_19(const std::string& title) {
-
-    auto [towels, designs] = parse_inp(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 19)
-        )
-    );
-
-    std::println("--- Day 19: {} ---", title);
-
-    std::println("  part 1: {}",
-        r::count_if(
-            designs,
-            [&](const std::string& design) {
-                return is_valid_design(towels, design);
-            }
-        )
-    );
-
-    std::println("  part 2: {}",
-        r::fold_left(
-            designs | rv::transform(
-                [&](auto&& design) {
-                    return count_all_arrangements(towels, design);
+aoc::solver_ptr aoc::y2024::day_19() {
+    return aoc::make_solver(
+        []() {
+            return parse_inp(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 19)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [towels, designs] = inp;
+            return r::count_if(
+                designs,
+                [&](const std::string& design) {
+                    return is_valid_design(towels, design);
                 }
-            ),
-            0,
-            std::plus<>()
-        )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [towels, designs] = inp;
+            return r::fold_left(
+                designs | rv::transform(
+                    [&](auto&& design) {
+                        return count_all_arrangements(towels, design);
+                    }
+                ),
+                0,
+                std::plus<>()
+            );
+        }
     );
-    
 }
@@ -1,14 +1,14 @@
 
 #include "../util/util.h"
+#include "../util/graph_search.h"
 #include "../util/vec2.h"
+#include "../util/dense_point.h"
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <boost/functional/hash.hpp>
-#include <queue>
 #include <execution>
 
 namespace r = std::ranges;
@@ -19,10 +19,10 @@ namespace rv = std::ranges::views;
 namespace {
 
     using point = aoc::vec2<int>;
-    using point_set = aoc::vec2_set<int>;
+    using point_set = aoc::dense_point_set;
 
     template<typename T>
-    using point_map = aoc::vec2_map<int, T>;
+    using point_map = aoc::dense_point_map<T>;
 
     struct racetrack {
         point start;
@@ -37,6 +37,8 @@ namespace {
         racetrack rt;
         rt.wd = static_cast<int>(inp[0].size());
         rt.hgt = static_cast<int>(inp.size());
+        rt.walls = point_set(rt.wd, rt.hgt);
+        rt.empty = point_set(rt.wd, rt.hgt);
 
         for (auto [x, y] : rv::cartesian_product(rv::iota(0, rt.wd), rv::iota(0, rt.hgt))) {
             auto tile = inp[y][x];
@@ -77,30 +79,19 @@ namespace {
     }
 
     point_map<int> shortest_path_map( const racetrack& rt, bool start_to_end ) {
+        auto result = aoc::breadth_first_search(
+            start_to_end ? rt.start : rt.end,
+            [&rt](const point& loc) {
+                return adjacent_locs(rt, loc);
+            },
+            aoc::no_goal{},
+            aoc::grid_states(rt.wd, rt.hgt)
+        );
 
-        std::queue<std::tuple<point, int>> queue;
-        point_map<int> shortest_path;
-
-        point src, dest;
-        std::tie(src, dest) = (start_to_end) ?
-            std::tuple<point, point>{ rt.start, rt.end} :
-            std::tuple<point, point>{ rt.end,rt.start };
-
-        queue.emplace(src, 0);
-        while (!queue.empty()) {
-            auto [loc, dist] = queue.front();
-            queue.pop();
-
-            if (shortest_path.contains(loc)) {
-                continue;
-            }
-            shortest_path[loc] = dist;
-            
-            for (auto adj : adjacent_locs(rt, loc)) {
-                queue.emplace(adj, dist+1);
-            }
+        point_map<int> shortest_path(rt.wd, rt.hgt);
+        for (const auto& loc : result.visited()) {
+            shortest_path[loc] = *result.distance(loc);
         }
-
         return shortest_path;
     }
 
@@ -172,17 +163,20 @@ namespace {
     }
 }
 
-void aoc::y2024::day_20(const std::string& title) {
-
-    auto inp = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 20)
-        )
+aoc::solver_ptr aoc::y2024::day_20() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 20)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return count_timesaving_cheats(inp, find_cheats(inp, 2), 100);
+        },
+        [](const auto& inp) {
+            return count_timesaving_cheats(inp, find_cheats(inp, 20), 100);
+        }
     );
-
-    std::println("--- Day 20: {} ---", title);
-
-    std::println("  part 1: {}", count_timesaving_cheats(inp, find_cheats(inp, 2), 100) );
-    std::println("  part 2: {}", count_timesaving_cheats(inp, find_cheats(inp, 20), 100) );
-    
 }
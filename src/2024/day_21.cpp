@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include <optional>
@@ -144,14 +143,18 @@ namespace {
     }
 }
 
-void aoc::y2024::day_21(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-        aoc::input_path(2024, 21)
+aoc::solver_ptr aoc::y2024::day_21() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                aoc::input_path(2024, 21)
+            );
+        },
+        [](const auto& inp) {
+            return sum_of_complexities(3, inp);
+        },
+        [](const auto& inp) {
+            return sum_of_complexities(26, inp);
+        }
     );
-
-    std::println("--- Day 21: {} ---", title);
-    std::println("  part 1: {}", sum_of_complexities(3, inp));
-    std::println("  part 2: {}", sum_of_complexities(26, inp));
-
 }
\ No newline at end of file
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <boost/functional/hash.hpp>
@@ -116,18 +115,22 @@ namespace {
     }
 }
 
-void aoc::y2024::day_22(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2024, 22)
-        ) | rv::transform(
-            [](auto&& str) {
-                return aoc::string_to_int64(str);
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 22: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp) );
-    std::println("  part 2: {}", do_part_2(inp) );
-    
+aoc::solver_ptr aoc::y2024::day_22() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2024, 22)
+                ) | rv::transform(
+                    [](auto&& str) {
+                        return aoc::string_to_int64(str);
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <set>
 #include <unordered_set>
@@ -158,32 +157,33 @@ namespace {
     }
 }
 
-void aoc::y2024::day_23(const std::string& title) {
-
-    auto graph = make_graph(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 23)
-        ) | rv::transform(
-            str_to_edge
-        )
-    );
-
-    std::println("--- Day 23: {} ---", title);
-    std::println("  part 1: {}", 
-        r::count_if(
-            three_cycles(graph),
-            [](auto&& cycle) {
-                return !(
-                    r::find_if(
-                        cycle, 
-                        [](auto&& v) {
-                            return v[0] == 't'; 
-                        }
-                    ) == cycle.end());
-            }
-        )
+aoc::solver_ptr aoc::y2024::day_23() {
+    return aoc::make_solver(
+        []() {
+            return make_graph(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 23)
+                ) | rv::transform(
+                    str_to_edge
+                )
+            );
+        },
+        [](const auto& graph) {
+            return r::count_if(
+                three_cycles(graph),
+                [](auto&& cycle) {
+                    return !(
+                        r::find_if(
+                            cycle, 
+                            [](auto&& v) {
+                                return v[0] == 't'; 
+                            }
+                        ) == cycle.end());
+                }
+            );
+        },
+        [](const auto& graph) {
+            return find_largest_clique(graph);
+        }
     );
-
-    std::println("  part 2: {}", find_largest_clique(graph) );
-    
 }
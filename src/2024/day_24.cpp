@@ -275,20 +275,25 @@ namespace {
     }
 }
 
-void aoc::y2024::day_24(const std::string& title) {
-
-    auto [wires, gates] = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2024, 24, "test")
-        )
-    );
-
-    broken_adder adder(wires, gates);
+aoc::solver_ptr aoc::y2024::day_24() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2024, 24, "test")
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [wires, gates] = inp;
+            broken_adder adder(wires, gates);
 
-   // find_bad_bits(adder);
+            // find_bad_bits(adder);
 
-    std::println("--- Day 24: {} ---", title);
-    std::println("  part 1: {}", adder.eval());
-    std::println("  part 2: {}", "<figured it out from GraphViz output>");
-    
+            return adder.eval();
+        },
+        [](const auto&) {
+            return "<figured it out from GraphViz output>";
+        }
+    );
 }
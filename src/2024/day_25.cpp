@@ -3,7 +3,6 @@
 #include "y2024.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -62,27 +61,29 @@ namespace {
     }
 }
 
-void aoc::y2024::day_25(const std::string& title) {
-
-    auto [locks, keys] =  parse_input(
-            aoc::file_to_string_vector(
-                aoc::input_path(2024, 25)
-            )
-        );
-
-    std::println("--- Day 25: {} ---", title);
-    std::println("  part 1: {}",
-        static_cast<int64_t>(
-            r::count_if(
-                rv::cartesian_product(locks, keys),
-                [](const auto& lock_and_key)->bool {
-                    const auto& [lock, key] = lock_and_key;
-                    return lock_fits_key(lock, key);
-                }
-            )
-        )
+aoc::solver_ptr aoc::y2024::day_25() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                    aoc::file_to_string_vector(
+                        aoc::input_path(2024, 25)
+                    )
+                );
+        },
+        [](const auto& inp) {
+            const auto& [locks, keys] = inp;
+            return static_cast<int64_t>(
+                r::count_if(
+                    rv::cartesian_product(locks, keys),
+                    [](const auto& lock_and_key)->bool {
+                        const auto& [lock, key] = lock_and_key;
+                        return lock_fits_key(lock, key);
+                    }
+                )
+            );
+        },
+        [](const auto&) {
+            return "<xmas freebie>";
+        }
     );
-
-    std::println("  part 2: {}", "<xmas freebie>" );
-    
 }
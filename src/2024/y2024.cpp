@@ -1,48 +1,32 @@
-
 #include "y2024.h"
-#include <vector>
-#include <functional>
-#include <print>
 
-void aoc::y2024::do_advent_of_code(int day) {
-    const static auto advent_of_code_2024 = std::vector<std::function<void()>>{
-        []() { day_01( "Historian Hysteria" ); },
-        []() { day_02( "Red-Nosed Reports" ); },
-        []() { day_03( "Mull It Over" ); },
-        []() { day_04( "Ceres Search" ); },
-        []() { day_05( "Print Queue" ); },
-        []() { day_06( "Guard Gallivant" ); },
-        []() { day_07( "Bridge Repair" ); },
-        []() { day_08( "Resonant Collinearity" ); },
-        []() { day_09( "Disk Fragmenter" ); },
-        []() { day_10( "Hoof It" ); },
-        []() { day_11( "Plutonian Pebbles" ); },
-        []() { day_12( "Garden Groups" ); },
-        []() { day_13( "Claw Contraption" ); },
-        []() { day_14( "Restroom Redoubt" ); },
-        []() { day_15( "Warehouse Woes" ); },
-        []() { day_16( "Reindeer Maze" ); },
-        []() { day_17( "Chronospatial Computer" ); },
-        []() { day_18( "RAM Run" ); },
-        []() { day_19( "Linen Layout" ); },
-        []() { day_20( "Race Condition" ); },
-        []() { day_21( "Keypad Conundrum" ); },
-        []() { day_22( "Monkey Market" ); },
-        []() { day_23( "LAN Party" ); },
-        []() { day_24( "Crossed Wires" ); },
-        []() { day_25( "Code Chronicle" ); }
+const aoc::day_table& aoc::y2024::days() {
+    const static auto advent_of_code_2024 = aoc::day_table{
+        { "Historian Hysteria", day_01 },
+        { "Red-Nosed Reports", day_02 },
+        { "Mull It Over", day_03 },
+        { "Ceres Search", day_04 },
+        { "Print Queue", day_05 },
+        { "Guard Gallivant", day_06 },
+        { "Bridge Repair", day_07 },
+        { "Resonant Collinearity", day_08 },
+        { "Disk Fragmenter", day_09 },
+        { "Hoof It", day_10 },
+        { "Plutonian Pebbles", day_11 },
+        { "Garden Groups", day_12 },
+        { "Claw Contraption", day_13 },
+        { "Restroom Redoubt", day_14 },
+        { "Warehouse Woes", day_15 },
+        { "Reindeer Maze", day_16 },
+        { "Chronospatial Computer", day_17 },
+        { "RAM Run", day_18 },
+        { "Linen Layout", day_19 },
+        { "Race Condition", day_20 },
+        { "Keypad Conundrum", day_21 },
+        { "Monkey Market", day_22 },
+        { "LAN Party", day_23 },
+        { "Crossed Wires", day_24 },
+        { "Code Chronicle", day_25 }
     };
-    
-    auto index = day - 1;
-    if (index < 0) {
-        std::print("invalid day: {0}\n", day);
-        return;
-    }
-
-    if (index < advent_of_code_2024.size()) {
-        advent_of_code_2024[index]();
-    }
-    else {
-        std::print("Day {0} is not complete.\n", day);
-    }
+    return advent_of_code_2024;
 }
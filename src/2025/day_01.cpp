@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 
 namespace r = std::ranges;
@@ -68,16 +67,20 @@ namespace {
     }
 }
 
-void aoc::y2025::day_01(const std::string& title) {
-
-    auto inp = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2025, 1)
-        )
+aoc::solver_ptr aoc::y2025::day_01() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2025, 1)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return count_zeros(inp, true);
+        },
+        [](const auto& inp) {
+            return count_zeros(inp, false);
+        }
     );
-
-    std::println("--- Day 1: {} ---", title);
-    std::println("  part 1: {}", count_zeros(inp, true) );
-    std::println("  part 2: {}", count_zeros(inp, false) );
-
 }
@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <algorithm>
 #include <functional>
@@ -78,22 +77,26 @@ namespace {
     }
 }
 
-void aoc::y2025::day_02(const std::string& title) {
-
-    auto inp = aoc::split(
-            aoc::file_to_string(
-                aoc::input_path(2025, 2)
-            ),
-            ','
-        ) | rv::transform(
-            [](auto&& line)->id_range {
-                auto nums = aoc::extract_numbers_int64(line, false);
-                return { nums.front(), nums.back() };
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 2: {} ---", title);
-    std::println("  part 1: {}", sum_of_invalid_ids(inp, is_invalid_id_part_1));
-    std::println("  part 2: {}", sum_of_invalid_ids(inp, is_invalid_id_part_2));
-    
+aoc::solver_ptr aoc::y2025::day_02() {
+    return aoc::make_solver(
+        []() {
+            return aoc::split(
+                    aoc::file_to_string(
+                        aoc::input_path(2025, 2)
+                    ),
+                    ','
+                ) | rv::transform(
+                    [](auto&& line)->id_range {
+                        auto nums = aoc::extract_numbers_int64(line, false);
+                        return { nums.front(), nums.back() };
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return sum_of_invalid_ids(inp, is_invalid_id_part_1);
+        },
+        [](const auto& inp) {
+            return sum_of_invalid_ids(inp, is_invalid_id_part_2);
+        }
+    );
 }
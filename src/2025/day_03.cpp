@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <sstream>
 
@@ -57,14 +56,18 @@ namespace {
 
 }
 
-void aoc::y2025::day_03(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2025, 3)
-        ); 
-
-    std::println("--- Day 3: {} ---", title);
-    std::println("  part 1: {}", sum_of_highest_n_digit_numbers(inp, 2) );
-    std::println("  part 2: {}", sum_of_highest_n_digit_numbers(inp, 12));
-    
+aoc::solver_ptr aoc::y2025::day_03() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2025, 3)
+                );
+        },
+        [](const auto& inp) {
+            return sum_of_highest_n_digit_numbers(inp, 2);
+        },
+        [](const auto& inp) {
+            return sum_of_highest_n_digit_numbers(inp, 12);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 #include "../util/vec2.h"
@@ -84,16 +83,20 @@ namespace {
     }
 }
 
-void aoc::y2025::day_04(const std::string& title) {
-
-    auto inp = to_point_set(
-        aoc::file_to_string_vector(
-            aoc::input_path(2025, 4)
-        )
+aoc::solver_ptr aoc::y2025::day_04() {
+    return aoc::make_solver(
+        []() {
+            return to_point_set(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2025, 4)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return do_part_1(inp);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
     );
-
-    std::println("--- Day 4: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp) );
-    std::println("  part 2: {}", do_part_2(inp) );
-    
 }
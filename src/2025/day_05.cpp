@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <tuple>
 #include <boost/icl/interval_set.hpp>
@@ -76,16 +75,22 @@ namespace {
 
 }
 
-void aoc::y2025::day_05(const std::string& title) {
-
-    auto [id_ranges, ids] = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2025, 5)
-        )
+aoc::solver_ptr aoc::y2025::day_05() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2025, 5)
+                )
+            );
+        },
+        [](const auto& inp) {
+            const auto& [id_ranges, ids] = inp;
+            return brute_force_part_1(id_ranges, ids);
+        },
+        [](const auto& inp) {
+            const auto& [id_ranges, ids] = inp;
+            return total_covered_ids(id_ranges);
+        }
     );
-
-    std::println("--- Day 5: {} ---", title);
-    std::println("  part 1: {}", brute_force_part_1(id_ranges, ids) );
-    std::println("  part 2: {}", total_covered_ids(id_ranges) );
-    
 }
@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <sstream>
 
@@ -106,16 +105,20 @@ namespace {
 
 }
 
-void aoc::y2025::day_06(const std::string& title) {
-
-    auto inp = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2025, 6)
-        )
+aoc::solver_ptr aoc::y2025::day_06() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2025, 6)
+                )
+            );
+        },
+        [](const auto& inp) {
+            return sum_of_columns(inp, eval_column_horz);
+        },
+        [](const auto& inp) {
+            return sum_of_columns(inp, eval_column_vert);
+        }
     );
-
-    std::println("--- Day 6: {} ---", title);
-    std::println("  part 1: {}", sum_of_columns(inp, eval_column_horz) );
-    std::println("  part 2: {}", sum_of_columns(inp, eval_column_vert));
-    
 }
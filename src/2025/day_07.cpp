@@ -4,7 +4,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <stack>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -113,18 +112,21 @@ namespace {
 }
 
 
-void aoc::y2025::day_07(const std::string& title) {
-
-    auto g = build_graph(
-        aoc::file_to_string_vector(
-            aoc::input_path(2025, 7)
-        )
+aoc::solver_ptr aoc::y2025::day_07() {
+    return aoc::make_solver(
+        []() {
+            return build_graph(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2025, 7)
+                )
+            );
+        },
+        [](const auto& g) {
+            // -2 in part 1, because the src and sink are not splitters
+            return reachable_vertices(g) - 2;
+        },
+        [](const auto& g) {
+            return count_paths_in_dag(g);
+        }
     );
-
-    std::println("--- Day 7: {} ---", title);
-
-    // -2 in part 1, because the src and sink are not splitters
-    std::println("  part 1: {}", reachable_vertices(g) - 2); 
-    std::println("  part 2: {}", count_paths_in_dag(g) );
-    
 }
@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <format>
-#include <print>
 #include <stack>
 #include <ranges>
 #include <unordered_set>
@@ -164,19 +163,23 @@ namespace {
 
 }
 
-void aoc::y2025::day_08(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2025, 8)
-        ) | rv::transform(
-            [](auto&& str)->point {
-                auto parts = aoc::extract_numbers_int64(str);
-                return { parts[0], parts[1], parts[2] };
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 8: {} ---", title);
-    std::println("  part 1: {}", do_part_1(inp, 1000));
-    std::println("  part 2: {}", do_part_2(inp) );
-    
+aoc::solver_ptr aoc::y2025::day_08() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2025, 8)
+                ) | rv::transform(
+                    [](auto&& str)->point {
+                        auto parts = aoc::extract_numbers_int64(str);
+                        return { parts[0], parts[1], parts[2] };
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return do_part_1(inp, 1000);
+        },
+        [](const auto& inp) {
+            return do_part_2(inp);
+        }
+    );
 }
@@ -7,7 +7,6 @@
 #include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -183,19 +182,23 @@ namespace {
     }
 }
 
-void aoc::y2025::day_09(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2025, 9)
-        ) | rv::transform(
-            [](auto&& str)->point {
-                auto v = aoc::extract_numbers_int64(str);
-                return { v[0],v[1] };
-            }
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 9: {} ---", title);
-    std::println("  part 1: {}", largest_area_rectangle(inp) );
-    std::println("  part 2: {}", largest_area_rectangle_in_poly(inp));
-    
+aoc::solver_ptr aoc::y2025::day_09() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2025, 9)
+                ) | rv::transform(
+                    [](auto&& str)->point {
+                        auto v = aoc::extract_numbers_int64(str);
+                        return { v[0],v[1] };
+                    }
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return largest_area_rectangle(inp);
+        },
+        [](const auto& inp) {
+            return largest_area_rectangle_in_poly(inp);
+        }
+    );
 }
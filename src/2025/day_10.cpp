@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <queue>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <algorithm>
 #include <unordered_set>
@@ -176,16 +175,20 @@ namespace {
     }
 }
 
-void aoc::y2025::day_10(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(2025, 10)
-        ) | rv::transform(
-            parse_machine
-        ) | r::to<std::vector>();
-
-    std::println("--- Day 10: {} ---", title);
-    std::println("  part 1: {}", fewest_total_button_presses(inp) );
-    std::println("  part 2: {}", fewest_total_joltage_presses(inp) );
-    
+aoc::solver_ptr aoc::y2025::day_10() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                    aoc::input_path(2025, 10)
+                ) | rv::transform(
+                    parse_machine
+                ) | r::to<std::vector>();
+        },
+        [](const auto& inp) {
+            return fewest_total_button_presses(inp);
+        },
+        [](const auto& inp) {
+            return fewest_total_joltage_presses(inp);
+        }
+    );
 }
@@ -3,7 +3,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_map>
 #include <unordered_set>
@@ -105,21 +104,23 @@ namespace {
 
 }
 
-void aoc::y2025::day_11(const std::string& title) {
-
-    auto graph = parse_input(
-        aoc::file_to_string_vector(
-            aoc::input_path(2025, 11)
-        )
-    );
-
-    std::println("--- Day 11: {} ---", title);
-    std::println("  part 1: {}", count_paths_dag(graph, "you", "out"));
-    std::println("  part 2: {}", 
-        count_paths_including_nodes(
-            graph, "svr", "out", 
-            {"fft","dac"}
-        )
+aoc::solver_ptr aoc::y2025::day_11() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                aoc::file_to_string_vector(
+                    aoc::input_path(2025, 11)
+                )
+            );
+        },
+        [](const auto& graph) {
+            return count_paths_dag(graph, "you", "out");
+        },
+        [](const auto& graph) {
+            return count_paths_including_nodes(
+                graph, "svr", "out", 
+                {"fft","dac"}
+            );
+        }
     );
-    
 }
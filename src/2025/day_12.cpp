@@ -4,7 +4,6 @@
 #include "y2025.h"
 #include <filesystem>
 #include <functional>
-#include <print>
 #include <ranges>
 #include <unordered_set>
 
@@ -82,23 +81,26 @@ namespace {
     }
 }
 
-void aoc::y2025::day_12(const std::string& title) {
-
-    auto [shapes, regions] = parse_input(
-            aoc::file_to_string_vector(
-                aoc::input_path(2025, 12)
-            )
-        );
-
-    std::println("--- Day 12: {} ---", title);
-    std::println("  part 1: {}", 
-        r::count_if(
-            regions,
-            [&](auto&& rgn) {
-                return is_packing_feasible(rgn, shapes);
-            }
-        )
+aoc::solver_ptr aoc::y2025::day_12() {
+    return aoc::make_solver(
+        []() {
+            return parse_input(
+                    aoc::file_to_string_vector(
+                        aoc::input_path(2025, 12)
+                    )
+                );
+        },
+        [](const auto& inp) {
+            const auto& [shapes, regions] = inp;
+            return r::count_if(
+                regions,
+                [&](auto&& rgn) {
+                    return is_packing_feasible(rgn, shapes);
+                }
+            );
+        },
+        [](const auto&) {
+            return "<xmas freebie>";
+        }
     );
-    std::println("  part 2: {}", "<xmas freebie>");
-    
 }
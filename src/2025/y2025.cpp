@@ -1,35 +1,19 @@
-
 #include "y2025.h"
-#include <vector>
-#include <functional>
-#include <print>
 
-void aoc::y2025::do_advent_of_code(int day) {
-    const static auto advent_of_code_2025 = std::vector<std::function<void()>>{
-        []() { day_01( "Secret Entrance" ); },
-        []() { day_02( "Gift Shop" ); },
-        []() { day_03( "Lobby" ); },
-        []() { day_04( "Printing Department" ); },
-        []() { day_05( "Cafeteria" ); },
-        []() { day_06( "Trash Compactor" ); },
-        []() { day_07( "Laboratories" ); },
-        []() { day_08( "Playground" ); },
-        []() { day_09( "Movie Theater" ); },
-        []() { day_10( "Factory" ); },
-        []() { day_11( "Reactor" ); },
-        []() { day_12( "Christmas Tree Farm" ); },
+const aoc::day_table& aoc::y2025::days() {
+    const static auto advent_of_code_2025 = aoc::day_table{
+        { "Secret Entrance", day_01 },
+        { "Gift Shop", day_02 },
+        { "Lobby", day_03 },
+        { "Printing Department", day_04 },
+        { "Cafeteria", day_05 },
+        { "Trash Compactor", day_06 },
+        { "Laboratories", day_07 },
+        { "Playground", day_08 },
+        { "Movie Theater", day_09 },
+        { "Factory", day_10 },
+        { "Reactor", day_11 },
+        { "Christmas Tree Farm", day_12 }
     };
-    
-    auto index = day - 1;
-    if (index < 0) {
-        std::print("invalid day: {0}\n", day);
-        return;
-    }
-
-    if (index < advent_of_code_2025.size()) {
-        advent_of_code_2025[index]();
-    }
-    else {
-        std::print("Day {0} is not complete.\n", day);
-    }
+    return advent_of_code_2025;
 }
@@ -5,12 +5,25 @@
 #include "2021/y2021.h"
 #include "2020/y2020.h"
 #include "2019/y2019.h"
+#include "2019/intcode.h"
+#include "2019/intcode_analysis.h"
+#include "2019/intcode_network.h"
+#include "2019/intcode_profile.h"
 #include "2018/y2018.h"
+#include "2018/elfcode.h"
 #include "2017/y2017.h"
 #include "2016/y2016.h"
+#include "2016/assembunny.h"
 #include "2015/y2015.h"
+#include "2015/md5_multi.h"
 #include "util/util.h"
 #include "util/make_year.h"
+#include "util/bench.h"
+#include "util/sweep.h"
+#include "util/register_vm.h"
+#include "util/self_test.h"
+#include <algorithm>
+#include <fstream>
 #include <functional>
 #include <string>
 #include <print>
@@ -24,25 +37,270 @@ namespace rv = std::ranges::views;
 
 namespace {
 
-    void do_advent_of_code(int year, int day) {
-        static const std::unordered_map<int, std::function<void(int)>> years = { 
-            {2015, aoc::y2015::do_advent_of_code},
-            {2016, aoc::y2016::do_advent_of_code},
-            {2017, aoc::y2017::do_advent_of_code},
-            {2018, aoc::y2018::do_advent_of_code},
-            {2019, aoc::y2019::do_advent_of_code},
-            {2020, aoc::y2020::do_advent_of_code},
-            {2021, aoc::y2021::do_advent_of_code},
-            {2022, aoc::y2022::do_advent_of_code},
-            {2023, aoc::y2023::do_advent_of_code},
-            {2024, aoc::y2024::do_advent_of_code},
-            {2025, aoc::y2025::do_advent_of_code}
+    const std::unordered_map<int, const aoc::day_table*>& years() {
+        static const std::unordered_map<int, const aoc::day_table*> years = {
+            {2015, &aoc::y2015::days()},
+            {2016, &aoc::y2016::days()},
+            {2017, &aoc::y2017::days()},
+            {2018, &aoc::y2018::days()},
+            {2019, &aoc::y2019::days()},
+            {2020, &aoc::y2020::days()},
+            {2021, &aoc::y2021::days()},
+            {2022, &aoc::y2022::days()},
+            {2023, &aoc::y2023::days()},
+            {2024, &aoc::y2024::days()},
+            {2025, &aoc::y2025::days()}
         };
-        if (!years.contains(year)) {
+        return years;
+    }
+
+    // the days that search with aoc::priority_queue, for 'bench queues'.
+    std::vector<aoc::queue_bench_day> queue_bench_days() {
+        using aoc::multimap_priority_queue;
+        using aoc::indexed_4ary_heap;
+        using aoc::radix_heap;
+        return {
+            { 2015, 22, { 1, 2 },
+                aoc::y2015::day_22_with_queue<multimap_priority_queue>,
+                aoc::y2015::day_22_with_queue<indexed_4ary_heap>,
+                aoc::y2015::day_22_with_queue<radix_heap> },
+            { 2018, 22, { 2 },
+                aoc::y2018::day_22_with_queue<multimap_priority_queue>,
+                aoc::y2018::day_22_with_queue<indexed_4ary_heap>,
+                aoc::y2018::day_22_with_queue<radix_heap> },
+            { 2019, 18, { 1, 2 },
+                aoc::y2019::day_18_with_queue<multimap_priority_queue>,
+                aoc::y2019::day_18_with_queue<indexed_4ary_heap>,
+                aoc::y2019::day_18_with_queue<radix_heap> },
+            { 2021, 15, { 1, 2 },
+                aoc::y2021::day_15_with_queue<multimap_priority_queue>,
+                aoc::y2021::day_15_with_queue<indexed_4ary_heap>,
+                aoc::y2021::day_15_with_queue<radix_heap> },
+            { 2021, 23, { 1, 2 },
+                aoc::y2021::day_23_with_queue<multimap_priority_queue>,
+                aoc::y2021::day_23_with_queue<indexed_4ary_heap>,
+                aoc::y2021::day_23_with_queue<radix_heap> },
+            { 2022, 12, { 1, 2 },
+                aoc::y2022::day_12_with_queue<multimap_priority_queue>,
+                aoc::y2022::day_12_with_queue<indexed_4ary_heap>,
+                aoc::y2022::day_12_with_queue<radix_heap> },
+            { 2023, 17, { 1, 2 },
+                aoc::y2023::day_17_with_queue<multimap_priority_queue>,
+                aoc::y2023::day_17_with_queue<indexed_4ary_heap>,
+                aoc::y2023::day_17_with_queue<radix_heap> },
+            { 2023, 23, { 1 },
+                aoc::y2023::day_23_with_queue<multimap_priority_queue>,
+                aoc::y2023::day_23_with_queue<indexed_4ary_heap>,
+                {} },
+            { 2024, 16, { 1, 2 },
+                aoc::y2024::day_16_with_queue<multimap_priority_queue>,
+                aoc::y2024::day_16_with_queue<indexed_4ary_heap>,
+                aoc::y2024::day_16_with_queue<radix_heap> }
+        };
+    }
+
+    // prints the control flow graph of the intcode program that is the input of a
+    // 2019 day.
+    int dump_intcode_cfg(int year, int day) {
+        if (year != 2019) {
+            std::println("--dump-cfg expects an intcode day of 2019.");
+            return -1;
+        }
+        auto program = aoc::extract_numbers_int64(
+            aoc::file_to_string(aoc::input_path(year, day)), true
+        );
+        std::print("{}", aoc::intcode_cfg_listing(program, aoc::build_intcode_cfg(program)));
+        return 0;
+    }
+
+    // the instructions shown at the end of a profile, which is where a program
+    // that fails usually went wrong.
+    constexpr size_t k_profile_trace_length = 32;
+
+    // runs a day with every intcode computer and register machine on this thread
+    // profiled and prints the profiles after the day's output.
+    int profile_day(int year, int day) {
+        if (!years().contains(year)) {
+            std::println("'Advent of Code {}' not found.", year);
+            return -1;
+        }
+        aoc::intcode_profile intcode_profile(k_profile_trace_length);
+        aoc::vm_profile vm_profile;
+        {
+            aoc::intcode_profile::scope intcode_scope(intcode_profile);
+            aoc::vm_profile::scope vm_scope(vm_profile);
+            aoc::run_day(*years().at(year), day, {});
+        }
+        if (intcode_profile.instructions() > 0) {
+            std::print("\nintcode:\n{}", intcode_profile.report());
+        }
+        if (vm_profile.steps() > 0) {
+            std::print("\nregister machine:\n{}", vm_profile.report());
+        }
+        if (intcode_profile.instructions() == 0 && vm_profile.steps() == 0) {
+            std::println("\nno intcode computer or register machine ran.");
+        }
+        return 0;
+    }
+
+    void do_advent_of_code(int year, int day, std::optional<int> part) {
+        if (!years().contains(year)) {
             std::println("'Advent of Code {}' not found.", year);
             return;
         }
-        years.at(year)(day);
+        aoc::run_day(*years().at(year), day, part);
+    }
+
+    struct bench_args {
+        int year;
+        std::optional<int> day;
+        int reps;
+        std::string json_file;
+    };
+
+    // the arguments after 'bench <name>' of the benchmarks that are not of days.
+    std::vector<std::string> bench_options(int argc, char* argv[]) {
+        return rv::iota(3, argc) | rv::transform(
+                [&](auto i) -> std::string {
+                    return argv[i];
+                }
+            ) | r::to<std::vector>();
+    }
+
+    // the value, at least 1, of a '--name N' option, or default_value.
+    int parse_count(const std::vector<std::string>& args, const std::string& name, int default_value) {
+        for (size_t i = 0; i + 1 < args.size(); ++i) {
+            if (args[i] == name && aoc::is_number(args[i + 1])) {
+                return std::max(std::stoi(args[i + 1]), 1);
+            }
+        }
+        return default_value;
+    }
+
+    int parse_reps(const std::vector<std::string>& args, int default_reps) {
+        return parse_count(args, "--reps", default_reps);
+    }
+
+    // expects 'bench <year> [day] [--reps N] [--json file]'
+
+    std::optional<bench_args> parse_bench_args(int argc, char* argv[]) {
+        auto args = rv::iota(2, argc) | rv::transform(
+                [&](auto i) -> std::string {
+                    return argv[i];
+                }
+            ) | r::to<std::vector>();
+
+        if (args.empty() || !aoc::is_number(args.front())) {
+            return {};
+        }
+
+        bench_args bench{ std::stoi(args.front()), {}, 1, {} };
+        for (size_t i = 1; i < args.size(); ++i) {
+            const auto& arg = args[i];
+            bool has_value = i + 1 < args.size();
+            if (arg == "--reps" && has_value && aoc::is_number(args[i + 1])) {
+                bench.reps = std::max(std::stoi(args[++i]), 1);
+            } else if (arg == "--json" && has_value) {
+                bench.json_file = args[++i];
+            } else if (aoc::is_number(arg) && !bench.day) {
+                bench.day = std::stoi(arg);
+            } else {
+                return {};
+            }
+        }
+        return bench;
+    }
+
+    int do_benchmark(const bench_args& args) {
+        if (!years().contains(args.year)) {
+            std::println("'Advent of Code {}' not found.", args.year);
+            return -1;
+        }
+        const auto& year = *years().at(args.year);
+        auto num_days = static_cast<int>(year.size());
+        if (args.day && (*args.day < 1 || *args.day > num_days)) {
+            std::println("invalid day: {}", *args.day);
+            return -1;
+        }
+
+        auto days = (args.day) ?
+            std::vector<int>{ *args.day } :
+            rv::iota(1, num_days + 1) | r::to<std::vector>();
+
+        auto results = aoc::benchmark_days(args.year, days, args.reps, year);
+        aoc::print_bench_table(results);
+
+        if (!args.json_file.empty()) {
+            std::ofstream json(args.json_file);
+            if (!json) {
+                std::println("unable to write '{}'", args.json_file);
+                return -1;
+            }
+            json << aoc::bench_results_to_json(results);
+        }
+        return 0;
+    }
+
+    struct sweep_args {
+        std::optional<int> year;
+        int threads;
+        std::vector<std::string> timing_files;
+    };
+
+    // expects 'all [--threads N] [--timings file]...' or 'year <year> [...]'
+
+    std::optional<sweep_args> parse_sweep_args(int argc, char* argv[]) {
+        auto args = rv::iota(1, argc) | rv::transform(
+                [&](auto i) -> std::string {
+                    return argv[i];
+                }
+            ) | r::to<std::vector>();
+
+        sweep_args sweep{ {}, 0, {} };
+        size_t i = 1;
+        if (args.front() == "year") {
+            if (args.size() < 2 || !aoc::is_number(args[1])) {
+                return {};
+            }
+            sweep.year = std::stoi(args[1]);
+            i = 2;
+        }
+        for (; i < args.size(); ++i) {
+            const auto& arg = args[i];
+            bool has_value = i + 1 < args.size();
+            if (arg == "--threads" && has_value && aoc::is_number(args[i + 1])) {
+                sweep.threads = std::stoi(args[++i]);
+            } else if (arg == "--timings" && has_value) {
+                sweep.timing_files.push_back(args[++i]);
+            } else {
+                return {};
+            }
+        }
+        return sweep;
+    }
+
+    int do_sweep(const sweep_args& args) {
+        if (args.year && !years().contains(*args.year)) {
+            std::println("'Advent of Code {}' not found.", *args.year);
+            return -1;
+        }
+
+        auto year_list = years() | rv::keys | r::to<std::vector>();
+        r::sort(year_list);
+
+        std::vector<aoc::sweep_day> days;
+        for (auto year : year_list) {
+            if (args.year && year != *args.year) {
+                continue;
+            }
+            const auto* table = years().at(year);
+            for (int day = 1; day <= static_cast<int>(table->size()); ++day) {
+                days.emplace_back(year, day, table);
+            }
+        }
+
+        aoc::run_sweep(days, aoc::load_day_timings(args.timing_files), args.threads);
+        return 0;
     }
 
     bool is_integer(const std::string& str) {
@@ -81,11 +339,69 @@ namespace {
 
 int main(int argc, char* argv[]) {
 
+    if (argc == 2 && std::string{ argv[1] } == "test") {
+        auto failures = aoc::run_self_tests({
+            &aoc::util_self_tests(), &aoc::md5_self_tests(), &aoc::assembunny_self_tests(),
+            &aoc::elfcode_self_tests(), &aoc::intcode_self_tests()
+        });
+        return (failures == 0) ? 0 : -1;
+    }
+
+    if (argc >= 3 && std::string{ argv[1] } == "bench" && std::string{ argv[2] } == "extract") {
+        aoc::benchmark_number_extraction(parse_reps(bench_options(argc, argv), 5));
+        return 0;
+    }
+
+    if (argc >= 3 && std::string{ argv[1] } == "bench" && std::string{ argv[2] } == "queues") {
+        aoc::benchmark_priority_queues(queue_bench_days(), parse_reps(bench_options(argc, argv), 5));
+        return 0;
+    }
+
+    if (argc >= 3 && std::string{ argv[1] } == "bench" && std::string{ argv[2] } == "md5") {
+        aoc::benchmark_md5(parse_reps(bench_options(argc, argv), 5));
+        return 0;
+    }
+
+    if (argc >= 3 && std::string{ argv[1] } == "bench" && std::string{ argv[2] } == "network") {
+        auto options = bench_options(argc, argv);
+        aoc::benchmark_intcode_network(
+            parse_count(options, "--size", 1000), parse_count(options, "--hops", 100), parse_reps(options, 3)
+        );
+        return 0;
+    }
+
+    if (argc >= 3 && std::string{ argv[1] } == "bench") {
+        auto args = parse_bench_args(argc, argv);
+        if (!args) {
+            std::print(
+                "expects 'bench [year] (day) (--reps N) (--json file)'..."
+            );
+            return -1;
+        }
+        return do_benchmark(*args);
+    }
+
+    if (argc >= 2 && (std::string{ argv[1] } == "all" || std::string{ argv[1] } == "year")) {
+        auto args = parse_sweep_args(argc, argv);
+        if (!args) {
+            std::print(
+                "expects 'all' or 'year [year]' with optional '--threads N' and '--timings file'..."
+            );
+            return -1;
+        }
+        return do_sweep(*args);
+    }
+
     if (argc < 3 || argc > 4) {
         std::print(
-            "expects either a year and a day\n",
+            "expects either a year and a day with an optional part\n"
             "or 'create' and a year with an optional number of days\n"
-            "to generate day template .cpp files...\n"
+            "to generate day template .cpp files\n"
+            "or 'bench' and a year with an optional day, '--reps N' and '--json file'\n"
+            "or 2019 and an intcode day with '--dump-cfg' to print its control flow graph\n"
+            "or a year and a day with '--profile' to run it with its interpreters profiled\n"
+            "or 'test' to check the engines' fast paths against their reference paths\n"
+            "or 'all' or 'year' and a year to run many days in parallel...\n"
         );
         return -1;
     }
@@ -130,6 +446,24 @@ int main(int argc, char* argv[]) {
         return -1;
     }
 
-    do_advent_of_code(std::stoi(year_str), day);
+    if (argc == 4 && std::string{ argv[3] } == "--dump-cfg") {
+        return dump_intcode_cfg(std::stoi(year_str), day);
+    }
+
+    if (argc == 4 && std::string{ argv[3] } == "--profile") {
+        return profile_day(std::stoi(year_str), day);
+    }
+
+    std::optional<int> part;
+    if (argc == 4) {
+        std::string part_str = argv[3];
+        if (part_str != "1" && part_str != "2") {
+            std::print("invalid part: {0}\n", part_str);
+            return -1;
+        }
+        part = std::stoi(part_str);
+    }
+
+    do_advent_of_code(std::stoi(year_str), day, part);
     return 0;
 }
\ No newline at end of file
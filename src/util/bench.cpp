@@ -0,0 +1,404 @@
+#include "bench.h"
+#include "numbers.h"
+#include "util.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <format>
+#include <print>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <tuple>
+
+#ifdef WIN32
+#include <windows.h>
+#include <psapi.h>
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace r = std::ranges;
+namespace rv = std::ranges::views;
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    struct cpu_times {
+        double user_ms;
+        double sys_ms;
+    };
+
+    struct sample {
+        double wall_ms;
+        double user_ms;
+        double sys_ms;
+        int64_t peak_rss_kb;
+    };
+
+#ifdef WIN32
+
+    double filetime_to_ms(const FILETIME& ft) {
+        ULARGE_INTEGER li;
+        li.LowPart = ft.dwLowDateTime;
+        li.HighPart = ft.dwHighDateTime;
+        return static_cast<double>(li.QuadPart) / 10000.0;
+    }
+
+    cpu_times get_cpu_times() {
+        FILETIME creation, exit, kernel, user;
+        GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+        return { filetime_to_ms(user), filetime_to_ms(kernel) };
+    }
+
+    void reset_peak_rss() {
+        // the working set high-water mark cannot be reset on Windows...
+    }
+
+    int64_t peak_rss_kb() {
+        PROCESS_MEMORY_COUNTERS pmc;
+        GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
+        return static_cast<int64_t>(pmc.PeakWorkingSetSize / 1024);
+    }
+
+    constexpr auto k_null_device = "NUL";
+    int dup_fd(int fd) { return _dup(fd); }
+    void dup2_fd(int from, int to) { _dup2(from, to); }
+    int open_null() { return _open(k_null_device, _O_WRONLY); }
+    void close_fd(int fd) { _close(fd); }
+
+#else
+
+    double timeval_to_ms(const timeval& tv) {
+        return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+    }
+
+    cpu_times get_cpu_times() {
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return { timeval_to_ms(usage.ru_utime), timeval_to_ms(usage.ru_stime) };
+    }
+
+    // On Linux writing "5" to clear_refs resets the VmHWM high-water mark so that
+    // each repetition reports its own peak rather than the peak of the process.
+
+    void reset_peak_rss() {
+        std::ofstream clear_refs("/proc/self/clear_refs");
+        if (clear_refs) {
+            clear_refs << "5";
+        }
+    }
+
+    int64_t peak_rss_kb() {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.starts_with("VmHWM:")) {
+                std::stringstream ss(line.substr(6));
+                int64_t kb = 0;
+                ss >> kb;
+                return kb;
+            }
+        }
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return static_cast<int64_t>(usage.ru_maxrss);
+    }
+
+    constexpr auto k_null_device = "/dev/null";
+    int dup_fd(int fd) { return dup(fd); }
+    void dup2_fd(int from, int to) { dup2(from, to); }
+    int open_null() { return open(k_null_device, O_WRONLY); }
+    void close_fd(int fd) { close(fd); }
+
+#endif
+
+    // a few solvers still write to stdout as a side effect so stdout is pointed at
+    // the null device while they are being timed.
+
+    class stdout_silencer {
+        int saved_;
+
+    public:
+        stdout_silencer() {
+            std::fflush(stdout);
+            saved_ = dup_fd(1);
+            auto null_fd = open_null();
+            dup2_fd(null_fd, 1);
+            close_fd(null_fd);
+        }
+
+        ~stdout_silencer() {
+            std::fflush(stdout);
+            dup2_fd(saved_, 1);
+            close_fd(saved_);
+        }
+    };
+
+    sample time_one_run(const std::function<void()>& run) {
+        reset_peak_rss();
+        auto cpu_start = get_cpu_times();
+        auto start = std::chrono::steady_clock::now();
+
+        run();
+
+        auto end = std::chrono::steady_clock::now();
+        auto cpu_end = get_cpu_times();
+        return {
+            std::chrono::duration<double, std::milli>(end - start).count(),
+            cpu_end.user_ms - cpu_start.user_ms,
+            cpu_end.sys_ms - cpu_start.sys_ms,
+            peak_rss_kb()
+        };
+    }
+
+    double percentile(const std::vector<double>& sorted, double p) {
+        auto n = static_cast<int>(sorted.size());
+        auto index = static_cast<int>(std::ceil(p * n)) - 1;
+        return sorted[std::clamp(index, 0, n - 1)];
+    }
+
+    aoc::bench_stats summarize(const std::vector<sample>& samples) {
+        auto wall = samples | rv::transform(&sample::wall_ms) | r::to<std::vector>();
+        r::sort(wall);
+        return {
+            wall.front(),
+            aoc::median(wall),
+            percentile(wall, 0.95),
+            aoc::median(samples | rv::transform(&sample::user_ms) | r::to<std::vector>()),
+            aoc::median(samples | rv::transform(&sample::sys_ms) | r::to<std::vector>()),
+            r::max(samples | rv::transform(&sample::peak_rss_kb))
+        };
+    }
+
+    std::vector<sample> time_phase(int reps, const std::function<void()>& run) {
+        std::vector<sample> samples;
+        stdout_silencer silence;
+        for (int i = 0; i < reps; ++i) {
+            samples.push_back(time_one_run(run));
+        }
+        return samples;
+    }
+
+    // the stringstream-based extract_numbers that the from_chars scanner replaced,
+    // kept as the baseline for benchmark_number_extraction.
+
+    std::vector<int> legacy_extract_numbers(const std::string& str, bool allow_negatives) {
+        std::function<bool(char)> is_digit = (allow_negatives) ?
+            [](char ch)->bool {return std::isdigit(ch) || ch == '-'; } :
+            [](char ch)->bool {return std::isdigit(ch); };
+        auto just_numbers = aoc::collapse_whitespace(str |
+            rv::transform(
+                [is_digit](char ch)->char {
+                    return (is_digit(ch)) ? ch : ' ';
+                }
+            ) | r::to<std::string>()
+        );
+        std::stringstream ss(just_numbers);
+        std::vector<int> numbers;
+        std::string item;
+        while (std::getline(ss, item, ' ')) {
+            if (!item.empty()) {
+                numbers.push_back(std::stoi(item));
+            }
+        }
+        return numbers;
+    }
+
+    // puzzle-like lines ("Sensor at x=-12, y=34: ...") plus some long lines of
+    // comma separated values, with a fixed seed so that runs are comparable.
+
+    std::vector<std::string> synthetic_number_lines(int num_lines) {
+        std::mt19937 gen(2015);
+        std::uniform_int_distribution<int> value(-99999, 99999);
+        std::uniform_int_distribution<int> long_len(50, 500);
+        std::vector<std::string> lines;
+        for (int i = 0; i < num_lines; ++i) {
+            if (i % 10 == 0) {
+                auto n = long_len(gen);
+                std::string line;
+                for (int j = 0; j < n; ++j) {
+                    line += std::format("{}{}", (j > 0) ? "," : "", value(gen));
+                }
+                lines.push_back(std::move(line));
+            } else {
+                lines.push_back(std::format(
+                    "Sensor at x={}, y={}: closest beacon is at x={}, y={}",
+                    value(gen), value(gen), value(gen), value(gen)
+                ));
+            }
+        }
+        return lines;
+    }
+
+    template<typename F>
+    double time_extraction(const std::vector<std::string>& lines, int reps, F extract) {
+        std::vector<double> times;
+        int64_t checksum = 0;
+        for (int i = 0; i < reps; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            for (const auto& line : lines) {
+                checksum += extract(line);
+            }
+            auto end = std::chrono::steady_clock::now();
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        volatile int64_t sink = checksum;
+        (void)sink;
+        return aoc::median(times);
+    }
+
+    // parses once, then times the searching parts of the day; returns the median
+    // time and the parts' answers.
+    std::tuple<double, std::string> time_day_searches(int reps, const std::function<aoc::solver_ptr()>& create,
+            const std::vector<int>& parts) {
+        auto solver = create();
+        solver->parse();
+        std::string answers;
+        auto stats = summarize(time_phase(reps,
+            [&]() {
+                answers.clear();
+                for (auto part : parts) {
+                    answers += (answers.empty() ? "" : " ") +
+                        ((part == 1) ? solver->part_1() : solver->part_2());
+                }
+            }
+        ));
+        return { stats.median_ms, answers };
+    }
+
+}
+
+double aoc::median(std::vector<double> values) {
+    r::sort(values);
+    auto n = values.size();
+    return (n % 2) ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2.0;
+}
+
+// The parse phase is repeated on every repetition; the parts then reuse the input
+// from the last parse so that their timings exclude reading and parsing.
+
+std::vector<aoc::bench_result> aoc::benchmark_days(
+        int year, const std::vector<int>& days, int reps,
+        const day_table& table) {
+
+    std::vector<bench_result> results;
+    for (auto day : days) {
+        auto solver = table[day - 1].create();
+        std::vector<std::tuple<std::string, std::function<void()>>> phases = {
+            {"parse", [&]() { solver->parse(); }},
+            {"part 1", [&]() { solver->part_1(); }},
+            {"part 2", [&]() { solver->part_2(); }}
+        };
+        double total_ms = 0.0;
+        for (const auto& [phase, run] : phases) {
+            results.emplace_back(year, day, phase, reps, summarize(time_phase(reps, run)));
+            total_ms += results.back().stats.median_ms;
+        }
+        std::println(stderr, "  {} day {:2}: {:.3f} ms", year, day, total_ms);
+    }
+    return results;
+}
+
+void aoc::print_bench_table(const std::vector<bench_result>& results) {
+    std::println("{:>4} {:>3} {:>6} {:>5} {:>12} {:>12} {:>12} {:>12} {:>12} {:>12}",
+        "year", "day", "phase", "reps", "min ms", "median ms", "p95 ms", "user ms", "sys ms", "peak KB");
+    for (const auto& res : results) {
+        const auto& s = res.stats;
+        std::println("{:>4} {:>3} {:>6} {:>5} {:>12.3f} {:>12.3f} {:>12.3f} {:>12.3f} {:>12.3f} {:>12}",
+            res.year, res.day, res.phase, res.reps,
+            s.min_ms, s.median_ms, s.p95_ms, s.user_ms, s.sys_ms, s.peak_rss_kb);
+    }
+}
+
+std::string aoc::bench_results_to_json(const std::vector<bench_result>& results) {
+    auto entries = results | rv::transform(
+            [](const bench_result& res) {
+                const auto& s = res.stats;
+                return std::format(
+                    "  {{\"year\": {}, \"day\": {}, \"phase\": \"{}\", \"reps\": {}, \"min_ms\": {:.4f}, "
+                    "\"median_ms\": {:.4f}, \"p95_ms\": {:.4f}, \"user_ms\": {:.4f}, "
+                    "\"sys_ms\": {:.4f}, \"peak_rss_kb\": {}}}",
+                    res.year, res.day, res.phase, res.reps, s.min_ms, s.median_ms, s.p95_ms,
+                    s.user_ms, s.sys_ms, s.peak_rss_kb
+                );
+            }
+        ) | rv::join_with(std::string(",\n")) | r::to<std::string>();
+    return std::format("[\n{}\n]\n", entries);
+}
+
+void aoc::benchmark_number_extraction(int reps) {
+    auto lines = synthetic_number_lines(100000);
+
+    for (const auto& line : lines) {
+        auto expected = legacy_extract_numbers(line, true);
+        auto actual = extract_numbers(line, true);
+        if (expected != actual) {
+            std::println("mismatch on '{}'", line);
+            return;
+        }
+    }
+
+    std::vector<int> buffer;
+    auto legacy_ms = time_extraction(lines, reps,
+        [](const std::string& line) {
+            return legacy_extract_numbers(line, true).size();
+        }
+    );
+    auto vector_ms = time_extraction(lines, reps,
+        [](const std::string& line) {
+            return extract_numbers(line, true).size();
+        }
+    );
+    auto buffer_ms = time_extraction(lines, reps,
+        [&buffer](const std::string& line) {
+            buffer.clear();
+            scan_numbers(line, buffer, true);
+            return buffer.size();
+        }
+    );
+    auto small_vector_ms = time_extraction(lines, reps,
+        [](const std::string& line) {
+            return scan_numbers<int>(line, true).size();
+        }
+    );
+
+    std::println("{:>28} {:>12} {:>8}", "implementation", "median ms", "speedup");
+    for (auto [name, ms] : {
+            std::tuple{"stringstream (old)", legacy_ms},
+            std::tuple{"extract_numbers", vector_ms},
+            std::tuple{"scan_numbers into buffer", buffer_ms},
+            std::tuple{"scan_numbers small_vector", small_vector_ms}}) {
+        std::println("{:>28} {:>12.3f} {:>7.2f}x", name, ms, legacy_ms / ms);
+    }
+}
+
+void aoc::benchmark_priority_queues(const std::vector<queue_bench_day>& days, int reps) {
+    std::println("{:>4} {:>3} {:>26} {:>12} {:>8}  {}", "year", "day", "queue", "median ms", "speedup", "answers");
+    for (const auto& day : days) {
+        double baseline_ms = 0.0;
+        std::string expected;
+        for (auto [name, create] : {
+                std::tuple{ "multimap_priority_queue", &queue_bench_day::multimap },
+                std::tuple{ "indexed_4ary_heap", &queue_bench_day::dary },
+                std::tuple{ "radix_heap", &queue_bench_day::radix }}) {
+            if (!(day.*create)) {
+                continue;
+            }
+            auto [ms, answers] = time_day_searches(reps, day.*create, day.parts);
+            if (baseline_ms == 0.0) {
+                baseline_ms = ms;
+                expected = answers;
+            }
+            std::println("{:>4} {:>3} {:>26} {:>12.3f} {:>7.2f}x  {}{}", day.year, day.day, name, ms,
+                baseline_ms / ms, answers, (answers == expected) ? "" : " (mismatch)");
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include "solver.h"
+
+namespace aoc {
+
+    struct bench_stats {
+        double min_ms;
+        double median_ms;
+        double p95_ms;
+        double user_ms;
+        double sys_ms;
+        int64_t peak_rss_kb;
+    };
+
+    struct bench_result {
+        int year;
+        int day;
+        std::string phase;
+        int reps;
+        bench_stats stats;
+    };
+
+    std::vector<bench_result> benchmark_days(
+        int year, const std::vector<int>& days, int reps,
+        const day_table& table);
+
+    void print_bench_table(const std::vector<bench_result>& results);
+    std::string bench_results_to_json(const std::vector<bench_result>& results);
+
+    // compares the from_chars number scanner against the old stringstream extraction
+    void benchmark_number_extraction(int reps);
+
+    // a day whose searches use aoc::priority_queue, as its solver on each of the
+    // queue implementations, and the parts that run those searches. radix is
+    // empty for a day whose priorities can be negative.
+    struct queue_bench_day {
+        int year;
+        int day;
+        std::vector<int> parts;
+        std::function<solver_ptr()> multimap;
+        std::function<solver_ptr()> dary;
+        std::function<solver_ptr()> radix;
+    };
+
+    // times the searching parts of the days, on their inputs, with each of the
+    // priority queue implementations
+    void benchmark_priority_queues(const std::vector<queue_bench_day>& days, int reps);
+
+    double median(std::vector<double> values);
+
+    // the median wall time in milliseconds of reps calls to run, and what the
+    // last of them returned; for the benchmarks of single engines.
+    template<typename F>
+    auto time_median(int reps, F run) {
+        std::vector<double> times;
+        std::invoke_result_t<F&> result{};
+        for (int i = 0; i < reps; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            result = run();
+            auto end = std::chrono::steady_clock::now();
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return std::tuple{ median(times), result };
+    }
+}
@@ -0,0 +1,503 @@
+#pragma once
+
+#include "vec2.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+    // Point containers for grids whose extent is known up front. The rectangle
+    // [min, max] (inclusive) is laid out row-major, so a point's slot is a bit of a
+    // bitset (dense_point_set) or an element of a flat array (dense_point_map) and a
+    // lookup is one subtraction, one multiply and one load. Negative coordinates
+    // just need a negative min.
+    //
+    // The interface follows vec2_set / vec2_map. Lookups of points outside the
+    // bounds report them as absent; inserting one throws std::out_of_range.
+    // Iteration is in row-major order; the set yields its points by value.
+
+    namespace detail {
+
+        class dense_grid_layout {
+        public:
+            dense_grid_layout() : min_{ 0,0 }, wd_(0), hgt_(0)
+            {}
+
+            dense_grid_layout(const vec2<int>& min, const vec2<int>& max) :
+                min_(min),
+                wd_(std::max(max.x - min.x + 1, 0)),
+                hgt_(std::max(max.y - min.y + 1, 0))
+            {}
+
+            bool in_bounds(const vec2<int>& pt) const {
+                return pt.x >= min_.x && pt.y >= min_.y &&
+                    pt.x < min_.x + wd_ && pt.y < min_.y + hgt_;
+            }
+
+            vec2<int> min() const {
+                return min_;
+            }
+
+            vec2<int> max() const {
+                return { min_.x + wd_ - 1, min_.y + hgt_ - 1 };
+            }
+
+            int width() const {
+                return wd_;
+            }
+
+            int height() const {
+                return hgt_;
+            }
+
+        protected:
+            vec2<int> min_;
+            int wd_;
+            int hgt_;
+
+            size_t area() const {
+                return static_cast<size_t>(wd_) * static_cast<size_t>(hgt_);
+            }
+
+            size_t index_of(const vec2<int>& pt) const {
+                return static_cast<size_t>(pt.y - min_.y) * wd_ + static_cast<size_t>(pt.x - min_.x);
+            }
+
+            vec2<int> point_at(size_t index) const {
+                return {
+                    min_.x + static_cast<int>(index % wd_),
+                    min_.y + static_cast<int>(index / wd_)
+                };
+            }
+
+            size_t checked_index(const vec2<int>& pt) const {
+                if (!in_bounds(pt)) {
+                    throw std::out_of_range("point outside of dense container bounds");
+                }
+                return index_of(pt);
+            }
+        };
+
+        class dense_bitset {
+            std::vector<uint64_t> words_;
+
+        public:
+            dense_bitset() = default;
+
+            explicit dense_bitset(size_t n) : words_((n + 63) / 64, 0)
+            {}
+
+            bool test(size_t i) const {
+                return (words_[i / 64] >> (i % 64)) & 1;
+            }
+
+            void set(size_t i) {
+                words_[i / 64] |= uint64_t{ 1 } << (i % 64);
+            }
+
+            void reset(size_t i) {
+                words_[i / 64] &= ~(uint64_t{ 1 } << (i % 64));
+            }
+
+            void clear() {
+                std::fill(words_.begin(), words_.end(), 0);
+            }
+
+            // index of the first set bit at or after i, or n if there is none.
+            size_t next(size_t i, size_t n) const {
+                if (i >= n) {
+                    return n;
+                }
+                auto word = i / 64;
+                auto bits = words_[word] & (~uint64_t{ 0 } << (i % 64));
+                while (bits == 0) {
+                    if (++word == words_.size()) {
+                        return n;
+                    }
+                    bits = words_[word];
+                }
+                return std::min(word * 64 + std::countr_zero(bits), n);
+            }
+
+            bool operator==(const dense_bitset&) const = default;
+        };
+    }
+
+    class dense_point_set : public detail::dense_grid_layout {
+        detail::dense_bitset bits_;
+        size_t size_;
+
+    public:
+        using key_type = vec2<int>;
+        using value_type = vec2<int>;
+        using size_type = size_t;
+
+        class iterator {
+            friend class dense_point_set;
+
+            const dense_point_set* set_;
+            size_t index_;
+
+            iterator(const dense_point_set* set, size_t index) :
+                set_(set), index_(index)
+            {}
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = vec2<int>;
+            using difference_type = std::ptrdiff_t;
+            using reference = vec2<int>;
+
+            iterator() : set_(nullptr), index_(0) {}
+
+            vec2<int> operator*() const {
+                return set_->point_at(index_);
+            }
+
+            iterator& operator++() {
+                index_ = set_->bits_.next(index_ + 1, set_->area());
+                return *this;
+            }
+
+            iterator operator++(int) {
+                auto temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            bool operator==(const iterator& other) const {
+                return index_ == other.index_;
+            }
+        };
+
+        using const_iterator = iterator;
+
+        dense_point_set() : size_(0)
+        {}
+
+        dense_point_set(const vec2<int>& min, const vec2<int>& max) :
+            dense_grid_layout(min, max), bits_(area()), size_(0)
+        {}
+
+        // the grid [0, wd) x [0, hgt).
+        dense_point_set(int wd, int hgt) :
+            dense_point_set(vec2<int>{ 0,0 }, vec2<int>{ wd - 1, hgt - 1 })
+        {}
+
+        iterator begin() const {
+            return { this, bits_.next(0, area()) };
+        }
+
+        iterator end() const {
+            return { this, area() };
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        void clear() {
+            bits_.clear();
+            size_ = 0;
+        }
+
+        void reserve(size_t) {}
+
+        bool contains(const vec2<int>& pt) const {
+            return in_bounds(pt) && bits_.test(index_of(pt));
+        }
+
+        size_t count(const vec2<int>& pt) const {
+            return contains(pt) ? 1 : 0;
+        }
+
+        iterator find(const vec2<int>& pt) const {
+            return contains(pt) ? iterator{ this, index_of(pt) } : end();
+        }
+
+        std::pair<iterator, bool> insert(const vec2<int>& pt) {
+            auto index = checked_index(pt);
+            if (bits_.test(index)) {
+                return { iterator{ this, index }, false };
+            }
+            bits_.set(index);
+            ++size_;
+            return { iterator{ this, index }, true };
+        }
+
+        iterator insert(const_iterator, const vec2<int>& pt) {
+            return insert(pt).first;
+        }
+
+        template<typename InputIt>
+        void insert(InputIt first, InputIt last) {
+            for (; first != last; ++first) {
+                insert(*first);
+            }
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args) {
+            return insert(vec2<int>{ std::forward<Args>(args)... });
+        }
+
+        size_t erase(const vec2<int>& pt) {
+            if (!contains(pt)) {
+                return 0;
+            }
+            bits_.reset(index_of(pt));
+            --size_;
+            return 1;
+        }
+
+        iterator erase(const_iterator pos) {
+            auto next = std::next(pos);
+            bits_.reset(pos.index_);
+            --size_;
+            return next;
+        }
+
+        bool operator==(const dense_point_set& other) const {
+            return min_ == other.min_ && wd_ == other.wd_ && hgt_ == other.hgt_ &&
+                bits_ == other.bits_;
+        }
+    };
+
+    template<typename T>
+    class dense_point_map : public detail::dense_grid_layout {
+    public:
+        using key_type = vec2<int>;
+        using mapped_type = T;
+        using value_type = std::pair<const vec2<int>, T>;
+        using size_type = size_t;
+
+    private:
+        std::vector<value_type> slots_;
+        detail::dense_bitset occupied_;
+        size_t size_;
+
+        template<bool Const>
+        class basic_iterator {
+            friend class dense_point_map;
+            using map_ptr = std::conditional_t<Const, const dense_point_map*, dense_point_map*>;
+
+            map_ptr map_;
+            size_t index_;
+
+            basic_iterator(map_ptr map, size_t index) :
+                map_(map), index_(index)
+            {}
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = dense_point_map::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+            using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+            basic_iterator() : map_(nullptr), index_(0) {}
+
+            template<bool C = Const, typename = std::enable_if_t<C>>
+            basic_iterator(const basic_iterator<false>& other) :
+                map_(other.map_), index_(other.index_)
+            {}
+
+            reference operator*() const {
+                return map_->slots_[index_];
+            }
+
+            pointer operator->() const {
+                return &map_->slots_[index_];
+            }
+
+            basic_iterator& operator++() {
+                index_ = map_->occupied_.next(index_ + 1, map_->area());
+                return *this;
+            }
+
+            basic_iterator operator++(int) {
+                auto temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            bool operator==(const basic_iterator& other) const {
+                return index_ == other.index_;
+            }
+
+            friend class basic_iterator<!Const>;
+        };
+
+        void reset_slot(size_t index) {
+            slots_[index].second = T{};
+        }
+
+    public:
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        dense_point_map() : size_(0)
+        {}
+
+        // every slot holds its point alongside the value so that iteration can
+        // hand out references to std::pair<const vec2<int>, T> like vec2_map.
+        dense_point_map(const vec2<int>& min, const vec2<int>& max) :
+                dense_grid_layout(min, max), occupied_(area()), size_(0) {
+            slots_.reserve(area());
+            for (size_t i = 0; i < area(); ++i) {
+                slots_.emplace_back(point_at(i), T{});
+            }
+        }
+
+        // the grid [0, wd) x [0, hgt).
+        dense_point_map(int wd, int hgt) :
+            dense_point_map(vec2<int>{ 0,0 }, vec2<int>{ wd - 1, hgt - 1 })
+        {}
+
+        dense_point_map(const dense_point_map&) = default;
+        dense_point_map(dense_point_map&&) noexcept = default;
+
+        dense_point_map& operator=(const dense_point_map& other) {
+            if (this != &other) {
+                dense_point_map copy(other);
+                *this = std::move(copy);
+            }
+            return *this;
+        }
+
+        dense_point_map& operator=(dense_point_map&&) noexcept = default;
+
+        iterator begin() {
+            return { this, occupied_.next(0, area()) };
+        }
+
+        iterator end() {
+            return { this, area() };
+        }
+
+        const_iterator begin() const {
+            return { this, occupied_.next(0, area()) };
+        }
+
+        const_iterator end() const {
+            return { this, area() };
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        void clear() {
+            for (auto i = occupied_.next(0, area()); i < area(); i = occupied_.next(i + 1, area())) {
+                reset_slot(i);
+            }
+            occupied_.clear();
+            size_ = 0;
+        }
+
+        void reserve(size_t) {}
+
+        bool contains(const vec2<int>& pt) const {
+            return in_bounds(pt) && occupied_.test(index_of(pt));
+        }
+
+        size_t count(const vec2<int>& pt) const {
+            return contains(pt) ? 1 : 0;
+        }
+
+        iterator find(const vec2<int>& pt) {
+            return contains(pt) ? iterator{ this, index_of(pt) } : end();
+        }
+
+        const_iterator find(const vec2<int>& pt) const {
+            return contains(pt) ? const_iterator{ this, index_of(pt) } : end();
+        }
+
+        T& at(const vec2<int>& pt) {
+            if (!contains(pt)) {
+                throw std::out_of_range("dense_point_map::at");
+            }
+            return slots_[index_of(pt)].second;
+        }
+
+        const T& at(const vec2<int>& pt) const {
+            if (!contains(pt)) {
+                throw std::out_of_range("dense_point_map::at");
+            }
+            return slots_[index_of(pt)].second;
+        }
+
+        T& operator[](const vec2<int>& pt) {
+            return try_emplace(pt).first->second;
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(const vec2<int>& pt, Args&&... args) {
+            auto index = checked_index(pt);
+            if (occupied_.test(index)) {
+                return { iterator{ this, index }, false };
+            }
+            if constexpr (sizeof...(Args) > 0) {
+                slots_[index].second = T(std::forward<Args>(args)...);
+            }
+            occupied_.set(index);
+            ++size_;
+            return { iterator{ this, index }, true };
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(const vec2<int>& pt, Args&&... args) {
+            return try_emplace(pt, std::forward<Args>(args)...);
+        }
+
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(const vec2<int>& pt, M&& obj) {
+            auto result = try_emplace(pt);
+            result.first->second = std::forward<M>(obj);
+            return result;
+        }
+
+        template<typename P>
+        std::pair<iterator, bool> insert(P&& item) {
+            return try_emplace(item.first, std::forward<P>(item).second);
+        }
+
+        template<typename P>
+        iterator insert(const_iterator, P&& item) {
+            return insert(std::forward<P>(item)).first;
+        }
+
+        size_t erase(const vec2<int>& pt) {
+            if (!contains(pt)) {
+                return 0;
+            }
+            erase(find(pt));
+            return 1;
+        }
+
+        iterator erase(const_iterator pos) {
+            auto index = pos.index_;
+            occupied_.reset(index);
+            reset_slot(index);
+            --size_;
+            return { this, occupied_.next(index + 1, area()) };
+        }
+    };
+
+}
@@ -0,0 +1,520 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aoc {
+
+    // Open-addressing hash tables with the elements stored inline in one array
+    // and a parallel array of one-byte control codes (empty, deleted, or seven
+    // bits of the element's hash). Lookups probe linearly through the control
+    // bytes and only touch an element when its control byte matches, so a probe
+    // is a short walk through contiguous memory rather than a chain of pointers.
+    //
+    // Capacity is a power of two and the table grows at 7/8 load. Unlike the std
+    // unordered containers, any insertion may invalidate references and iterators
+    // to existing elements.
+
+    namespace detail {
+
+        constexpr int8_t k_empty = -128;
+        constexpr int8_t k_deleted = -2;
+
+        struct set_key {
+            template<typename V>
+            const V& operator()(const V& v) const {
+                return v;
+            }
+        };
+
+        struct map_key {
+            template<typename V>
+            const auto& operator()(const V& v) const {
+                return v.first;
+            }
+        };
+
+        template<typename Key, typename Value, typename KeyOf, typename Hash, typename Eq>
+        class flat_table {
+        public:
+            using key_type = Key;
+            using value_type = Value;
+            using size_type = size_t;
+            using difference_type = std::ptrdiff_t;
+            using hasher = Hash;
+            using key_equal = Eq;
+
+        private:
+            struct iterator_tag {
+                explicit iterator_tag() = default;
+            };
+
+        public:
+            template<bool Const>
+            class basic_iterator {
+                friend class flat_table;
+                using table_ptr = std::conditional_t<Const, const flat_table*, flat_table*>;
+
+                table_ptr table_;
+                size_t index_;
+
+                void skip_to_full() {
+                    while (index_ < table_->capacity_ && table_->ctrl_[index_] < 0) {
+                        ++index_;
+                    }
+                }
+
+            public:
+                using iterator_concept = std::forward_iterator_tag;
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Value;
+                using difference_type = std::ptrdiff_t;
+                using pointer = std::conditional_t<Const, const Value*, Value*>;
+                using reference = std::conditional_t<Const, const Value&, Value&>;
+
+                basic_iterator() : table_(nullptr), index_(0) {}
+
+                basic_iterator(table_ptr table, size_t index, iterator_tag) :
+                        table_(table), index_(index) {
+                    skip_to_full();
+                }
+
+                template<bool C = Const, typename = std::enable_if_t<C>>
+                basic_iterator(const basic_iterator<false>& other) :
+                    table_(other.table_), index_(other.index_)
+                {}
+
+                reference operator*() const {
+                    return table_->slots_[index_];
+                }
+
+                pointer operator->() const {
+                    return table_->slots_ + index_;
+                }
+
+                basic_iterator& operator++() {
+                    ++index_;
+                    skip_to_full();
+                    return *this;
+                }
+
+                basic_iterator operator++(int) {
+                    auto temp = *this;
+                    ++(*this);
+                    return temp;
+                }
+
+                bool operator==(const basic_iterator& other) const {
+                    return index_ == other.index_;
+                }
+
+                friend class basic_iterator<!Const>;
+            };
+
+            using iterator = basic_iterator<false>;
+            using const_iterator = basic_iterator<true>;
+
+            flat_table() :
+                ctrl_(nullptr), slots_(nullptr), capacity_(0), shift_(64), size_(0), deleted_(0)
+            {}
+
+            flat_table(std::initializer_list<Value> values) : flat_table() {
+                insert(values.begin(), values.end());
+            }
+
+            template<typename InputIt>
+            flat_table(InputIt first, InputIt last) : flat_table() {
+                insert(first, last);
+            }
+
+            flat_table(const flat_table& other) : flat_table() {
+                reserve(other.size_);
+                for (const auto& v : other) {
+                    insert(v);
+                }
+            }
+
+            flat_table(flat_table&& other) noexcept : flat_table() {
+                swap(other);
+            }
+
+            flat_table& operator=(const flat_table& other) {
+                if (this != &other) {
+                    flat_table copy(other);
+                    swap(copy);
+                }
+                return *this;
+            }
+
+            flat_table& operator=(flat_table&& other) noexcept {
+                if (this != &other) {
+                    destroy();
+                    swap(other);
+                }
+                return *this;
+            }
+
+            ~flat_table() {
+                destroy();
+            }
+
+            void swap(flat_table& other) noexcept {
+                std::swap(ctrl_, other.ctrl_);
+                std::swap(slots_, other.slots_);
+                std::swap(capacity_, other.capacity_);
+                std::swap(shift_, other.shift_);
+                std::swap(size_, other.size_);
+                std::swap(deleted_, other.deleted_);
+            }
+
+            iterator begin() { return iterator(this, 0, iterator_tag{}); }
+            iterator end() { return iterator(this, capacity_, iterator_tag{}); }
+            const_iterator begin() const { return const_iterator(this, 0, iterator_tag{}); }
+            const_iterator end() const { return const_iterator(this, capacity_, iterator_tag{}); }
+            const_iterator cbegin() const { return begin(); }
+            const_iterator cend() const { return end(); }
+
+            size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            size_t capacity() const { return capacity_; }
+            size_t max_size() const { return size_t{ 1 } << 58; }
+
+            void clear() {
+                destroy_elements();
+                if (ctrl_) {
+                    std::fill(ctrl_, ctrl_ + capacity_, k_empty);
+                }
+                size_ = 0;
+                deleted_ = 0;
+            }
+
+            void reserve(size_t n) {
+                auto needed = std::bit_ceil(std::max<size_t>(16, n + n / 7 + 1));
+                if (needed > capacity_) {
+                    rehash(needed);
+                }
+            }
+
+            iterator find(const Key& key) {
+                auto index = find_index(key);
+                return iterator(this, (index < 0) ? capacity_ : index, iterator_tag{});
+            }
+
+            const_iterator find(const Key& key) const {
+                auto index = find_index(key);
+                return const_iterator(this, (index < 0) ? capacity_ : index, iterator_tag{});
+            }
+
+            bool contains(const Key& key) const {
+                return find_index(key) >= 0;
+            }
+
+            size_t count(const Key& key) const {
+                return contains(key) ? 1 : 0;
+            }
+
+            std::pair<iterator, bool> insert(const Value& value) {
+                return emplace_with_key(KeyOf{}(value), value);
+            }
+
+            std::pair<iterator, bool> insert(Value&& value) {
+                const auto& key = KeyOf{}(value);
+                return emplace_with_key(key, std::move(value));
+            }
+
+            iterator insert(const_iterator, const Value& value) {
+                return insert(value).first;
+            }
+
+            iterator insert(const_iterator, Value&& value) {
+                return insert(std::move(value)).first;
+            }
+
+            template<typename InputIt>
+            void insert(InputIt first, InputIt last) {
+                for (; first != last; ++first) {
+                    insert(*first);
+                }
+            }
+
+            void insert(std::initializer_list<Value> values) {
+                insert(values.begin(), values.end());
+            }
+
+            template<typename... Args>
+            std::pair<iterator, bool> emplace(Args&&... args) {
+                Value value(std::forward<Args>(args)...);
+                return insert(std::move(value));
+            }
+
+            size_t erase(const Key& key) {
+                auto index = find_index(key);
+                if (index < 0) {
+                    return 0;
+                }
+                erase_index(index);
+                return 1;
+            }
+
+            iterator erase(const_iterator pos) {
+                erase_index(pos.index_);
+                return iterator(this, pos.index_ + 1, iterator_tag{});
+            }
+
+            iterator erase(iterator pos) {
+                return erase(const_iterator(pos));
+            }
+
+            hasher hash_function() const { return Hash{}; }
+            key_equal key_eq() const { return Eq{}; }
+
+        protected:
+            int8_t* ctrl_;
+            Value* slots_;
+            size_t capacity_;
+            int shift_;
+            size_t size_;
+            size_t deleted_;
+
+            // the index comes from the top bits of a Fibonacci multiply of the hash
+            // and the control code from its low seven bits, so a weak hash still
+            // spreads over the table.
+
+            size_t home_index(size_t hash) const {
+                return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15ull) >> shift_);
+            }
+
+            static int8_t control_code(size_t hash) {
+                return static_cast<int8_t>(hash & 0x7f);
+            }
+
+            std::ptrdiff_t find_index(const Key& key) const {
+                if (size_ == 0) {
+                    return -1;
+                }
+                auto hash = Hash{}(key);
+                auto code = control_code(hash);
+                auto mask = capacity_ - 1;
+                for (auto i = home_index(hash); ; i = (i + 1) & mask) {
+                    auto ctrl = ctrl_[i];
+                    if (ctrl == code && Eq{}(KeyOf{}(slots_[i]), key)) {
+                        return static_cast<std::ptrdiff_t>(i);
+                    }
+                    if (ctrl == k_empty) {
+                        return -1;
+                    }
+                }
+            }
+
+            template<typename K, typename... Args>
+            std::pair<iterator, bool> emplace_with_key(const K& key, Args&&... args) {
+                if ((size_ + deleted_ + 1) * 8 > capacity_ * 7) {
+                    grow();
+                }
+                auto hash = Hash{}(key);
+                auto code = control_code(hash);
+                auto mask = capacity_ - 1;
+                std::ptrdiff_t target = -1;
+                for (auto i = home_index(hash); ; i = (i + 1) & mask) {
+                    auto ctrl = ctrl_[i];
+                    if (ctrl == code && Eq{}(KeyOf{}(slots_[i]), key)) {
+                        return { iterator(this, i, iterator_tag{}), false };
+                    }
+                    if (ctrl == k_deleted && target < 0) {
+                        target = static_cast<std::ptrdiff_t>(i);
+                    }
+                    if (ctrl == k_empty) {
+                        if (target < 0) {
+                            target = static_cast<std::ptrdiff_t>(i);
+                        }
+                        break;
+                    }
+                }
+                std::construct_at(slots_ + target, std::forward<Args>(args)...);
+                if (ctrl_[target] == k_deleted) {
+                    --deleted_;
+                }
+                ctrl_[target] = code;
+                ++size_;
+                return { iterator(this, target, iterator_tag{}), true };
+            }
+
+            // a slot can go straight back to empty when the next slot is empty,
+            // since no probe sequence can run through it; otherwise it becomes a
+            // tombstone until the next rehash.
+
+            void erase_index(size_t index) {
+                std::destroy_at(slots_ + index);
+                if (ctrl_[(index + 1) & (capacity_ - 1)] == k_empty) {
+                    ctrl_[index] = k_empty;
+                } else {
+                    ctrl_[index] = k_deleted;
+                    ++deleted_;
+                }
+                --size_;
+            }
+
+            void grow() {
+                if (capacity_ == 0) {
+                    rehash(16);
+                } else if (deleted_ > size_ / 2) {
+                    rehash(capacity_);
+                } else {
+                    rehash(capacity_ * 2);
+                }
+            }
+
+            void rehash(size_t new_capacity) {
+                auto old_ctrl = ctrl_;
+                auto old_slots = slots_;
+                auto old_capacity = capacity_;
+
+                ctrl_ = new int8_t[new_capacity];
+                std::fill(ctrl_, ctrl_ + new_capacity, k_empty);
+                slots_ = std::allocator<Value>{}.allocate(new_capacity);
+                capacity_ = new_capacity;
+                shift_ = 64 - std::countr_zero(new_capacity);
+                deleted_ = 0;
+
+                auto mask = capacity_ - 1;
+                for (size_t i = 0; i < old_capacity; ++i) {
+                    if (old_ctrl[i] < 0) {
+                        continue;
+                    }
+                    auto hash = Hash{}(KeyOf{}(old_slots[i]));
+                    auto j = home_index(hash);
+                    while (ctrl_[j] != k_empty) {
+                        j = (j + 1) & mask;
+                    }
+                    std::construct_at(slots_ + j, std::move(old_slots[i]));
+                    std::destroy_at(old_slots + i);
+                    ctrl_[j] = old_ctrl[i];
+                }
+
+                if (old_ctrl) {
+                    delete[] old_ctrl;
+                    std::allocator<Value>{}.deallocate(old_slots, old_capacity);
+                }
+            }
+
+            void destroy_elements() {
+                if constexpr (!std::is_trivially_destructible_v<Value>) {
+                    for (size_t i = 0; i < capacity_; ++i) {
+                        if (ctrl_[i] >= 0) {
+                            std::destroy_at(slots_ + i);
+                        }
+                    }
+                }
+            }
+
+            void destroy() {
+                if (!ctrl_) {
+                    return;
+                }
+                destroy_elements();
+                delete[] ctrl_;
+                std::allocator<Value>{}.deallocate(slots_, capacity_);
+                ctrl_ = nullptr;
+                slots_ = nullptr;
+                capacity_ = 0;
+                shift_ = 64;
+                size_ = 0;
+                deleted_ = 0;
+            }
+        };
+    }
+
+    template<typename Key, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>>
+    class flat_hash_set : public detail::flat_table<Key, Key, detail::set_key, Hash, Eq> {
+        using base = detail::flat_table<Key, Key, detail::set_key, Hash, Eq>;
+
+    public:
+        using iterator = typename base::const_iterator;
+        using const_iterator = typename base::const_iterator;
+
+        using base::base;
+
+        const_iterator begin() const { return base::begin(); }
+        const_iterator end() const { return base::end(); }
+
+        const_iterator find(const Key& key) const { return base::find(key); }
+
+        bool operator==(const flat_hash_set& other) const {
+            return this->size() == other.size() && std::all_of(
+                begin(), end(),
+                [&](const Key& key) {
+                    return other.contains(key);
+                }
+            );
+        }
+    };
+
+    template<typename Key, typename T, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>>
+    class flat_hash_map :
+            public detail::flat_table<Key, std::pair<const Key, T>, detail::map_key, Hash, Eq> {
+        using base = detail::flat_table<Key, std::pair<const Key, T>, detail::map_key, Hash, Eq>;
+
+    public:
+        using mapped_type = T;
+        using typename base::iterator;
+        using typename base::const_iterator;
+
+        using base::base;
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+            return this->emplace_with_key(
+                key, std::piecewise_construct,
+                std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+        }
+
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+            auto result = try_emplace(key, std::forward<M>(obj));
+            if (!result.second) {
+                result.first->second = std::forward<M>(obj);
+            }
+            return result;
+        }
+
+        T& operator[](const Key& key) {
+            return try_emplace(key).first->second;
+        }
+
+        T& at(const Key& key) {
+            auto iter = this->find(key);
+            if (iter == this->end()) {
+                throw std::out_of_range("flat_hash_map::at");
+            }
+            return iter->second;
+        }
+
+        const T& at(const Key& key) const {
+            auto iter = this->find(key);
+            if (iter == this->end()) {
+                throw std::out_of_range("flat_hash_map::at");
+            }
+            return iter->second;
+        }
+
+        bool operator==(const flat_hash_map& other) const {
+            return this->size() == other.size() && std::all_of(
+                this->begin(), this->end(),
+                [&](const auto& item) {
+                    auto iter = other.find(item.first);
+                    return iter != other.end() && iter->second == item.second;
+                }
+            );
+        }
+    };
+
+}
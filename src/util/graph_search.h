@@ -0,0 +1,486 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/container/small_vector.hpp>
+#include "flat_hash.h"
+#include "grid.h"
+#include "priority_queue.h"
+#include "vec2.h"
+#include "vec3.h"
+
+namespace aoc {
+
+    // A shortest-path engine for the state-space searches that most grid puzzles
+    // come down to. The caller supplies the start state(s), a neighbour function,
+    // and optionally a goal predicate and an A* heuristic:
+    //
+    //     breadth_first_search(start, neighbors, is_goal)    neighbors(s) -> range of S
+    //     dijkstra_search(start, neighbors, is_goal)          neighbors(s) -> range of (S, int)
+    //     a_star_search(start, neighbors, heuristic, is_goal) heuristic must be admissible
+    //
+    // Without a goal the search settles every reachable state and the result is a
+    // distance map; with one it stops once a goal is settled. The Track template
+    // parameter chooses how much is recorded: just distances, one predecessor per
+    // state (for path()), or every predecessor on a shortest path (for the DAG of
+    // all shortest paths; the search then also settles every goal tied for the
+    // best distance).
+    //
+    // The states parameter chooses the storage for per-state data: hashed_states
+    // (the default) keeps it in flat hash maps, indexed_states keeps it in plain
+    // arrays given a function that maps each state to a small integer, e.g.
+    // grid_states(wd, hgt) for vec2<int> locations.
+    //
+    // The Queue template parameter of the weighted searches is one of the queues
+    // of priority_queue.h, indexed_4ary_heap by default. radix_heap needs the
+    // priorities to never drop below the last one extracted, which holds for
+    // Dijkstra with non-negative weights and for A* with a consistent heuristic.
+
+    enum class search_tracking {
+        distances,
+        paths,
+        all_paths
+    };
+
+    struct no_goal {
+        template<typename S>
+        bool operator()(const S&) const {
+            return false;
+        }
+    };
+
+    template<typename S>
+    struct default_state_hash {
+        using type = std::hash<S>;
+    };
+
+    template<typename T>
+    struct default_state_hash<vec2<T>> {
+        using type = hash_vec2<T>;
+    };
+
+    template<typename T>
+    struct default_state_hash<vec3<T>> {
+        using type = hash_vec3<T>;
+    };
+
+    template<typename S, typename H = typename default_state_hash<S>::type>
+    class hashed_states {
+    public:
+        using state_type = S;
+        using hash_type = H;
+
+        template<typename T>
+        class map {
+            flat_hash_map<S, T, H> impl_;
+
+        public:
+            const T* find(const S& s) const {
+                auto iter = impl_.find(s);
+                return (iter != impl_.end()) ? &iter->second : nullptr;
+            }
+
+            T& operator[](const S& s) {
+                return impl_[s];
+            }
+        };
+
+        template<typename T>
+        map<T> make_map() const {
+            return {};
+        }
+    };
+
+    // Index must provide size() and a call operator mapping a state to [0, size()).
+    // H hashes states for the queue of a weighted search.
+    template<typename S, typename Index, typename H = typename default_state_hash<S>::type>
+    class indexed_states {
+        Index index_;
+
+    public:
+        using state_type = S;
+        using hash_type = H;
+
+        explicit indexed_states(Index index) : index_(std::move(index))
+        {}
+
+        template<typename T>
+        class map {
+            Index index_;
+            std::vector<T> values_;
+            std::vector<char> present_;
+
+        public:
+            explicit map(const Index& index) :
+                index_(index), values_(index.size()), present_(index.size(), 0)
+            {}
+
+            const T* find(const S& s) const {
+                auto i = index_(s);
+                return present_[i] ? &values_[i] : nullptr;
+            }
+
+            T& operator[](const S& s) {
+                auto i = index_(s);
+                present_[i] = 1;
+                return values_[i];
+            }
+        };
+
+        template<typename T>
+        map<T> make_map() const {
+            return map<T>(index_);
+        }
+    };
+
+    // row-major indexing of the locations of a wd x hgt grid.
+    struct grid_indexer {
+        int wd;
+        int hgt;
+
+        size_t size() const {
+            return static_cast<size_t>(wd) * static_cast<size_t>(hgt);
+        }
+
+        size_t operator()(const vec2<int>& loc) const {
+            return static_cast<size_t>(loc.y) * wd + static_cast<size_t>(loc.x);
+        }
+    };
+
+    template<typename F>
+    struct state_indexer {
+        size_t count;
+        F fn;
+
+        size_t size() const {
+            return count;
+        }
+
+        template<typename S>
+        size_t operator()(const S& s) const {
+            return fn(s);
+        }
+    };
+
+    inline auto grid_states(int wd, int hgt) {
+        return indexed_states<vec2<int>, grid_indexer>(grid_indexer{ wd, hgt });
+    }
+
+    template<typename T>
+    auto grid_states(const grid<T>& g) {
+        return grid_states(g.columns(), g.rows());
+    }
+
+    // states that map onto [0, size) through fn, e.g. a location plus a direction.
+    template<typename S, typename H = typename default_state_hash<S>::type, typename F>
+    auto indexed_by(size_t size, F fn) {
+        return indexed_states<S, state_indexer<F>, H>(state_indexer<F>{ size, std::move(fn) });
+    }
+
+    template<typename S, typename States, search_tracking Track>
+    class search_result {
+    public:
+        using predecessor_list = boost::container::small_vector<S, 2>;
+
+    private:
+        using dist_map = typename States::template map<int>;
+        using prev_map = typename States::template map<S>;
+        using preds_map = typename States::template map<predecessor_list>;
+        using start_map = typename States::template map<char>;
+        struct no_map {};
+
+        States states_;
+        dist_map dist_;
+        std::conditional_t<Track == search_tracking::paths, prev_map, no_map> prev_;
+        std::conditional_t<Track == search_tracking::all_paths, preds_map, no_map> preds_;
+        std::conditional_t<Track == search_tracking::all_paths, start_map, no_map> starts_;
+        std::vector<S> visited_;
+        std::vector<S> goals_;
+
+        template<search_tracking T, template<typename, typename> typename Q, typename S2, typename St,
+            typename N, typename Hr, typename G>
+        friend search_result<S2, St, T> best_first_search(
+            const std::vector<S2>&, N&, Hr&, G&, const St&);
+
+        template<search_tracking T, typename S2, typename St, typename N, typename G>
+        friend search_result<S2, St, T> unit_cost_search(
+            const std::vector<S2>&, N&, G&, const St&);
+
+        template<typename M, typename T>
+        static M make_tracking_map(const States& states) {
+            if constexpr (std::is_same_v<M, no_map>) {
+                return {};
+            } else {
+                return states.template make_map<T>();
+            }
+        }
+
+        // records that v is reached through u at distance d; returns true when
+        // that improves on the best distance to v so far. A start state keeps no
+        // predecessors, even when an edge of weight 0 reaches it.
+        bool relax(const S& u, const S& v, int d) {
+            auto current = dist_.find(v);
+            if (current && *current < d) {
+                return false;
+            }
+            if (current && *current == d) {
+                if constexpr (Track == search_tracking::all_paths) {
+                    if (!starts_.find(v)) {
+                        preds_[v].push_back(u);
+                    }
+                }
+                return false;
+            }
+            dist_[v] = d;
+            if constexpr (Track == search_tracking::paths) {
+                prev_[v] = u;
+            } else if constexpr (Track == search_tracking::all_paths) {
+                auto& preds = preds_[v];
+                preds.clear();
+                preds.push_back(u);
+            }
+            return true;
+        }
+
+        void add_start(const S& s) {
+            dist_[s] = 0;
+            if constexpr (Track == search_tracking::all_paths) {
+                preds_[s];
+                starts_[s] = 1;
+            }
+        }
+
+    public:
+        explicit search_result(const States& states) :
+            states_(states),
+            dist_(states.template make_map<int>()),
+            prev_(make_tracking_map<decltype(prev_), S>(states)),
+            preds_(make_tracking_map<decltype(preds_), predecessor_list>(states)),
+            starts_(make_tracking_map<decltype(starts_), char>(states))
+        {}
+
+        bool reached(const S& s) const {
+            return dist_.find(s) != nullptr;
+        }
+
+        std::optional<int> distance(const S& s) const {
+            auto d = dist_.find(s);
+            return d ? std::optional<int>(*d) : std::nullopt;
+        }
+
+        // settled states, in the order the search settled them.
+        const std::vector<S>& visited() const {
+            return visited_;
+        }
+
+        const std::vector<S>& goals() const {
+            return goals_;
+        }
+
+        std::optional<S> goal() const {
+            return goals_.empty() ? std::nullopt : std::optional<S>(goals_.front());
+        }
+
+        std::optional<int> goal_distance() const {
+            return goals_.empty() ? std::nullopt : distance(goals_.front());
+        }
+
+        const predecessor_list& predecessors(const S& s) const {
+            static_assert(Track == search_tracking::all_paths, "requires search_tracking::all_paths");
+            static const predecessor_list none;
+            auto preds = preds_.find(s);
+            return preds ? *preds : none;
+        }
+
+        // a shortest path from a start state to target, both included; empty if
+        // target was not reached. The states with no predecessor are the starts:
+        // a state at distance 0 need not be one when edges can weigh 0.
+        std::vector<S> path_to(const S& target) const {
+            static_assert(Track != search_tracking::distances, "requires path tracking");
+            if (!reached(target)) {
+                return {};
+            }
+            std::vector<S> path = { target };
+            for (;;) {
+                const S* prev = nullptr;
+                if constexpr (Track == search_tracking::paths) {
+                    prev = prev_.find(path.back());
+                } else {
+                    const auto& preds = predecessors(path.back());
+                    prev = preds.empty() ? nullptr : &preds.front();
+                }
+                if (!prev) {
+                    break;
+                }
+                path.push_back(*prev);
+            }
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+        std::vector<S> path() const {
+            return goals_.empty() ? std::vector<S>{} : path_to(goals_.front());
+        }
+
+        // every state on some shortest path to one of the targets, i.e. the
+        // states of the shortest-path DAG that can reach them.
+        std::vector<S> shortest_path_states(const std::vector<S>& targets) const {
+            static_assert(Track == search_tracking::all_paths, "requires search_tracking::all_paths");
+            auto seen = states_.template make_map<char>();
+            std::vector<S> found;
+            for (const auto& t : targets) {
+                if (reached(t) && !seen.find(t)) {
+                    seen[t] = 1;
+                    found.push_back(t);
+                }
+            }
+            for (size_t i = 0; i < found.size(); ++i) {
+                for (const auto& pred : predecessors(found[i])) {
+                    if (!seen.find(pred)) {
+                        seen[pred] = 1;
+                        found.push_back(pred);
+                    }
+                }
+            }
+            return found;
+        }
+
+        std::vector<S> shortest_path_states() const {
+            return shortest_path_states(goals_);
+        }
+    };
+
+    // Dijkstra / A* on one of the addressable queues of priority_queue.h, keyed on
+    // the state with the States' hash: a state whose distance improves while it
+    // is queued has its priority changed rather than being queued again.
+    template<search_tracking Track, template<typename, typename> typename Queue, typename S,
+        typename States, typename Neighbors, typename Heuristic, typename Goal>
+    search_result<S, States, Track> best_first_search(
+            const std::vector<S>& starts, Neighbors& neighbors, Heuristic& heuristic,
+            Goal& is_goal, const States& states) {
+
+        search_result<S, States, Track> result(states);
+        Queue<S, typename States::hash_type> queue;
+        for (const auto& s : starts) {
+            if (!result.reached(s)) {
+                result.add_start(s);
+                queue.insert(s, heuristic(s));
+            }
+        }
+
+        std::optional<int> goal_dist;
+        while (!queue.empty()) {
+            auto u = queue.extract_min();
+            auto u_dist = *result.dist_.find(u);
+            if (goal_dist && u_dist + heuristic(u) > *goal_dist) {
+                break;
+            }
+            result.visited_.push_back(u);
+            if (is_goal(u)) {
+                result.goals_.push_back(u);
+                if constexpr (Track != search_tracking::all_paths) {
+                    break;
+                }
+                goal_dist = u_dist;
+                continue;
+            }
+
+            for (auto&& [v, weight] : neighbors(u)) {
+                auto dist = u_dist + static_cast<int>(weight);
+                if (result.relax(u, v, dist)) {
+                    if (queue.contains(v)) {
+                        queue.change_priority(v, dist + heuristic(v));
+                    } else {
+                        queue.insert(v, dist + heuristic(v));
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    // breadth-first search: states are settled in order of discovery.
+    template<search_tracking Track, typename S, typename States, typename Neighbors, typename Goal>
+    search_result<S, States, Track> unit_cost_search(
+            const std::vector<S>& starts, Neighbors& neighbors, Goal& is_goal, const States& states) {
+
+        search_result<S, States, Track> result(states);
+        std::vector<S> frontier;
+        for (const auto& s : starts) {
+            if (!result.reached(s)) {
+                result.add_start(s);
+                frontier.push_back(s);
+            }
+        }
+
+        std::optional<int> goal_dist;
+        for (size_t head = 0; head < frontier.size(); ++head) {
+            auto u = frontier[head];
+            auto dist = *result.dist_.find(u);
+            if (goal_dist && dist > *goal_dist) {
+                break;
+            }
+            result.visited_.push_back(u);
+            if (is_goal(u)) {
+                result.goals_.push_back(u);
+                if constexpr (Track != search_tracking::all_paths) {
+                    break;
+                }
+                goal_dist = dist;
+                continue;
+            }
+            for (auto&& v : neighbors(u)) {
+                if (result.relax(u, v, dist + 1)) {
+                    frontier.push_back(v);
+                }
+            }
+        }
+        return result;
+    }
+
+    template<search_tracking Track = search_tracking::distances, typename S, typename Neighbors,
+        typename Goal = no_goal, typename States = hashed_states<S>>
+    auto breadth_first_search(const std::vector<S>& starts, Neighbors&& neighbors,
+            Goal is_goal = {}, const States& states = {}) {
+        return unit_cost_search<Track>(starts, neighbors, is_goal, states);
+    }
+
+    template<search_tracking Track = search_tracking::distances, typename S, typename Neighbors,
+        typename Goal = no_goal, typename States = hashed_states<S>>
+    auto breadth_first_search(const S& start, Neighbors&& neighbors,
+            Goal is_goal = {}, const States& states = {}) {
+        return unit_cost_search<Track>(std::vector<S>{ start }, neighbors, is_goal, states);
+    }
+
+    template<search_tracking Track = search_tracking::distances,
+        template<typename, typename> typename Queue = indexed_4ary_heap, typename S, typename Neighbors,
+        typename Goal = no_goal, typename States = hashed_states<S>>
+    auto dijkstra_search(const std::vector<S>& starts, Neighbors&& neighbors,
+            Goal is_goal = {}, const States& states = {}) {
+        auto zero = [](const S&) { return 0; };
+        return best_first_search<Track, Queue>(starts, neighbors, zero, is_goal, states);
+    }
+
+    template<search_tracking Track = search_tracking::distances,
+        template<typename, typename> typename Queue = indexed_4ary_heap, typename S, typename Neighbors,
+        typename Goal = no_goal, typename States = hashed_states<S>>
+    auto dijkstra_search(const S& start, Neighbors&& neighbors,
+            Goal is_goal = {}, const States& states = {}) {
+        return dijkstra_search<Track, Queue>(std::vector<S>{ start }, neighbors, is_goal, states);
+    }
+
+    template<search_tracking Track = search_tracking::distances,
+        template<typename, typename> typename Queue = indexed_4ary_heap, typename S, typename Neighbors,
+        typename Heuristic, typename Goal, typename States = hashed_states<S>>
+    auto a_star_search(const S& start, Neighbors&& neighbors, Heuristic heuristic,
+            Goal is_goal, const States& states = {}) {
+        return best_first_search<Track, Queue>(std::vector<S>{ start }, neighbors, heuristic, is_goal,
+            states);
+    }
+
+}
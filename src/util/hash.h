@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace aoc {
+
+    // The murmur3 64-bit finalizer: every input bit affects every output bit, so
+    // the low bits are as good as the high bits when a table masks by a power of two.
+
+    inline uint64_t mix64(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    template<typename T>
+    constexpr bool is_packable_coordinate = std::is_integral_v<T> && sizeof(T) <= 4;
+
+    template<typename T>
+    uint64_t hash_bits(T v) {
+        if constexpr (std::is_integral_v<T>) {
+            return static_cast<uint64_t>(static_cast<std::make_unsigned_t<T>>(v));
+        } else {
+            return std::hash<T>{}(v);
+        }
+    }
+
+    // two coordinates of at most 32 bits share one 64-bit word.
+    template<typename T>
+    uint64_t pack_coordinates(T a, T b) {
+        return (hash_bits(a) << 32) | (hash_bits(b) & 0xffffffffull);
+    }
+
+    inline uint64_t hash_words(uint64_t word) {
+        return mix64(word);
+    }
+
+    template<typename... Words>
+    uint64_t hash_words(uint64_t word, Words... words) {
+        return mix64(word ^ (hash_words(words...) + 0x9e3779b97f4a7c15ull));
+    }
+
+}
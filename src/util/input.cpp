@@ -0,0 +1,151 @@
+#include "input.h"
+#include <stdexcept>
+#include <utility>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    struct mapping {
+        const char* data;
+        size_t size;
+    };
+
+#ifdef WIN32
+
+    mapping map_file(const std::string& filename) {
+        auto file = CreateFileA(
+            filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+        );
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("bad file");
+        }
+
+        LARGE_INTEGER size;
+        GetFileSizeEx(file, &size);
+        if (size.QuadPart == 0) {
+            CloseHandle(file);
+            return { nullptr, 0 };
+        }
+
+        auto file_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!file_mapping) {
+            throw std::runtime_error("bad file");
+        }
+
+        auto view = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(file_mapping);
+        if (!view) {
+            throw std::runtime_error("bad file");
+        }
+        return { static_cast<const char*>(view), static_cast<size_t>(size.QuadPart) };
+    }
+
+    void unmap_file(const mapping& m) {
+        UnmapViewOfFile(m.data);
+    }
+
+#else
+
+    mapping map_file(const std::string& filename) {
+        auto fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("bad file");
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) < 0) {
+            close(fd);
+            throw std::runtime_error("bad file");
+        }
+        if (st.st_size == 0) {
+            close(fd);
+            return { nullptr, 0 };
+        }
+
+        auto size = static_cast<size_t>(st.st_size);
+        auto addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("bad file");
+        }
+        madvise(addr, size, MADV_SEQUENTIAL);
+        return { static_cast<const char*>(addr), size };
+    }
+
+    void unmap_file(const mapping& m) {
+        munmap(const_cast<char*>(m.data), m.size);
+    }
+
+#endif
+
+}
+
+aoc::mapped_file::mapped_file(const std::string& filename) : data_(nullptr), size_(0) {
+    auto [data, size] = map_file(filename);
+    data_ = data;
+    size_ = size;
+}
+
+aoc::mapped_file::~mapped_file() {
+    unmap();
+}
+
+aoc::mapped_file::mapped_file(mapped_file&& other) noexcept :
+        data_(std::exchange(other.data_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {
+}
+
+aoc::mapped_file& aoc::mapped_file::operator=(mapped_file&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+void aoc::mapped_file::unmap() {
+    if (data_) {
+        unmap_file({ data_, size_ });
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+std::string_view aoc::mapped_file::contents() const {
+    return { data_, size_ };
+}
+
+std::vector<std::string_view> aoc::mapped_file::lines() const {
+    return split_lines(contents());
+}
+
+std::vector<std::string_view> aoc::split_lines(std::string_view text) {
+    std::vector<std::string_view> lines;
+    size_t start = 0;
+    while (start < text.size()) {
+        auto end = text.find('\n', start);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        auto line = text.substr(start, end - start);
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
+        }
+        lines.push_back(line);
+        start = end + 1;
+    }
+    return lines;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aoc {
+
+    // A read-only memory mapping of a whole file. contents() and lines() are views
+    // into the mapping, so they are only valid for as long as the mapped_file lives;
+    // nothing is copied and no per-line strings are allocated.
+
+    class mapped_file {
+    public:
+        explicit mapped_file(const std::string& filename);
+        ~mapped_file();
+
+        mapped_file(mapped_file&& other) noexcept;
+        mapped_file& operator=(mapped_file&& other) noexcept;
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        std::string_view contents() const;
+
+        // Splits like std::getline: no empty line is produced for a final newline
+        // and a trailing '\r' is dropped from each line.
+        std::vector<std::string_view> lines() const;
+
+    private:
+        const char* data_;
+        size_t size_;
+
+        void unmap();
+    };
+
+    std::vector<std::string_view> split_lines(std::string_view text);
+
+}
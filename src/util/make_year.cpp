@@ -32,103 +32,92 @@ namespace {
 
 }
 
-void aoc::yYEAR::day_PADDEDDAY(const std::string& title) {
-
-    auto inp = aoc::file_to_string_vector(
-            aoc::input_path(YEAR, DAY)
-        ); 
-
-    std::println("--- Day DAY: {} ---", title);
-    std::println("  part 1: {}", 0);
-    std::println("  part 2: {}", 0);
-    
+aoc::solver_ptr aoc::yYEAR::day_PADDEDDAY() {
+    return aoc::make_solver(
+        []() {
+            return aoc::file_to_string_vector(
+                aoc::input_path(YEAR, DAY)
+            );
+        },
+        [](const auto& inp) {
+            return 0;
+        },
+        [](const auto& inp) {
+            return 0;
+        }
+    );
 }
 )";
 
     constexpr auto k_year_cpp = R"(
 #include "yYEAR.h"
-#include <vector>
-#include <functional>
-#include <print>
 
-void aoc::yYEAR::do_advent_of_code(int day) {
-    const static auto advent_of_code_YEAR = std::vector<std::function<void()>>{
-        []() { day_01( "<unknown>" ); },
-        []() { day_02( "<unknown>" ); },
-        []() { day_03( "<unknown>" ); },
-        []() { day_04( "<unknown>" ); },
-        []() { day_05( "<unknown>" ); },
-        []() { day_06( "<unknown>" ); },
-        []() { day_07( "<unknown>" ); },
-        []() { day_08( "<unknown>" ); },
-        []() { day_09( "<unknown>" ); },
-        []() { day_10( "<unknown>" ); },
-        []() { day_11( "<unknown>" ); },
-        []() { day_12( "<unknown>" ); },
-        []() { day_13( "<unknown>" ); },
-        []() { day_14( "<unknown>" ); },
-        []() { day_15( "<unknown>" ); },
-        []() { day_16( "<unknown>" ); },
-        []() { day_17( "<unknown>" ); },
-        []() { day_18( "<unknown>" ); },
-        []() { day_19( "<unknown>" ); },
-        []() { day_20( "<unknown>" ); },
-        []() { day_21( "<unknown>" ); },
-        []() { day_22( "<unknown>" ); },
-        []() { day_23( "<unknown>" ); },
-        []() { day_24( "<unknown>" ); },
-        []() { day_25( "<unknown>" ); }
+const aoc::day_table& aoc::yYEAR::days() {
+    const static auto advent_of_code_YEAR = aoc::day_table{
+        { "<unknown>", day_01 },
+        { "<unknown>", day_02 },
+        { "<unknown>", day_03 },
+        { "<unknown>", day_04 },
+        { "<unknown>", day_05 },
+        { "<unknown>", day_06 },
+        { "<unknown>", day_07 },
+        { "<unknown>", day_08 },
+        { "<unknown>", day_09 },
+        { "<unknown>", day_10 },
+        { "<unknown>", day_11 },
+        { "<unknown>", day_12 },
+        { "<unknown>", day_13 },
+        { "<unknown>", day_14 },
+        { "<unknown>", day_15 },
+        { "<unknown>", day_16 },
+        { "<unknown>", day_17 },
+        { "<unknown>", day_18 },
+        { "<unknown>", day_19 },
+        { "<unknown>", day_20 },
+        { "<unknown>", day_21 },
+        { "<unknown>", day_22 },
+        { "<unknown>", day_23 },
+        { "<unknown>", day_24 },
+        { "<unknown>", day_25 }
     };
-    
-    auto index = day - 1;
-    if (index < 0) {
-        std::print("invalid day: {0}\n", day);
-        return;
-    }
-
-    if (index < advent_of_code_YEAR.size()) {
-        advent_of_code_YEAR[index]();
-    }
-    else {
-        std::print("Day {0} is not complete.\n", day);
-    }
+    return advent_of_code_YEAR;
 }
 )";
 
     constexpr auto k_year_header = R"(
 #pragma once
 
-#include <string>
+#include "../util/solver.h"
 
 namespace aoc {
     namespace yYEAR {
-        void day_01(const std::string& title);
-        void day_02(const std::string& title);
-        void day_03(const std::string& title);
-        void day_04(const std::string& title);
-        void day_05(const std::string& title);
-        void day_06(const std::string& title);
-        void day_07(const std::string& title);
-        void day_08(const std::string& title);
-        void day_09(const std::string& title);
-        void day_10(const std::string& title);
-        void day_11(const std::string& title);
-        void day_12(const std::string& title);
-        void day_13(const std::string& title);
-        void day_14(const std::string& title);
-        void day_15(const std::string& title);
-        void day_16(const std::string& title);
-        void day_17(const std::string& title);
-        void day_18(const std::string& title);
-        void day_19(const std::string& title);
-        void day_20(const std::string& title);
-        void day_21(const std::string& title);
-        void day_22(const std::string& title);
-        void day_23(const std::string& title);
-        void day_24(const std::string& title);
-        void day_25(const std::string& title);
-
-        void do_advent_of_code(int day);
+        solver_ptr day_01();
+        solver_ptr day_02();
+        solver_ptr day_03();
+        solver_ptr day_04();
+        solver_ptr day_05();
+        solver_ptr day_06();
+        solver_ptr day_07();
+        solver_ptr day_08();
+        solver_ptr day_09();
+        solver_ptr day_10();
+        solver_ptr day_11();
+        solver_ptr day_12();
+        solver_ptr day_13();
+        solver_ptr day_14();
+        solver_ptr day_15();
+        solver_ptr day_16();
+        solver_ptr day_17();
+        solver_ptr day_18();
+        solver_ptr day_19();
+        solver_ptr day_20();
+        solver_ptr day_21();
+        solver_ptr day_22();
+        solver_ptr day_23();
+        solver_ptr day_24();
+        solver_ptr day_25();
+
+        const day_table& days();
     }
 }
 )";
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace aoc {
+
+    // An unbounded lock-free queue with any number of producers and a single
+    // consumer, after Dmitry Vyukov's intrusive MPSC queue. A producer swaps its
+    // node in as the new head and then links the previous head to it, so push is
+    // one exchange and one store. Between those two steps the consumer may briefly
+    // see the queue as empty; it simply finds the value on a later pop.
+
+    template<typename T>
+    class mpsc_queue {
+        struct node {
+            std::atomic<node*> next;
+            T value;
+        };
+
+        std::atomic<node*> head_;
+        node* tail_;
+
+    public:
+
+        mpsc_queue() :
+                head_(new node{ nullptr, T{} }),
+                tail_(head_.load()) {
+        }
+
+        ~mpsc_queue() {
+            while (pop()) {
+            }
+            delete tail_;
+        }
+
+        mpsc_queue(const mpsc_queue&) = delete;
+        mpsc_queue& operator=(const mpsc_queue&) = delete;
+
+        void push(T val) {
+            auto* n = new node{ nullptr, std::move(val) };
+            auto* prev = head_.exchange(n, std::memory_order_acq_rel);
+            prev->next.store(n, std::memory_order_release);
+        }
+
+        // consumer only
+        std::optional<T> pop() {
+            auto* next = tail_->next.load(std::memory_order_acquire);
+            if (!next) {
+                return {};
+            }
+            delete tail_;
+            tail_ = next;
+            return std::move(next->value);
+        }
+
+        // consumer only
+        bool empty() const {
+            return tail_->next.load(std::memory_order_acquire) == nullptr;
+        }
+    };
+
+}
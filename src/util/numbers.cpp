@@ -0,0 +1,104 @@
+#include "numbers.h"
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define AOC_NUMBERS_AVX2
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AOC_NUMBERS_SSE2
+#endif
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    bool is_number_start(char ch, bool allow_negatives) {
+        return (ch >= '0' && ch <= '9') || (allow_negatives && ch == '-');
+    }
+
+    // The vector scans advance first a block at a time and return true with first on
+    // the match, or false with fewer than a block's worth of bytes left to check.
+    // Each block is classified with signed byte compares; bytes >= 0x80 are negative
+    // and so never land in the '0'..'9' range. The movemask of the matches gives the
+    // offset of the first number character in the block.
+
+#ifdef AOC_NUMBERS_AVX2
+
+    bool find_number_start_avx2(const char*& first, const char* last, bool allow_negatives) {
+        const auto below_zero = _mm256_set1_epi8('0' - 1);
+        const auto above_nine = _mm256_set1_epi8('9' + 1);
+        const auto minus = _mm256_set1_epi8(allow_negatives ? '-' : '0');
+        for (; last - first >= 32; first += 32) {
+            auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            auto digits = _mm256_and_si256(
+                _mm256_cmpgt_epi8(block, below_zero),
+                _mm256_cmpgt_epi8(above_nine, block)
+            );
+            auto matches = _mm256_or_si256(digits, _mm256_cmpeq_epi8(block, minus));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+            if (mask) {
+                first += std::countr_zero(mask);
+                return true;
+            }
+        }
+        return false;
+    }
+
+#endif
+
+#ifdef AOC_NUMBERS_SSE2
+
+    bool find_number_start_sse2(const char*& first, const char* last, bool allow_negatives) {
+        const auto below_zero = _mm_set1_epi8('0' - 1);
+        const auto above_nine = _mm_set1_epi8('9' + 1);
+        const auto minus = _mm_set1_epi8(allow_negatives ? '-' : '0');
+        for (; last - first >= 16; first += 16) {
+            auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            auto digits = _mm_and_si128(
+                _mm_cmpgt_epi8(block, below_zero),
+                _mm_cmplt_epi8(block, above_nine)
+            );
+            auto matches = _mm_or_si128(digits, _mm_cmpeq_epi8(block, minus));
+            auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+            if (mask) {
+                first += std::countr_zero(mask);
+                return true;
+            }
+        }
+        return false;
+    }
+
+#endif
+
+}
+
+const char* aoc::find_number_start(const char* first, const char* last, bool allow_negatives) {
+
+    // numbers in puzzle input are usually close together so check the next byte
+    // before paying for a vector load.
+    if (first != last && is_number_start(*first, allow_negatives)) {
+        return first;
+    }
+
+#ifdef AOC_NUMBERS_AVX2
+    if (find_number_start_avx2(first, last, allow_negatives)) {
+        return first;
+    }
+#endif
+
+#ifdef AOC_NUMBERS_SSE2
+    if (find_number_start_sse2(first, last, allow_negatives)) {
+        return first;
+    }
+#endif
+
+    for (; first != last; ++first) {
+        if (is_number_start(*first, allow_negatives)) {
+            return first;
+        }
+    }
+    return last;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#include <boost/container/small_vector.hpp>
+
+namespace aoc {
+
+    // Single-pass, allocation-free extraction of the integers embedded in a string.
+    // Non-numeric text between numbers is skipped with a vectorised scan (AVX2 or
+    // SSE2 when the build targets them) and each run of digits is parsed in place
+    // with std::from_chars. When negatives are allowed a '-' is only treated as a
+    // sign if a digit follows it, so "5-3" yields 5 and -3 and a lone '-' is ignored.
+
+    template<typename T>
+    using number_list = boost::container::small_vector<T, 16>;
+
+    // returns a pointer to the first digit, or to the first '-' if negatives are
+    // allowed, in [first, last); last if there is none.
+    const char* find_number_start(const char* first, const char* last, bool allow_negatives);
+
+    template<typename T, typename F>
+    void for_each_number(std::string_view str, bool allow_negatives, F&& visit) {
+        const char* first = str.data();
+        const char* last = first + str.size();
+        while ((first = find_number_start(first, last, allow_negatives)) != last) {
+            if (*first == '-' && (first + 1 == last || *(first + 1) < '0' || *(first + 1) > '9')) {
+                ++first;
+                continue;
+            }
+            T value{};
+            auto [ptr, ec] = std::from_chars(first, last, value);
+            if (ec == std::errc::result_out_of_range) {
+                throw std::out_of_range("number too large");
+            }
+            if (ec != std::errc{}) {
+                ++first;
+                continue;
+            }
+            visit(value);
+            first = ptr;
+        }
+    }
+
+    // writes up to out.size() numbers into out and returns how many were written.
+    template<typename T>
+    size_t scan_numbers(std::string_view str, std::span<T> out, bool allow_negatives = false) {
+        size_t count = 0;
+        for_each_number<T>(str, allow_negatives,
+            [&](T value) {
+                if (count < out.size()) {
+                    out[count] = value;
+                }
+                ++count;
+            }
+        );
+        return std::min(count, out.size());
+    }
+
+    // appends to a caller-owned vector so that a buffer can be reused across lines.
+    template<typename T>
+    void scan_numbers(std::string_view str, std::vector<T>& out, bool allow_negatives = false) {
+        for_each_number<T>(str, allow_negatives,
+            [&](T value) {
+                out.push_back(value);
+            }
+        );
+    }
+
+    template<typename T>
+    number_list<T> scan_numbers(std::string_view str, bool allow_negatives = false) {
+        number_list<T> numbers;
+        for_each_number<T>(str, allow_negatives,
+            [&](T value) {
+                numbers.push_back(value);
+            }
+        );
+        return numbers;
+    }
+}
@@ -0,0 +1,311 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+    // Addressable min-priority queues for Dijkstra-style searches. All of them
+    // have the same interface,
+    //
+    //     insert(item, priority), extract_min(), contains(item),
+    //     change_priority(item, priority), empty(), size()
+    //
+    // and a search picks one through the third template parameter of
+    // aoc::priority_queue, e.g. aoc::priority_queue<state, state_hash, aoc::radix_heap>.
+    //
+    //  * multimap_priority_queue: a std::multimap keyed on priority plus a hash map
+    //    from item to multimap node. Equal priorities come out first in, first out.
+    //  * indexed_dary_heap (indexed_4ary_heap): an implicit D-ary heap in a vector
+    //    plus a hash map from item to heap slot, for decrease-key without nodes.
+    //  * radix_heap: a monotone radix heap for non-negative integer priorities. It
+    //    only works when no priority inserted is below the last one extracted, as
+    //    in Dijkstra with non-negative edge weights, and then costs O(log C)
+    //    amortised per item for keys spanning C.
+
+    template<typename V, typename H = std::hash<V>>
+    class multimap_priority_queue {
+        using map_impl = std::multimap<int, V>;
+        map_impl priority_to_item_;
+        std::unordered_map<V, typename map_impl::iterator, H> item_to_mmap_iter_;
+
+    public:
+        multimap_priority_queue()
+        {}
+
+        V extract_min() {
+            auto first = priority_to_item_.begin();
+            auto loc = first->second;
+            priority_to_item_.erase(first);
+            item_to_mmap_iter_.erase(loc);
+            return loc;
+        }
+
+        void insert(const V& loc, int priority) {
+            auto iter = priority_to_item_.insert({ priority, loc });
+            item_to_mmap_iter_[loc] = iter;
+        }
+
+        bool contains(const V& v) const {
+            return item_to_mmap_iter_.contains(v);
+        }
+
+        void change_priority(const V& loc, int priority) {
+            auto iter = item_to_mmap_iter_[loc];
+            priority_to_item_.erase(iter);
+            item_to_mmap_iter_.erase(loc);
+            insert(loc, priority);
+        }
+
+        bool empty() const {
+            return priority_to_item_.empty();
+        }
+
+        size_t size() const {
+            return priority_to_item_.size();
+        }
+    };
+
+    template<typename V, typename H = std::hash<V>, int D = 4>
+    class indexed_dary_heap {
+        static_assert(D >= 2);
+
+        // each entry points at its item's slot index in index_, whose nodes do not
+        // move on rehash, so sifting updates positions without hashing.
+
+        struct entry {
+            int priority;
+            V item;
+            size_t* index;
+        };
+
+        std::vector<entry> heap_;
+        std::unordered_map<V, size_t, H> index_;
+
+        void place(size_t i, entry&& e) {
+            *e.index = i;
+            heap_[i] = std::move(e);
+        }
+
+        void sift_up(size_t i) {
+            auto e = std::move(heap_[i]);
+            while (i > 0) {
+                auto parent = (i - 1) / D;
+                if (heap_[parent].priority <= e.priority) {
+                    break;
+                }
+                place(i, std::move(heap_[parent]));
+                i = parent;
+            }
+            place(i, std::move(e));
+        }
+
+        void sift_down(size_t i) {
+            auto e = std::move(heap_[i]);
+            auto n = heap_.size();
+            for (;;) {
+                auto first_child = i * D + 1;
+                if (first_child >= n) {
+                    break;
+                }
+                auto last_child = std::min(first_child + D, n);
+                auto min_child = first_child;
+                for (auto c = first_child + 1; c < last_child; ++c) {
+                    if (heap_[c].priority < heap_[min_child].priority) {
+                        min_child = c;
+                    }
+                }
+                if (e.priority <= heap_[min_child].priority) {
+                    break;
+                }
+                place(i, std::move(heap_[min_child]));
+                i = min_child;
+            }
+            place(i, std::move(e));
+        }
+
+    public:
+        indexed_dary_heap()
+        {}
+
+        V extract_min() {
+            auto min = std::move(heap_.front().item);
+            index_.erase(min);
+            if (heap_.size() > 1) {
+                heap_.front() = std::move(heap_.back());
+                heap_.pop_back();
+                sift_down(0);
+            } else {
+                heap_.pop_back();
+            }
+            return min;
+        }
+
+        void insert(const V& item, int priority) {
+            if (contains(item)) {
+                change_priority(item, priority);
+                return;
+            }
+            auto& index = index_[item];
+            heap_.push_back({ priority, item, &index });
+            sift_up(heap_.size() - 1);
+        }
+
+        bool contains(const V& v) const {
+            return index_.contains(v);
+        }
+
+        void change_priority(const V& item, int priority) {
+            auto iter = index_.find(item);
+            if (iter == index_.end()) {
+                insert(item, priority);
+                return;
+            }
+            auto i = iter->second;
+            auto old_priority = heap_[i].priority;
+            heap_[i].priority = priority;
+            if (priority < old_priority) {
+                sift_up(i);
+            } else {
+                sift_down(i);
+            }
+        }
+
+        bool empty() const {
+            return heap_.empty();
+        }
+
+        size_t size() const {
+            return heap_.size();
+        }
+    };
+
+    template<typename V, typename H = std::hash<V>>
+    using indexed_4ary_heap = indexed_dary_heap<V, H, 4>;
+
+    template<typename V, typename H = std::hash<V>>
+    class radix_heap {
+
+        // bucket 0 holds the items whose priority equals last_, the priority most
+        // recently extracted; bucket b > 0 holds those whose highest bit differing
+        // from last_ is bit b - 1. extract_min only has to scan the lowest non-empty
+        // bucket, whose items are all redistributed into lower buckets once last_
+        // moves up to their minimum.
+
+        static constexpr int k_num_buckets = 33;
+
+        struct entry {
+            uint32_t priority;
+            V item;
+        };
+
+        struct location {
+            int bucket;
+            size_t index;
+        };
+
+        std::array<std::vector<entry>, k_num_buckets> buckets_;
+        std::unordered_map<V, location, H> locations_;
+        uint32_t last_;
+        size_t size_;
+
+        int bucket_of(uint32_t priority) const {
+            return std::bit_width(priority ^ last_);
+        }
+
+        void push(entry&& e) {
+            auto b = bucket_of(e.priority);
+            locations_[e.item] = { b, buckets_[b].size() };
+            buckets_[b].push_back(std::move(e));
+        }
+
+        void remove(const location& loc) {
+            auto& bucket = buckets_[loc.bucket];
+            if (loc.index + 1 != bucket.size()) {
+                bucket[loc.index] = std::move(bucket.back());
+                locations_[bucket[loc.index].item].index = loc.index;
+            }
+            bucket.pop_back();
+        }
+
+        void check_monotone(int priority) const {
+            if (priority < 0 || static_cast<uint32_t>(priority) < last_) {
+                throw std::domain_error("radix_heap: priority below the last extracted minimum");
+            }
+        }
+
+    public:
+        radix_heap() : last_(0), size_(0)
+        {}
+
+        V extract_min() {
+            if (buckets_[0].empty()) {
+                auto b = 1;
+                while (buckets_[b].empty()) {
+                    ++b;
+                }
+                auto bucket = std::move(buckets_[b]);
+                buckets_[b].clear();
+                last_ = std::min_element(bucket.begin(), bucket.end(),
+                    [](const entry& lhs, const entry& rhs) {
+                        return lhs.priority < rhs.priority;
+                    }
+                )->priority;
+                for (auto& e : bucket) {
+                    push(std::move(e));
+                }
+            }
+            auto min = std::move(buckets_[0].back().item);
+            buckets_[0].pop_back();
+            locations_.erase(min);
+            --size_;
+            return min;
+        }
+
+        void insert(const V& item, int priority) {
+            if (contains(item)) {
+                change_priority(item, priority);
+                return;
+            }
+            check_monotone(priority);
+            push({ static_cast<uint32_t>(priority), item });
+            ++size_;
+        }
+
+        bool contains(const V& v) const {
+            return locations_.contains(v);
+        }
+
+        void change_priority(const V& item, int priority) {
+            auto iter = locations_.find(item);
+            if (iter == locations_.end()) {
+                insert(item, priority);
+                return;
+            }
+            check_monotone(priority);
+            remove(iter->second);
+            push({ static_cast<uint32_t>(priority), item });
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+
+        size_t size() const {
+            return size_;
+        }
+    };
+
+    template<typename V, typename H = std::hash<V>,
+        template<typename, typename> typename Impl = indexed_4ary_heap>
+    using priority_queue = Impl<V, H>;
+
+}
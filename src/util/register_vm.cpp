@@ -0,0 +1,348 @@
+#include "register_vm.h"
+#include <algorithm>
+#include <cctype>
+#include <format>
+#include <numeric>
+#include <sstream>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    thread_local aoc::vm_profile* t_active_profile = nullptr;
+
+    // the length of the bar drawn for the hottest address or block.
+    constexpr int k_histogram_width = 40;
+
+    double percent(uint64_t count, uint64_t total) {
+        return (total > 0) ? 100.0 * static_cast<double>(count) / static_cast<double>(total) : 0.0;
+    }
+
+    int64_t parse_number(std::string_view str) {
+        if (!str.empty() && str.front() == '+') {
+            str.remove_prefix(1);
+        }
+        return std::stoll(std::string(str));
+    }
+
+    aoc::vm_operand parse_operand(std::string_view str) {
+        if (str.size() == 1 && std::isalpha(str.front())) {
+            return aoc::vm_reg(std::tolower(str.front()) - 'a');
+        }
+        return aoc::vm_imm(parse_number(str));
+    }
+
+    int check_register(int64_t reg) {
+        if (reg < 0 || reg >= aoc::k_vm_num_registers) {
+            throw std::runtime_error(std::format("vm: bad register {}", reg));
+        }
+        return static_cast<int>(reg);
+    }
+
+    // the operand an argument resolves to, for the given statement.
+    aoc::vm_operand resolve(const aoc::vm_arg& arg, const aoc::vm_statement& stmt) {
+        switch (arg.kind) {
+            case aoc::vm_arg_kind::none:
+            case aoc::vm_arg_kind::constant:
+                return aoc::vm_imm(arg.value);
+            case aoc::vm_arg_kind::fixed:
+                return aoc::vm_reg(static_cast<int>(arg.value));
+            case aoc::vm_arg_kind::written:
+                return stmt.args[arg.value];
+            case aoc::vm_arg_kind::reg:
+                return aoc::vm_reg(static_cast<int>(stmt.args[arg.value].value));
+            case aoc::vm_arg_kind::imm:
+                return aoc::vm_imm(stmt.args[arg.value].value);
+        }
+        throw std::runtime_error("vm: bad argument kind");
+    }
+
+    // re-derives the macro-ops of the patterns starting in [first, last),
+    // reusing the slots of the macro-ops they replace.
+    void optimise(aoc::vm_program& program, int64_t first, int64_t last) {
+        const auto& peephole = program.dialect->peephole();
+        if (peephole.recognise == nullptr) {
+            return;
+        }
+        auto size = static_cast<int64_t>(program.plain.size());
+        for (auto start = std::max<int64_t>(first, 0); start < std::min(last, size); ++start) {
+            auto& instr = program.code[start];
+            auto slot = (instr.op == aoc::vm_op::macro) ? instr.a : static_cast<int64_t>(program.macros.size());
+            instr = program.plain[start];
+
+            auto macro = peephole.recognise(program.plain, static_cast<size_t>(start));
+            if (!macro) {
+                continue;
+            }
+            if (slot == static_cast<int64_t>(program.macros.size())) {
+                program.macros.push_back(*macro);
+            } else {
+                program.macros[slot] = *macro;
+            }
+            instr = { aoc::vm_op::macro, 0, instr.code, 0, slot, 0 };
+        }
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+std::string aoc::vm_op_name(vm_op op) {
+    static const std::array<std::string, static_cast<int>(vm_op::num_ops)> names = { {
+        "nop", "set", "add", "sub", "mul", "div", "mod", "and", "or", "xor", "shr", "gt", "eq",
+        "jmp", "jnz", "jgz", "jie", "jio", "out", "in", "tgl", "macro"
+    } };
+    auto index = static_cast<size_t>(op);
+    return (index < names.size()) ? names[index] : std::format("op{}", index);
+}
+
+aoc::vm_dialect::vm_dialect(std::vector<vm_opcode> opcodes, vm_peephole peephole) :
+        opcodes_(std::move(opcodes)),
+        peephole_(peephole) {
+    for (int code = 0; code < num_codes(); ++code) {
+        codes_[opcodes_[code].mnemonic] = code;
+    }
+    for (const auto& opcode : opcodes_) {
+        toggled_.push_back(opcode.toggled.empty() ? -1 : code(opcode.toggled));
+    }
+}
+
+int aoc::vm_dialect::code(std::string_view mnemonic) const {
+    auto iter = codes_.find(std::string(mnemonic));
+    if (iter == codes_.end()) {
+        throw std::runtime_error(std::format("vm: unknown mnemonic '{}'", mnemonic));
+    }
+    return iter->second;
+}
+
+const aoc::vm_opcode& aoc::vm_dialect::opcode(int code) const {
+    return opcodes_.at(code);
+}
+
+int aoc::vm_dialect::num_codes() const {
+    return static_cast<int>(opcodes_.size());
+}
+
+int aoc::vm_dialect::toggled(int code) const {
+    return toggled_.at(code);
+}
+
+aoc::vm_instruction aoc::vm_dialect::decode(const vm_statement& stmt) const {
+    const auto& opcode = this->opcode(stmt.code);
+    auto dst = resolve(opcode.dst, stmt);
+    auto a = resolve(opcode.a, stmt);
+    auto b = resolve(opcode.b, stmt);
+
+    vm_instruction instr = { opcode.op, 0, static_cast<int16_t>(stmt.code), 0, a.value, b.value };
+    if (opcode.dst.kind != vm_arg_kind::none) {
+        if (!dst.is_register) {
+            return { vm_op::nop, 0, instr.code, 0, 0, 0 };
+        }
+        instr.dst = check_register(dst.value);
+    }
+    if (a.is_register) {
+        check_register(a.value);
+        instr.reg_flags |= vm_instruction::k_a_is_reg;
+    }
+    if (b.is_register) {
+        check_register(b.value);
+        instr.reg_flags |= vm_instruction::k_b_is_reg;
+    }
+    return instr;
+}
+
+aoc::vm_statement aoc::vm_dialect::parse(std::string_view line) const {
+    std::vector<std::string_view> words;
+    size_t start = 0;
+    while (start < line.size()) {
+        auto end = line.find_first_of(" ,", start);
+        if (end == std::string_view::npos) {
+            end = line.size();
+        }
+        if (end > start) {
+            words.push_back(line.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+    if (words.empty() || words.size() > 4) {
+        throw std::runtime_error(std::format("vm: bad statement '{}'", line));
+    }
+
+    vm_statement stmt = { code(words.front()), {} };
+    for (size_t i = 1; i < words.size(); ++i) {
+        stmt.args[i - 1] = parse_operand(words[i]);
+    }
+    return stmt;
+}
+
+const aoc::vm_peephole& aoc::vm_dialect::peephole() const {
+    return peephole_;
+}
+
+aoc::vm_program aoc::vm_assemble(const vm_dialect& dialect, const std::vector<vm_statement>& source,
+        int ip_register) {
+    vm_program program = { &dialect, source, {}, {}, {}, ip_register };
+    program.plain.reserve(source.size());
+    for (const auto& stmt : source) {
+        program.plain.push_back(dialect.decode(stmt));
+    }
+    program.code = program.plain;
+    optimise(program, 0, static_cast<int64_t>(program.plain.size()));
+    if (ip_register >= 0) {
+        check_register(ip_register);
+    }
+    return program;
+}
+
+aoc::vm_program aoc::vm_assemble(const vm_dialect& dialect, const std::vector<std::string>& lines,
+        int ip_register) {
+    std::vector<vm_statement> source;
+    for (const auto& line : lines) {
+        if (!line.empty()) {
+            source.push_back(dialect.parse(line));
+        }
+    }
+    return vm_assemble(dialect, source, ip_register);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::vm_profile::scope::scope(vm_profile& profile) :
+        prev_(t_active_profile) {
+    t_active_profile = &profile;
+}
+
+aoc::vm_profile::scope::~scope() {
+    t_active_profile = prev_;
+}
+
+aoc::vm_profile* aoc::vm_profile::active() {
+    return t_active_profile;
+}
+
+aoc::vm_profile::vm_profile() :
+    op_counts_{},
+    steps_(0) {
+}
+
+uint64_t aoc::vm_profile::steps() const {
+    return steps_;
+}
+
+uint64_t aoc::vm_profile::op_count(vm_op op) const {
+    auto index = static_cast<size_t>(op);
+    return (index < op_counts_.size()) ? op_counts_[index] : 0;
+}
+
+uint64_t aoc::vm_profile::ip_count(int64_t ip) const {
+    return (ip >= 0 && ip < static_cast<int64_t>(ip_counts_.size())) ? ip_counts_[ip] : 0;
+}
+
+std::string aoc::vm_profile::report(size_t num_ips) const {
+    std::stringstream ss;
+    ss << std::format("{} instructions\n", steps_);
+
+    ss << "\noperations:\n";
+    std::vector<int> ops(op_counts_.size());
+    std::iota(ops.begin(), ops.end(), 0);
+    std::erase_if(ops, [&](int op) { return op_counts_[op] == 0; });
+    std::ranges::sort(ops, [&](int lhs, int rhs) { return op_counts_[lhs] > op_counts_[rhs]; });
+    for (auto op : ops) {
+        ss << std::format("    {:<6} {:>12} {:>6.2f}%\n",
+            vm_op_name(static_cast<vm_op>(op)), op_counts_[op], percent(op_counts_[op], steps_));
+    }
+
+    std::vector<size_t> ips(ip_counts_.size());
+    std::iota(ips.begin(), ips.end(), 0);
+    std::erase_if(ips, [&](size_t ip) { return ip_counts_[ip] == 0; });
+    auto hottest = [&](size_t lhs, size_t rhs) { return ip_counts_[lhs] > ip_counts_[rhs]; };
+    num_ips = std::min(num_ips, ips.size());
+    std::ranges::partial_sort(ips, ips.begin() + num_ips, hottest);
+
+    ss << "\nhot addresses:\n";
+    for (size_t i = 0; i < num_ips; ++i) {
+        auto ip = ips[i];
+        auto bar = static_cast<int>(k_histogram_width * ip_counts_[ip] / ip_counts_[ips.front()]);
+        ss << std::format("    {:04}: {:<6} {:>12} {:>6.2f}% {}\n", ip, vm_op_name(ip_ops_[ip]),
+            ip_counts_[ip], percent(ip_counts_[ip], steps_), std::string(std::max(bar, 1), '#'));
+    }
+
+    if (!block_counts_.empty()) {
+        using block_count = std::pair<std::pair<int64_t, int64_t>, uint64_t>;
+        std::vector<block_count> blocks(block_counts_.begin(), block_counts_.end());
+        auto num_blocks = std::min(num_ips, blocks.size());
+        std::ranges::partial_sort(blocks, blocks.begin() + num_blocks,
+            [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+
+        ss << "\nhot blocks:\n";
+        for (size_t i = 0; i < num_blocks; ++i) {
+            auto [range, count] = blocks[i];
+            auto bar = static_cast<int>(k_histogram_width * count / blocks.front().second);
+            ss << std::format("    {:04}-{:04} {:>12} {}\n", range.first, range.second, count,
+                std::string(std::max(bar, 1), '#'));
+        }
+    }
+    return ss.str();
+}
+
+void aoc::vm_profile::record_block(int64_t first, int64_t last, uint64_t count) {
+    block_counts_[{ first, last }] += count;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::vm_machine::vm_machine(vm_program program) :
+    registers_{},
+    ip_(0),
+    program_(std::move(program)) {
+}
+
+int64_t& aoc::vm_machine::operator[](int reg) {
+    return registers_.at(reg);
+}
+
+int64_t aoc::vm_machine::operator[](int reg) const {
+    return registers_.at(reg);
+}
+
+int64_t& aoc::vm_machine::reg(char name) {
+    return registers_.at(name - 'a');
+}
+
+int64_t aoc::vm_machine::reg(char name) const {
+    return registers_.at(name - 'a');
+}
+
+const aoc::vm_registers& aoc::vm_machine::registers() const {
+    return registers_;
+}
+
+int64_t aoc::vm_machine::ip() const {
+    return ip_;
+}
+
+const aoc::vm_program& aoc::vm_machine::program() const {
+    return program_;
+}
+
+aoc::vm_status aoc::vm_machine::run() {
+    vm_handler handler;
+    return run(handler);
+}
+
+void aoc::vm_machine::toggle(int64_t index) {
+    if (index < 0 || index >= static_cast<int64_t>(program_.code.size())) {
+        return;
+    }
+    auto& stmt = program_.source[index];
+    auto code = program_.dialect->toggled(stmt.code);
+    if (code < 0) {
+        throw std::runtime_error("vm: instruction cannot be toggled");
+    }
+    stmt.code = code;
+    program_.plain[index] = program_.dialect->decode(stmt);
+    if (program_.code[index].op != vm_op::macro) {
+        program_.code[index] = program_.plain[index];
+    }
+    auto max_length = program_.dialect->peephole().max_length;
+    optimise(program_, index - max_length + 1, index + 1);
+}
@@ -0,0 +1,474 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+    // a register machine shared by the puzzles' toy CPUs: assembunny, elfcode,
+    // the duet and coprocessor programs, the handheld console and so on. Each of
+    // them is a dialect, a table mapping its mnemonics onto the machine's own
+    // operations, so they all run on the same interpreter.
+    //
+    // instructions are three-address, dst = a op b, decoded once into a fixed
+    // width form in which each source operand is either a register or an
+    // immediate. The registers are a dense array of 64-bit values.
+
+    constexpr int k_vm_num_registers = 32;
+    using vm_registers = std::array<int64_t, k_vm_num_registers>;
+
+    enum class vm_op : uint8_t {
+        nop,
+        set,
+        add,
+        sub,
+        mul,
+        div,
+        mod,
+        bit_and,
+        bit_or,
+        bit_xor,
+        shr,
+        gt,
+        eq,
+        jmp,
+        jnz,
+        jgz,
+        jie,
+        jio,
+        out,
+        in,
+        tgl,
+        macro,
+        num_ops
+    };
+
+    std::string vm_op_name(vm_op op);
+
+    // an operand as written: a register, named by a letter, or a number.
+    struct vm_operand {
+        int64_t value;
+        bool is_register;
+    };
+
+    constexpr vm_operand vm_reg(int reg) {
+        return { reg, true };
+    }
+
+    constexpr vm_operand vm_imm(int64_t value) {
+        return { value, false };
+    }
+
+    // where a dialect's opcode takes dst, a and b from: one of its operands, as
+    // written or read as a register index or as an immediate, a constant, a
+    // fixed register, or nowhere.
+    enum class vm_arg_kind : uint8_t {
+        none,
+        written,
+        reg,
+        imm,
+        constant,
+        fixed
+    };
+
+    struct vm_arg {
+        vm_arg_kind kind;
+        int64_t value;
+    };
+
+    constexpr vm_arg vm_none() {
+        return { vm_arg_kind::none, 0 };
+    }
+
+    constexpr vm_arg vm_written(int operand) {
+        return { vm_arg_kind::written, operand };
+    }
+
+    constexpr vm_arg vm_as_reg(int operand) {
+        return { vm_arg_kind::reg, operand };
+    }
+
+    constexpr vm_arg vm_as_imm(int operand) {
+        return { vm_arg_kind::imm, operand };
+    }
+
+    constexpr vm_arg vm_const(int64_t value) {
+        return { vm_arg_kind::constant, value };
+    }
+
+    constexpr vm_arg vm_fixed(int reg) {
+        return { vm_arg_kind::fixed, reg };
+    }
+
+    struct vm_opcode {
+        std::string mnemonic;
+        vm_op op;
+        vm_arg dst;
+        vm_arg a;
+        vm_arg b;
+
+        // the mnemonic a tgl instruction turns this one into, if any.
+        std::string toggled = {};
+    };
+
+    // an instruction as written: the index of its opcode in the dialect and its
+    // operands.
+    struct vm_statement {
+        int code;
+        std::array<vm_operand, 3> args;
+    };
+
+    // an instruction as the machine runs it. An instruction whose destination
+    // turns out not to be a register, which a tgl can produce, decodes to a nop.
+    struct vm_instruction {
+        vm_op op;
+        uint8_t reg_flags;
+        int16_t code;
+        int32_t dst;
+        int64_t a;
+        int64_t b;
+
+        static constexpr uint8_t k_a_is_reg = 1;
+        static constexpr uint8_t k_b_is_reg = 2;
+    };
+
+    // the result of one of the operations that compute a value, set to eq, for
+    // engines and puzzles that evaluate instructions outside the machine.
+    inline int64_t vm_apply(vm_op op, int64_t a, int64_t b) {
+        switch (op) {
+            case vm_op::set: return a;
+            case vm_op::add: return a + b;
+            case vm_op::sub: return a - b;
+            case vm_op::mul: return a * b;
+            case vm_op::div: return a / b;
+            case vm_op::mod: return a % b;
+            case vm_op::bit_and: return a & b;
+            case vm_op::bit_or: return a | b;
+            case vm_op::bit_xor: return a ^ b;
+            case vm_op::shr: return a >> b;
+            case vm_op::gt: return (a > b) ? 1 : 0;
+            case vm_op::eq: return (a == b) ? 1 : 0;
+            default:
+                throw std::runtime_error("vm: operation computes no value");
+        }
+    }
+
+    // a pattern of instructions, such as a loop that adds one register to
+    // another a step at a time, run as a single macro-op. The macro-op takes the
+    // place of the pattern's first instruction and, if its preconditions hold,
+    // does the work of the whole pattern and moves past it. Otherwise the
+    // instruction it replaced runs as usual.
+
+    enum class vm_macro_kind : uint8_t {
+        // target += sign * outer; outer = 0, if outer > 0.
+        add_loop,
+
+        // target += sign * source * outer; inner = outer = 0, if source > 0 and
+        // outer > 0.
+        mul_loop
+    };
+
+    struct vm_macro {
+        vm_macro_kind kind;
+        int length;
+        int target;
+        int64_t sign;
+        vm_operand source;
+        int inner;
+        int outer;
+    };
+
+    // recognises the pattern, if any, that starts at start, given the program's
+    // instructions without macro-ops, along with the most instructions any of
+    // its patterns spans.
+    struct vm_peephole {
+        std::optional<vm_macro> (*recognise)(std::span<const vm_instruction> code, size_t start);
+        int max_length;
+    };
+
+    class vm_dialect {
+    public:
+        explicit vm_dialect(std::vector<vm_opcode> opcodes, vm_peephole peephole = { nullptr, 0 });
+
+        int code(std::string_view mnemonic) const;
+        const vm_opcode& opcode(int code) const;
+        int num_codes() const;
+
+        // the code a tgl turns code into.
+        int toggled(int code) const;
+
+        vm_instruction decode(const vm_statement& stmt) const;
+
+        // parses a mnemonic followed by operands separated by spaces or commas,
+        // reading a lone letter as a register, a for 0 onwards, and anything else
+        // as a number.
+        vm_statement parse(std::string_view line) const;
+
+        const vm_peephole& peephole() const;
+
+    private:
+        std::vector<vm_opcode> opcodes_;
+        vm_peephole peephole_;
+        std::vector<int> toggled_;
+        std::unordered_map<std::string, int> codes_;
+    };
+
+    // code is what runs: plain, the decoded source, with the first instruction of
+    // each pattern the dialect's peephole pass recognises replaced by a macro-op
+    // whose a is its index in macros.
+    struct vm_program {
+        const vm_dialect* dialect;
+        std::vector<vm_statement> source;
+        std::vector<vm_instruction> plain;
+        std::vector<vm_instruction> code;
+        std::vector<vm_macro> macros;
+
+        // the register the instruction pointer is bound to, or -1. When it is
+        // bound, the register holds the instruction pointer while each
+        // instruction runs, and the next instruction is the one after the value
+        // left in it.
+        int ip_register;
+    };
+
+    vm_program vm_assemble(const vm_dialect& dialect, const std::vector<vm_statement>& source,
+        int ip_register = -1);
+    vm_program vm_assemble(const vm_dialect& dialect, const std::vector<std::string>& lines,
+        int ip_register = -1);
+
+    // execution counts per operation and per address, recorded for every machine
+    // run on a thread while a scope is open there.
+
+    class vm_profile {
+    public:
+        class scope {
+            vm_profile* prev_;
+        public:
+            explicit scope(vm_profile& profile);
+            ~scope();
+
+            scope(const scope&) = delete;
+            scope& operator=(const scope&) = delete;
+        };
+
+        // the profile recording on this thread, if any.
+        static vm_profile* active();
+
+        vm_profile();
+
+        // records count runs of the instruction at ip, which engines that count
+        // whole blocks of instructions record in one go.
+        void record(int64_t ip, const vm_instruction& instr, uint64_t count = 1) {
+            op_counts_[static_cast<int>(instr.op)] += count;
+            steps_ += count;
+            auto index = static_cast<size_t>(ip);
+            if (index >= ip_counts_.size()) {
+                ip_counts_.resize(index + 1, 0);
+                ip_ops_.resize(index + 1, vm_op::nop);
+            }
+            ip_counts_[index] += count;
+            ip_ops_[index] = instr.op;
+        }
+
+        // records count runs of the block of instructions from first to last.
+        void record_block(int64_t first, int64_t last, uint64_t count);
+
+        uint64_t steps() const;
+        uint64_t op_count(vm_op op) const;
+        uint64_t ip_count(int64_t ip) const;
+
+        // a summary followed by a histogram of the num_ips hottest addresses and,
+        // if any were recorded, of the num_ips hottest blocks.
+        std::string report(size_t num_ips = 20) const;
+
+    private:
+        std::array<uint64_t, static_cast<int>(vm_op::num_ops)> op_counts_;
+        std::vector<uint64_t> ip_counts_;
+        std::vector<vm_op> ip_ops_;
+        std::map<std::pair<int64_t, int64_t>, uint64_t> block_counts_;
+        uint64_t steps_;
+    };
+
+    enum class vm_status {
+        halted,
+        blocked,
+        stopped
+    };
+
+    // the default handler of a machine's events. A handler passed to run need
+    // only declare the functions it replaces.
+    //
+    // before is called with the instruction pointer before every instruction, and
+    // stops the machine if it returns false. input is given the register to read
+    // into and blocks the machine, leaving it on the same instruction, if it
+    // returns false.
+
+    struct vm_handler {
+        bool before(int64_t ip, const vm_registers& regs) {
+            return true;
+        }
+
+        void output(int64_t value) {
+            throw std::runtime_error("vm: no output handler");
+        }
+
+        bool input(int64_t& reg) {
+            throw std::runtime_error("vm: no input handler");
+        }
+    };
+
+    class vm_machine {
+    public:
+        explicit vm_machine(vm_program program);
+
+        int64_t& operator[](int reg);
+        int64_t operator[](int reg) const;
+
+        // the register named by a letter.
+        int64_t& reg(char name);
+        int64_t reg(char name) const;
+
+        const vm_registers& registers() const;
+        int64_t ip() const;
+        const vm_program& program() const;
+
+        // runs until the instruction pointer leaves the program, returning
+        // halted, or until the handler blocks or stops the machine. The profiling
+        // build of the loop runs if a profile is recording on this thread.
+        template<typename Handler>
+        vm_status run(Handler& handler) {
+            if (auto* profile = vm_profile::active(); profile) {
+                return (program_.ip_register >= 0) ?
+                    execute<Handler, true, true>(handler, profile) :
+                    execute<Handler, false, true>(handler, profile);
+            }
+            return (program_.ip_register >= 0) ?
+                execute<Handler, true, false>(handler, nullptr) :
+                execute<Handler, false, false>(handler, nullptr);
+        }
+
+        vm_status run();
+
+    private:
+        vm_registers registers_;
+        int64_t ip_;
+        vm_program program_;
+
+        // rewrites the instruction at index, then re-derives the patterns that
+        // could include it.
+        void toggle(int64_t index);
+
+        int64_t value(const vm_operand& operand) const {
+            return operand.is_register ? registers_[operand.value] : operand.value;
+        }
+
+        // runs a macro-op, returning false if its preconditions do not hold.
+        bool run_macro(const vm_macro& macro, int64_t& ip) {
+            auto& regs = registers_;
+            switch (macro.kind) {
+                case vm_macro_kind::add_loop:
+                    if (regs[macro.outer] <= 0) {
+                        return false;
+                    }
+                    regs[macro.target] += macro.sign * regs[macro.outer];
+                    regs[macro.outer] = 0;
+                    break;
+                case vm_macro_kind::mul_loop: {
+                    auto source = value(macro.source);
+                    if (source <= 0 || regs[macro.outer] <= 0) {
+                        return false;
+                    }
+                    regs[macro.target] += macro.sign * source * regs[macro.outer];
+                    regs[macro.inner] = 0;
+                    regs[macro.outer] = 0;
+                    break;
+                }
+            }
+            ip += macro.length;
+            return true;
+        }
+
+        template<typename Handler, bool BoundIp, bool Profiled>
+        vm_status execute(Handler& handler, vm_profile* profile) {
+            auto& regs = registers_;
+            auto* code = program_.code.data();
+            auto size = static_cast<int64_t>(program_.code.size());
+            auto ip_reg = program_.ip_register;
+            auto ip = ip_;
+
+            while (ip >= 0 && ip < size) {
+                if constexpr (BoundIp) {
+                    regs[ip_reg] = ip;
+                }
+                if (!handler.before(ip, regs)) {
+                    ip_ = ip;
+                    return vm_status::stopped;
+                }
+                if constexpr (Profiled) {
+                    profile->record(ip, code[ip]);
+                }
+                const auto* instr_ptr = &code[ip];
+                if (instr_ptr->op == vm_op::macro) {
+                    if (run_macro(program_.macros[instr_ptr->a], ip)) {
+                        continue;
+                    }
+                    instr_ptr = &program_.plain[ip];
+                }
+                const auto& instr = *instr_ptr;
+                auto a = (instr.reg_flags & vm_instruction::k_a_is_reg) ? regs[instr.a] : instr.a;
+                auto b = (instr.reg_flags & vm_instruction::k_b_is_reg) ? regs[instr.b] : instr.b;
+
+                switch (instr.op) {
+                    case vm_op::nop: break;
+                    case vm_op::set: regs[instr.dst] = a; break;
+                    case vm_op::add: regs[instr.dst] = a + b; break;
+                    case vm_op::sub: regs[instr.dst] = a - b; break;
+                    case vm_op::mul: regs[instr.dst] = a * b; break;
+                    case vm_op::div: regs[instr.dst] = a / b; break;
+                    case vm_op::mod: regs[instr.dst] = a % b; break;
+                    case vm_op::bit_and: regs[instr.dst] = a & b; break;
+                    case vm_op::bit_or: regs[instr.dst] = a | b; break;
+                    case vm_op::bit_xor: regs[instr.dst] = a ^ b; break;
+                    case vm_op::shr: regs[instr.dst] = a >> b; break;
+                    case vm_op::gt: regs[instr.dst] = (a > b) ? 1 : 0; break;
+                    case vm_op::eq: regs[instr.dst] = (a == b) ? 1 : 0; break;
+                    case vm_op::jmp: ip += a; continue;
+                    case vm_op::jnz: ip += (a != 0) ? b : 1; continue;
+                    case vm_op::jgz: ip += (a > 0) ? b : 1; continue;
+                    case vm_op::jie: ip += (a % 2 == 0) ? b : 1; continue;
+                    case vm_op::jio: ip += (a == 1) ? b : 1; continue;
+                    case vm_op::out: handler.output(a); break;
+                    case vm_op::in:
+                        if (!handler.input(regs[instr.dst])) {
+                            ip_ = ip;
+                            return vm_status::blocked;
+                        }
+                        break;
+                    case vm_op::tgl:
+                        toggle(ip + a);
+                        code = program_.code.data();
+                        break;
+                    default:
+                        throw std::runtime_error("vm: bad instruction");
+                }
+
+                if constexpr (BoundIp) {
+                    ip = regs[ip_reg] + 1;
+                } else {
+                    ++ip;
+                }
+            }
+            ip_ = ip;
+            return vm_status::halted;
+        }
+    };
+
+}
@@ -0,0 +1,65 @@
+#include "self_test.h"
+#include "graph_search.h"
+#include <print>
+#include <utility>
+#include <vector>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // a graph of 4 states in which 0 and 1 are joined both ways by edges of
+    // weight 0, then 1 leads to 2 and 2 to 3.
+    std::vector<std::pair<int, int>> zero_weight_neighbors(int s) {
+        switch (s) {
+            case 0: return { { 1, 0 } };
+            case 1: return { { 0, 0 }, { 2, 1 } };
+            case 2: return { { 3, 0 } };
+            default: return {};
+        }
+    }
+
+    // states reached at distance 0 are not starts unless given as one, and a
+    // start reached from another start by an edge of weight 0 stays a start.
+    bool search_path_through_zero_weight_edges() {
+        using aoc::search_tracking;
+        auto paths = aoc::dijkstra_search<search_tracking::paths>(0, zero_weight_neighbors);
+        auto all_paths = aoc::dijkstra_search<search_tracking::all_paths>(0, zero_weight_neighbors);
+        auto from_both = aoc::dijkstra_search<search_tracking::all_paths>(
+            std::vector<int>{ 0, 1 }, zero_weight_neighbors
+        );
+        return paths.path_to(3) == std::vector<int>{ 0, 1, 2, 3 } &&
+            all_paths.path_to(3) == std::vector<int>{ 0, 1, 2, 3 } &&
+            from_both.path_to(1) == std::vector<int>{ 1 } &&
+            from_both.predecessors(0).empty() && from_both.predecessors(1).empty();
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+const aoc::self_test_table& aoc::util_self_tests() {
+    static const self_test_table tests = {
+        { "search path through zero weight edges", search_path_through_zero_weight_edges }
+    };
+    return tests;
+}
+
+int aoc::run_self_tests(const std::vector<const self_test_table*>& tables) {
+    int failures = 0;
+    int count = 0;
+    for (const auto* table : tables) {
+        for (const auto& test : *table) {
+            bool passed = false;
+            try {
+                passed = test.check();
+            } catch (const std::exception& e) {
+                std::println("{}: threw '{}'", test.name, e.what());
+            }
+            std::println("{:<48} {}", test.name, passed ? "ok" : "FAILED");
+            failures += passed ? 0 : 1;
+            ++count;
+        }
+    }
+    std::println("{} of {} checks failed", failures, count);
+    return failures;
+}
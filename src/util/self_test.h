@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+    // a check of an engine's compiled or fused fast path against its plain
+    // reference path, on a small hand-written program; true if the two agree.
+    struct self_test {
+        std::string name;
+        std::function<bool()> check;
+    };
+
+    using self_test_table = std::vector<self_test>;
+
+    // the checks of the shared utilities.
+    const self_test_table& util_self_tests();
+
+    // runs the checks of each table. Run by 'advent_of_code test', which ctest
+    // runs. Prints each check and returns the number that failed.
+    int run_self_tests(const std::vector<const self_test_table*>& tables);
+
+}
@@ -0,0 +1,44 @@
+#include "solver.h"
+#include <format>
+#include <print>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    std::string format_result(int part, const std::string& result) {
+        if (result.contains('\n')) {
+            return std::format("  part {}:\n\n{}\n", part, result);
+        }
+        return std::format("  part {}: {}\n", part, result);
+    }
+
+}
+
+std::string aoc::day_output(const day_table& days, int day, std::optional<int> part) {
+    auto index = day - 1;
+    if (index < 0) {
+        return std::format("invalid day: {0}\n", day);
+    }
+
+    if (index >= static_cast<int>(days.size())) {
+        return std::format("Day {0} is not complete.\n", day);
+    }
+
+    const auto& entry = days[index];
+    auto solver = entry.create();
+    solver->parse();
+
+    auto output = std::format("--- Day {}: {} ---\n", day, entry.title);
+    if (!part || *part == 1) {
+        output += format_result(1, solver->part_1());
+    }
+    if (!part || *part == 2) {
+        output += format_result(2, solver->part_2());
+    }
+    return output;
+}
+
+void aoc::run_day(const day_table& days, int day, std::optional<int> part) {
+    std::print("{}", day_output(days, day, part));
+}
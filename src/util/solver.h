@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <optional>
+#include <format>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+    // A day is split into a parse phase and two parts so that the runner can time
+    // the phases independently, skip a part, and reuse one parsed input across many
+    // benchmark repetitions. The parts return printable results instead of printing.
+
+    class solver {
+    public:
+        virtual ~solver() = default;
+        virtual void parse() = 0;
+        virtual std::string part_1() = 0;
+        virtual std::string part_2() = 0;
+    };
+
+    using solver_ptr = std::unique_ptr<solver>;
+
+    template<typename T>
+    std::string to_result(const T& val) {
+        if constexpr (std::is_convertible_v<const T&, std::string>) {
+            return std::string(val);
+        } else {
+            return std::format("{}", val);
+        }
+    }
+
+    template<typename P, typename F1, typename F2>
+    class lambda_solver : public solver {
+        using input_type = std::decay_t<std::invoke_result_t<P&>>;
+
+        P parse_;
+        F1 part_1_;
+        F2 part_2_;
+        std::optional<input_type> input_;
+
+        const input_type& input() {
+            if (!input_) {
+                parse();
+            }
+            return *input_;
+        }
+
+    public:
+        lambda_solver(P parse, F1 part_1, F2 part_2) :
+            parse_(std::move(parse)), part_1_(std::move(part_1)), part_2_(std::move(part_2))
+        {}
+
+        void parse() override {
+            input_.reset();
+            input_.emplace(parse_());
+        }
+
+        std::string part_1() override {
+            return to_result(part_1_(input()));
+        }
+
+        std::string part_2() override {
+            return to_result(part_2_(input()));
+        }
+    };
+
+    // The parse function takes no arguments and returns the parsed input; the part
+    // functions take the parsed input by const reference, or by value if they need
+    // a mutable copy.
+
+    template<typename P, typename F1, typename F2>
+    solver_ptr make_solver(P parse, F1 part_1, F2 part_2) {
+        return std::make_unique<lambda_solver<P, F1, F2>>(
+            std::move(parse), std::move(part_1), std::move(part_2)
+        );
+    }
+
+    struct day_entry {
+        std::string title;
+        std::function<solver_ptr()> create;
+    };
+
+    using day_table = std::vector<day_entry>;
+
+    std::string day_output(const day_table& days, int day, std::optional<int> part = {});
+    void run_day(const day_table& days, int day, std::optional<int> part = {});
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <charconv>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace aoc {
+
+    // Lazy splitting of a string_view into string_view fields over the original
+    // buffer; nothing is copied, so the text must outlive the fields.
+    //
+    //     split_view(line, ',')          single character delimiter
+    //     split_view(line, " -> ")       multi-character delimiter
+    //     tokenize(line)                 runs of whitespace, no empty tokens
+    //     tokenize(line, " ,:")          runs of any of the given characters
+    //
+    // split_view follows std::getline: a trailing delimiter does not produce a final
+    // empty field.
+
+    namespace delimiters {
+
+        struct single_char {
+            char ch;
+
+            std::pair<size_t, size_t> find(std::string_view text, size_t pos) const {
+                return { text.find(ch, pos), 1 };
+            }
+        };
+
+        struct substring {
+            std::string_view str;
+
+            std::pair<size_t, size_t> find(std::string_view text, size_t pos) const {
+                return { str.empty() ? std::string_view::npos : text.find(str, pos), str.size() };
+            }
+        };
+
+        struct any_of {
+            std::string_view chars;
+
+            std::pair<size_t, size_t> find(std::string_view text, size_t pos) const {
+                auto start = text.find_first_of(chars, pos);
+                if (start == std::string_view::npos) {
+                    return { start, 0 };
+                }
+                auto end = text.find_first_not_of(chars, start);
+                return { start, ((end == std::string_view::npos) ? text.size() : end) - start };
+            }
+        };
+    }
+
+    template<typename D, bool SkipEmpty>
+    class basic_split_view : public std::ranges::view_interface<basic_split_view<D, SkipEmpty>> {
+        std::string_view text_;
+        D delim_;
+
+    public:
+        class iterator {
+            std::string_view text_;
+            D delim_;
+            size_t pos_;
+            size_t end_;
+            size_t next_;
+
+            void find_field() {
+                while (pos_ < text_.size()) {
+                    auto [found, len] = delim_.find(text_, pos_);
+                    bool last_field = (found == std::string_view::npos);
+                    end_ = last_field ? text_.size() : found;
+                    next_ = last_field ? text_.size() : found + len;
+                    if (!SkipEmpty || end_ > pos_) {
+                        return;
+                    }
+                    pos_ = next_;
+                }
+                pos_ = std::string_view::npos;
+            }
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() : delim_{}, pos_(std::string_view::npos), end_(0), next_(0) {}
+
+            iterator(std::string_view text, D delim) :
+                    text_(text), delim_(delim), pos_(0), end_(0), next_(0) {
+                find_field();
+            }
+
+            std::string_view operator*() const {
+                return text_.substr(pos_, end_ - pos_);
+            }
+
+            iterator& operator++() {
+                pos_ = next_;
+                find_field();
+                return *this;
+            }
+
+            iterator operator++(int) {
+                auto temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            bool operator==(const iterator& other) const {
+                return pos_ == other.pos_;
+            }
+
+            bool operator==(std::default_sentinel_t) const {
+                return pos_ == std::string_view::npos;
+            }
+        };
+
+        basic_split_view() = default;
+
+        basic_split_view(std::string_view text, D delim) : text_(text), delim_(delim)
+        {}
+
+        iterator begin() const {
+            return iterator(text_, delim_);
+        }
+
+        std::default_sentinel_t end() const {
+            return std::default_sentinel;
+        }
+    };
+
+    inline auto split_view(std::string_view text, char delim) {
+        return basic_split_view<delimiters::single_char, false>(text, { delim });
+    }
+
+    inline auto split_view(std::string_view text, std::string_view delim) {
+        return basic_split_view<delimiters::substring, false>(text, { delim });
+    }
+
+    inline auto tokenize(std::string_view text, std::string_view delims = " \t\r\n") {
+        return basic_split_view<delimiters::any_of, true>(text, { delims });
+    }
+
+    // pipeable forms, e.g. line | aoc::views::split_on(',') | rv::transform(...)
+
+    namespace views {
+
+        template<typename Delim>
+        struct split_on_closure {
+            Delim delim;
+
+            friend auto operator|(std::string_view text, const split_on_closure& closure) {
+                return split_view(text, closure.delim);
+            }
+        };
+
+        struct tokenize_closure {
+            std::string_view delims;
+
+            friend auto operator|(std::string_view text, const tokenize_closure& closure) {
+                return aoc::tokenize(text, closure.delims);
+            }
+        };
+
+        inline auto split_on(char delim) {
+            return split_on_closure<char>{ delim };
+        }
+
+        inline auto split_on(std::string_view delim) {
+            return split_on_closure<std::string_view>{ delim };
+        }
+
+        inline auto tokenize(std::string_view delims = " \t\r\n") {
+            return tokenize_closure{ delims };
+        }
+    }
+
+    // Converts one field to T: integers and floating point with std::from_chars
+    // (leading whitespace and '+' are skipped), char as the first character, and
+    // std::string / std::string_view as is.
+
+    template<typename T>
+    T parse_field(std::string_view field) {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            return field;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            return std::string(field);
+        } else if constexpr (std::is_same_v<T, char>) {
+            return field.empty() ? '\0' : field.front();
+        } else {
+            static_assert(std::is_arithmetic_v<T>, "unsupported field type");
+            auto first = field.find_first_not_of(" \t");
+            if (first != std::string_view::npos && field[first] == '+') {
+                ++first;
+            }
+            if (first == std::string_view::npos) {
+                throw std::invalid_argument("empty field");
+            }
+            T value{};
+            auto [ptr, ec] = std::from_chars(field.data() + first, field.data() + field.size(), value);
+            if (ec != std::errc{}) {
+                throw std::invalid_argument("bad field: " + std::string(field));
+            }
+            return value;
+        }
+    }
+
+    // Typed counterpart of split_to_tuple<N>: each field is parsed straight into
+    // its tuple element, e.g. split_to_tuple<int, int, int>("2x3x4", 'x').
+
+    template<typename... Ts, typename Delim>
+    std::tuple<Ts...> split_to_tuple(std::string_view s, Delim delim) {
+        auto fields = split_view(s, delim);
+        auto iter = fields.begin();
+        auto next_field = [&]() {
+            if (iter == fields.end()) {
+                throw std::invalid_argument("too few fields: " + std::string(s));
+            }
+            return *iter++;
+        };
+        return std::tuple<Ts...>{ parse_field<Ts>(next_field())... };
+    }
+}
+
+template<typename D, bool SkipEmpty>
+constexpr bool std::ranges::enable_borrowed_range<aoc::basic_split_view<D, SkipEmpty>> = true;
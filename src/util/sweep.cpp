@@ -0,0 +1,120 @@
+#include "sweep.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <format>
+#include <limits>
+#include <print>
+#include <ranges>
+#include <regex>
+
+namespace r = std::ranges;
+namespace rv = std::ranges::views;
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    // days without a recorded timing could be anything so they are scheduled first.
+
+    double expected_ms(const aoc::sweep_day& sd, const aoc::day_timings& timings) {
+        auto iter = timings.find({ sd.year, sd.day });
+        return (iter != timings.end()) ?
+            iter->second :
+            std::numeric_limits<double>::infinity();
+    }
+
+    double elapsed_ms(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+    }
+
+    std::string run_one(const aoc::sweep_day& sd) {
+        try {
+            return aoc::day_output(*sd.days, sd.day);
+        } catch (const std::exception& e) {
+            return std::format("--- Day {} ---\n  failed: {}\n", sd.day, e.what());
+        }
+    }
+}
+
+// 'bench --json' writes one entry per line per phase; the phases of a day are summed.
+
+aoc::day_timings aoc::load_day_timings(const std::vector<std::string>& json_files) {
+    static const std::regex entry(
+        R"re("year":\s*(\d+),\s*"day":\s*(\d+),.*"median_ms":\s*([0-9.]+))re"
+    );
+    day_timings timings;
+    for (const auto& fname : json_files) {
+        std::ifstream file(fname);
+        std::string line;
+        while (std::getline(file, line)) {
+            std::smatch match;
+            if (std::regex_search(line, match, entry)) {
+                auto key = std::tuple{ std::stoi(match[1]), std::stoi(match[2]) };
+                timings[key] += std::stod(match[3]);
+            }
+        }
+    }
+    return timings;
+}
+
+// Days are submitted longest-expected-first so that the slowest ones are not left
+// until the end; each day's output is buffered and everything is printed in
+// catalogue order once the pool has drained. The days run on the shared pool, so
+// the ones that are parallel inside share its threads rather than adding their own.
+
+void aoc::run_sweep(const std::vector<sweep_day>& days, const day_timings& timings, int num_threads) {
+    if (days.empty()) {
+        return;
+    }
+
+    auto order = rv::iota(0, static_cast<int>(days.size())) | r::to<std::vector>();
+    r::stable_sort(
+        order, std::greater<>(),
+        [&](int i) {
+            return expected_ms(days[i], timings);
+        }
+    );
+
+    std::vector<std::string> outputs(days.size());
+    std::vector<double> day_ms(days.size());
+    int pool_size = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        set_shared_thread_pool_size(num_threads);
+        auto& pool = shared_thread_pool();
+        pool_size = pool.size();
+        thread_pool::task_group group;
+        for (auto i : order) {
+            pool.submit(group,
+                [&, i]() {
+                    auto day_start = std::chrono::steady_clock::now();
+                    outputs[i] = run_one(days[i]);
+                    day_ms[i] = elapsed_ms(day_start);
+                }
+            );
+        }
+        pool.wait(group);
+    }
+    auto total_ms = elapsed_ms(start);
+
+    int year = 0;
+    for (auto [sd, output] : rv::zip(days, outputs)) {
+        if (sd.year != year) {
+            year = sd.year;
+            std::println("=== Advent of Code {} ===\n", year);
+        }
+        std::println("{}", output);
+    }
+
+    auto slowest = r::max_element(day_ms) - day_ms.begin();
+    std::println(stderr,
+        "swept {} days in {:.3f} ms on {} threads (sum of days {:.3f} ms, slowest {} day {} {:.3f} ms)",
+        days.size(), total_ms, pool_size, r::fold_left(day_ms, 0.0, std::plus<>()),
+        days[slowest].year, days[slowest].day, day_ms[slowest]
+    );
+}
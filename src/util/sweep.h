@@ -0,0 +1,23 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "solver.h"
+
+namespace aoc {
+
+    // expected milliseconds per (year, day), as recorded by 'bench --json'
+    using day_timings = std::map<std::tuple<int, int>, double>;
+
+    struct sweep_day {
+        int year;
+        int day;
+        const day_table* days;
+    };
+
+    day_timings load_day_timings(const std::vector<std::string>& json_files);
+
+    void run_sweep(const std::vector<sweep_day>& days, const day_timings& timings, int num_threads);
+}
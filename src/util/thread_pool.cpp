@@ -0,0 +1,138 @@
+#include "thread_pool.h"
+#include <algorithm>
+
+/*------------------------------------------------------------------------------------------------*/
+
+namespace {
+
+    thread_local bool t_on_worker_thread = false;
+
+    int g_shared_pool_size = 0;
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::thread_pool::thread_pool(int num_threads) :
+        next_queue_(0), queued_(0), stopping_(false) {
+    if (num_threads <= 0) {
+        num_threads = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+    }
+    for (int i = 0; i < num_threads; ++i) {
+        queues_.push_back(std::make_unique<task_queue>());
+    }
+    for (int i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(
+            [this, i]() {
+                worker_loop(i);
+            }
+        );
+    }
+}
+
+aoc::thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_available_.notify_all();
+    workers_.clear();
+}
+
+int aoc::thread_pool::size() const {
+    return static_cast<int>(workers_.size());
+}
+
+bool aoc::thread_pool::on_worker_thread() {
+    return t_on_worker_thread;
+}
+
+void aoc::thread_pool::submit(task_group& group, task tsk) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& queue = *queues_[next_queue_];
+    next_queue_ = (next_queue_ + 1) % queues_.size();
+    {
+        std::lock_guard<std::mutex> queue_lock(queue.mutex);
+        queue.tasks.push_back({ std::move(tsk), &group });
+    }
+    ++queued_;
+    ++group.unfinished_;
+    work_available_.notify_one();
+}
+
+// A group's tasks are either queued, and then taken and run here if no worker gets
+// to them first, or already running on some thread, so waiting cannot deadlock
+// even when every worker is itself waiting for a group.
+
+void aoc::thread_pool::wait(task_group& group) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (group.unfinished_ > 0) {
+        if (queued_ > 0) {
+            --queued_;
+            lock.unlock();
+            run_task(take_task(0));
+            lock.lock();
+        } else {
+            group_done_.wait(lock);
+        }
+    }
+}
+
+// The caller has already reserved one of the queued tasks by decrementing queued_,
+// so there is at least one task in some deque for it to find.
+
+aoc::thread_pool::queued_task aoc::thread_pool::take_task(size_t index) {
+    auto n = queues_.size();
+    while (true) {
+        for (size_t i = 0; i < n; ++i) {
+            auto& queue = *queues_[(index + i) % n];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            queued_task qt;
+            if (i == 0) {
+                qt = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            } else {
+                qt = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            return qt;
+        }
+        std::this_thread::yield();
+    }
+}
+
+void aoc::thread_pool::run_task(queued_task qt) {
+    qt.tsk();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--qt.group->unfinished_ == 0) {
+        group_done_.notify_all();
+    }
+}
+
+void aoc::thread_pool::worker_loop(size_t index) {
+    t_on_worker_thread = true;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_available_.wait(lock, [this]() { return stopping_ || queued_ > 0; });
+            if (queued_ == 0) {
+                return;
+            }
+            --queued_;
+        }
+        run_task(take_task(index));
+    }
+}
+
+/*------------------------------------------------------------------------------------------------*/
+
+aoc::thread_pool& aoc::shared_thread_pool() {
+    static thread_pool pool(g_shared_pool_size);
+    return pool;
+}
+
+void aoc::set_shared_thread_pool_size(int num_threads) {
+    g_shared_pool_size = num_threads;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+namespace aoc {
+
+    // A fixed-size pool in which every worker owns a deque of tasks. Submitted tasks
+    // are dealt round-robin onto the deques; a worker takes from the front of its own
+    // deque and, once that is empty, steals from the back of another worker's, so a
+    // batch of very uneven tasks keeps all of the threads busy until it is drained.
+    // Tasks must not throw.
+    //
+    // Tasks are submitted into a task_group and waited for a group at a time. A
+    // thread waiting for a group runs queued tasks meanwhile, so a task may itself
+    // submit to the pool it runs on and wait, which is how a day run by the sweep
+    // hashes in parallel without starting threads of its own.
+
+    class thread_pool {
+    public:
+        using task = std::function<void()>;
+
+        // the tasks of one batch; it must outlive them.
+        class task_group {
+            friend class thread_pool;
+            int unfinished_ = 0;
+        };
+
+        explicit thread_pool(int num_threads = 0);
+        ~thread_pool();
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        int size() const;
+        void submit(task_group& group, task tsk);
+        void wait(task_group& group);
+
+        // true on a worker thread of any pool.
+        static bool on_worker_thread();
+
+    private:
+        struct queued_task {
+            task tsk;
+            task_group* group;
+        };
+
+        struct task_queue {
+            std::mutex mutex;
+            std::deque<queued_task> tasks;
+        };
+
+        std::vector<std::unique_ptr<task_queue>> queues_;
+        std::vector<std::jthread> workers_;
+        size_t next_queue_;
+
+        std::mutex mutex_;
+        std::condition_variable work_available_;
+        std::condition_variable group_done_;
+        int queued_;
+        bool stopping_;
+
+        queued_task take_task(size_t index);
+        void run_task(queued_task qt);
+        void worker_loop(size_t index);
+    };
+
+    // the pool that the parallel parts of the days share, one thread per core, or
+    // as many as set_shared_thread_pool_size asked for before its first use.
+    thread_pool& shared_thread_pool();
+    void set_shared_thread_pool_size(int num_threads);
+
+}
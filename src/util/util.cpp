@@ -1,7 +1,8 @@
 #include "util.h"
+#include "input.h"
+#include "numbers.h"
 #include <ranges>
-#include <iostream>
-#include <fstream>
+#include <charconv>
 #include <sstream>
 #include <algorithm>
 #include <functional>
@@ -16,17 +17,8 @@ namespace fs = std::filesystem;
 
 namespace {
 
-    void ltrim(std::string& s) {
-        s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char ch) {
-            return !std::isspace(ch);
-            }));
-    }
-
-    // trim from end (in place)
-    void rtrim(std::string& s) {
-        s.erase(std::find_if(s.rbegin(), s.rend(), [](unsigned char ch) {
-            return !std::isspace(ch);
-            }).base(), s.end());
+    bool is_space(char ch) {
+        return std::isspace(static_cast<unsigned char>(ch));
     }
 
     // We assume the executable is being run from the build the directory and that the
@@ -67,61 +59,58 @@ std::string aoc::input_path(int year, int day, const std::string& tag) {
     return inp_path.string();
 }
 
-std::vector<std::string> aoc::file_to_string_vector(const std::string& filename) {
-    std::vector<std::string> v;
-
-    std::ifstream fs(filename);
-    if (!fs) {
-        throw std::runtime_error("bad file");
-    }
+// Both loaders read through a memory mapping of the file rather than an ifstream;
+// use aoc::mapped_file directly to work with views and skip the copies entirely.
 
-    std::string line;
-    while (std::getline(fs, line)) {
-        v.push_back(line);
-    }
-    return v;
+std::vector<std::string> aoc::file_to_string_vector(const std::string& filename) {
+    mapped_file file(filename);
+    return file.lines() | rv::transform(
+            [](std::string_view line) {
+                return std::string(line);
+            }
+        ) | r::to<std::vector>();
 }
 
-std::string aoc::trim(const std::string& str) {
-    auto trimmed = str;
-    ltrim(trimmed);
-    rtrim(trimmed);
-    return trimmed;
+std::string aoc::trim(std::string_view str) {
+    auto first = r::find_if_not(str, is_space);
+    auto last = r::find_if_not(str | rv::reverse, is_space).base();
+    return (first < last) ? std::string(first, last) : std::string();
 }
 
-std::string aoc::collapse_whitespace(const std::string& str) {
-    std::stringstream ss;
+std::string aoc::collapse_whitespace(std::string_view str) {
+    std::string collapsed;
+    collapsed.reserve(str.size());
     for (auto i = str.begin(); i != str.end(); ++i) {
-        ss << *i;
-        if (std::isspace(*i)) {
-            while (i + 1 != str.end() && std::isspace(*(i + 1))) {
+        collapsed.push_back(*i);
+        if (is_space(*i)) {
+            while (i + 1 != str.end() && is_space(*(i + 1))) {
                 ++i;
             }
         }
     }
-    return trim(ss.str());
+    return trim(collapsed);
 }
 
-bool aoc::is_number(const std::string& s) {
+bool aoc::is_number(std::string_view s) {
     return !s.empty() && std::find_if(s.begin(),
         s.end(), [](unsigned char c) { return !std::isdigit(c); }) == s.end();
 }
 
-std::vector<std::string> aoc::split(const std::string& s, char delim) {
-    std::stringstream ss(s);
-    std::string item;
-    std::vector<std::string> elems;
-    while (std::getline(ss, item, delim)) {
-        elems.push_back(item);
-    }
-    return elems;
+std::vector<std::string_view> aoc::split_views(std::string_view s, char delim) {
+    return split_view(s, delim) | r::to<std::vector>();
+}
+
+std::vector<std::string> aoc::split(std::string_view s, char delim) {
+    return split_views(s, delim) | rv::transform(
+            [](std::string_view item) {
+                return std::string(item);
+            }
+        ) | r::to<std::vector>();
 }
 
 std::string aoc::file_to_string(const std::string& filename) {
-    std::ifstream file(filename);
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
+    mapped_file file(filename);
+    return std::string(file.contents());
 }
 
 std::vector<std::vector<int>> aoc::strings_to_2D_array_of_digits(const std::vector<std::string>& lines) {
@@ -140,21 +129,21 @@ std::vector<std::vector<int>> aoc::strings_to_2D_array_of_digits(const std::vect
     return grid;
 }
 
-std::string aoc::remove_nonalphabetic(const std::string& str) {
-    auto s = str;
-    s.erase(std::remove_if(s.begin(), s.end(),
-        [](auto const& c) -> bool { return !std::isalpha(c); }), s.end());
+std::string aoc::remove_nonalphabetic(std::string_view str) {
+    std::string s;
+    std::copy_if(str.begin(), str.end(), std::back_inserter(s),
+        [](auto const& c) -> bool { return std::isalpha(c); });
     return s;
 }
 
-std::string aoc::remove_nonnumeric(const std::string& str) {
-    auto s = str;
-    s.erase(std::remove_if(s.begin(), s.end(),
-        [](auto const& c) -> bool { return !std::isdigit(c); }), s.end());
+std::string aoc::remove_nonnumeric(std::string_view str) {
+    std::string s;
+    std::copy_if(str.begin(), str.end(), std::back_inserter(s),
+        [](auto const& c) -> bool { return std::isdigit(c); });
     return s;
 }
 
-std::vector<std::string> aoc::extract_alphabetic(const std::string& str) {
+std::vector<std::string> aoc::extract_alphabetic(std::string_view str) {
     auto just_letters = aoc::collapse_whitespace(
         str | rv::transform(
             [](char ch)->char {
@@ -165,7 +154,7 @@ std::vector<std::string> aoc::extract_alphabetic(const std::string& str) {
     return split(just_letters, ' ');
 }
 
-std::vector<std::string> aoc::extract_alphanumeric(const std::string& str) {
+std::vector<std::string> aoc::extract_alphanumeric(std::string_view str) {
     auto just_alnum = aoc::collapse_whitespace(
         str | rv::transform(
             [](char ch)->char {
@@ -176,34 +165,19 @@ std::vector<std::string> aoc::extract_alphanumeric(const std::string& str) {
     return split(just_alnum, ' ');
 }
 
-std::vector<int> aoc::extract_numbers(const std::string& str, bool allow_negatives) {
-    std::function<bool(char)> is_digit = (allow_negatives) ?
-        [](char ch)->bool {return std::isdigit(ch) || ch == '-'; } :
-        [](char ch)->bool {return std::isdigit(ch); };
-    auto just_numbers = aoc::collapse_whitespace( str |
-        rv::transform(
-            [is_digit](char ch)->char {
-                return (is_digit(ch)) ? ch : ' ';
-            }
-        ) | r::to<std::string>()
-    );
-    auto pieces = split(just_numbers, ' ');
-    pieces = pieces |
-        rv::filter([](auto&& str) {return !str.empty(); }) |
-        r::to<std::vector<std::string>>();
-    return pieces |
-        rv::transform(
-            [](const auto& p)->int {
-                return std::stoi(p);
-            }
-    ) | r::to<std::vector<int>>();
+std::vector<int> aoc::extract_numbers(std::string_view str, bool allow_negatives) {
+    std::vector<int> numbers;
+    scan_numbers(str, numbers, allow_negatives);
+    return numbers;
 }
 
-
-int64_t aoc::string_to_int64(const std::string& str) {
-    int64_t value;
-    std::istringstream iss(str);
-    iss >> value;
+int64_t aoc::string_to_int64(std::string_view str) {
+    auto first = r::find_if_not(str, is_space);
+    if (first != str.end() && *first == '+') {
+        ++first;
+    }
+    int64_t value = 0;
+    std::from_chars(std::to_address(first), str.data() + str.size(), value);
     return value;
 }
 
@@ -230,23 +204,8 @@ std::vector<std::vector<std::string>> aoc::group_strings_separated_by_blank_line
         ) | r::to<std::vector<std::vector<std::string>>>();
 }
 
-std::vector<int64_t> aoc::extract_numbers_int64(const std::string& str, bool allow_negatives) {
-    std::function<bool(char)> is_digit = (allow_negatives) ?
-        [](char ch)->bool {return std::isdigit(ch) || ch == '-'; } :
-        [](char ch)->bool {return std::isdigit(ch); };
-    auto just_numbers = aoc::collapse_whitespace(str |
-        rv::transform(
-            [is_digit](char ch)->char {
-                return (is_digit(ch)) ? ch : ' ';
-            }
-        ) | r::to<std::string>()
-                );
-    auto pieces = split(just_numbers, ' ');
-    pieces = pieces |
-        rv::filter([](auto&& str) {return !str.empty(); }) |
-        r::to<std::vector<std::string>>();
-    return pieces |
-        rv::transform(
-            string_to_int64
-        ) | r::to<std::vector<int64_t>>();
-}
\ No newline at end of file
+std::vector<int64_t> aoc::extract_numbers_int64(std::string_view str, bool allow_negatives) {
+    std::vector<int64_t> numbers;
+    scan_numbers(str, numbers, allow_negatives);
+    return numbers;
+}
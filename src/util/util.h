@@ -2,28 +2,32 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <map>
 #include <unordered_map>
 #include <ranges>
+#include "split_view.h"
+#include "priority_queue.h"
 
 namespace aoc {
 
     std::string input_path(int year, int day, const std::string& tag = {});
     std::vector<std::string> file_to_string_vector(const std::string& filename);
     std::string file_to_string(const std::string& filename);
-    std::string collapse_whitespace(const std::string& str);
-    bool is_number(const std::string& s);
-    std::vector<std::string> split(const std::string& s, char delim);
+    std::string collapse_whitespace(std::string_view str);
+    bool is_number(std::string_view s);
+    std::vector<std::string> split(std::string_view s, char delim);
+    std::vector<std::string_view> split_views(std::string_view s, char delim);
     std::vector<std::vector<int>> strings_to_2D_array_of_digits(const std::vector<std::string>& lines);
-    std::vector<int> extract_numbers(const std::string& str, bool allow_negatives = false);
-    std::vector<int64_t> extract_numbers_int64(const std::string& str, bool allow_negatives = false);
-    std::vector<std::string> extract_alphabetic(const std::string& str);
-    std::vector<std::string> extract_alphanumeric(const std::string& str);
-    std::string remove_nonalphabetic(const std::string& str);
-    std::string remove_nonnumeric(const std::string& str);
-    std::string trim(const std::string& str);
-    int64_t string_to_int64(const std::string& str);
+    std::vector<int> extract_numbers(std::string_view str, bool allow_negatives = false);
+    std::vector<int64_t> extract_numbers_int64(std::string_view str, bool allow_negatives = false);
+    std::vector<std::string> extract_alphabetic(std::string_view str);
+    std::vector<std::string> extract_alphanumeric(std::string_view str);
+    std::string remove_nonalphabetic(std::string_view str);
+    std::string remove_nonnumeric(std::string_view str);
+    std::string trim(std::string_view str);
+    int64_t string_to_int64(std::string_view str);
     std::vector<std::vector<std::string>> group_strings_separated_by_blank_lines(const std::vector<std::string>& lines);
 
     template <typename U, std::size_t... Is>
@@ -37,54 +41,11 @@ namespace aoc {
     }
 
     template <std::size_t N>
-    auto split_to_tuple(const std::string& s, char delim) {
+    auto split_to_tuple(std::string_view s, char delim) {
         auto vec = split(s, delim);
         return create_tuple<N, std::string>(vec);
     }
  
-    template<typename V, typename H = std::hash< V>>
-    class priority_queue {
-        using map_impl = std::multimap<int, V>;
-        map_impl priority_to_item_;
-        std::unordered_map<V, typename map_impl::iterator, H> item_to_mmap_iter_;
-
-    public:
-        priority_queue()
-        {}
-
-        V extract_min() {
-            auto first = priority_to_item_.begin();
-            auto loc = first->second;
-            priority_to_item_.erase(first);
-            item_to_mmap_iter_.erase(loc);
-            return loc;
-        }
-
-        void insert(const V& loc, int priority) {
-            auto iter = priority_to_item_.insert({ priority, loc });
-            item_to_mmap_iter_[loc] = iter;
-        }
-
-        bool contains(const V& v) const {
-            return item_to_mmap_iter_.contains(v);
-        }
-
-        void change_priority(const V& loc, int priority) {
-            auto iter = item_to_mmap_iter_[loc];
-            priority_to_item_.erase(iter);
-            item_to_mmap_iter_.erase(loc);
-            insert(loc, priority);
-        }
-
-        bool empty() const {
-            return priority_to_item_.empty(); 
-        }
-
-        size_t size() const {
-            return priority_to_item_.size();
-        }
-    };
-
     auto two_combinations(const auto& container) {
         namespace r = std::ranges;
         namespace rv = std::ranges::views;
@@ -3,6 +3,8 @@
 #include <boost/functional/hash.hpp>
 #include <unordered_set>
 #include <unordered_map>
+#include "hash.h"
+#include "flat_hash.h"
 
 namespace aoc {
 
@@ -43,17 +45,33 @@ namespace aoc {
     template<typename T>
     struct hash_vec2 {
         size_t operator()(const vec2<T>& pt) const {
-            size_t seed = 0;
-            boost::hash_combine(seed, pt.x);
-            boost::hash_combine(seed, pt.y);
-            return seed;
+            if constexpr (is_packable_coordinate<T>) {
+                return hash_words(pack_coordinates(pt.x, pt.y));
+            } else {
+                return hash_words(hash_bits(pt.x), hash_bits(pt.y));
+            }
         }
     };
 
+    // vec2_set and vec2_map are flat open-addressing tables; define
+    // AOC_STD_HASH_CONTAINERS to fall back to the std unordered containers.
+
+#ifdef AOC_STD_HASH_CONTAINERS
+
     template<typename T>
     using vec2_set = std::unordered_set<vec2<T>, hash_vec2<T>>;
 
     template<typename T, typename U>
     using vec2_map = std::unordered_map<vec2<T>, U, hash_vec2<T>>;
 
+#else
+
+    template<typename T>
+    using vec2_set = flat_hash_set<vec2<T>, hash_vec2<T>>;
+
+    template<typename T, typename U>
+    using vec2_map = flat_hash_map<vec2<T>, U, hash_vec2<T>>;
+
+#endif
+
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <boost/functional/hash.hpp>
 #include <unordered_set>
 #include <unordered_map>
+#include "hash.h"
+#include "flat_hash.h"
 
 namespace aoc {
 
@@ -51,19 +53,33 @@ namespace aoc {
     template<typename T>
     struct hash_vec4 {
         size_t operator()(const vec4<T>& pt) const {
-            size_t seed = 0;
-            boost::hash_combine(seed, pt.w);
-            boost::hash_combine(seed, pt.x);
-            boost::hash_combine(seed, pt.y);
-            boost::hash_combine(seed, pt.z);
-            return seed;
+            if constexpr (is_packable_coordinate<T>) {
+                return hash_words(pack_coordinates(pt.w, pt.x), pack_coordinates(pt.y, pt.z));
+            } else {
+                return hash_words(hash_bits(pt.w), hash_bits(pt.x), hash_bits(pt.y), hash_bits(pt.z));
+            }
         }
     };
 
+    // vec4_set and vec4_map are flat open-addressing tables; define
+    // AOC_STD_HASH_CONTAINERS to fall back to the std unordered containers.
+
+#ifdef AOC_STD_HASH_CONTAINERS
+
     template<typename T>
     using vec4_set = std::unordered_set<vec4<T>, hash_vec4<T>>;
 
     template<typename T, typename U>
     using vec4_map = std::unordered_map<vec4<T>, U, hash_vec4<T>>;
 
+#else
+
+    template<typename T>
+    using vec4_set = flat_hash_set<vec4<T>, hash_vec4<T>>;
+
+    template<typename T, typename U>
+    using vec4_map = flat_hash_map<vec4<T>, U, hash_vec4<T>>;
+
+#endif
+
 }
\ No newline at end of file